@@ -0,0 +1,58 @@
+"""
+PlatformIO extra script: install the EXTIO2 firmware partition
+
+Packs extio2/extfw.bin with pack_extio2_firmware.py whenever an EXTIO2 image
+is newer than it, and adds it to the images `pio run -t upload` writes over
+USB (next to the bootloader and partition table), so a USB upload always
+leaves the Dial with the partition table and the images it expects.
+
+`pio run -t uploadextfw` writes only the partition. OTA updates the app
+partition only: a device moved to this partition table once over USB keeps
+its images across OTA updates, but one still on the old table needs a USB
+upload first.
+"""
+import os
+import subprocess
+import sys
+
+Import('env')  # noqa: F821 (provided by PlatformIO)
+
+EXTFW_OFFSET = '0x3D0000'  # extfw in partitions.csv
+
+project_dir = env.subst('$PROJECT_DIR')  # noqa: F821
+pack_script = os.path.join(project_dir, 'pack_extio2_firmware.py')
+extfw_bin = os.path.join(project_dir, 'extio2', 'extfw.bin')
+sources = [
+    pack_script,
+    os.path.join(project_dir, 'extio2', 'firmware_custom.bin'),
+    os.path.join(project_dir, 'extio2', 'firmware_original.bin'),
+]
+
+
+def pack_extfw():
+    if os.path.exists(extfw_bin):
+        built = os.path.getmtime(extfw_bin)
+        if all(os.path.getmtime(path) <= built for path in sources):
+            return
+    print('Packing EXTIO2 firmware partition')
+    result = subprocess.call([sys.executable, pack_script, '-o', extfw_bin], cwd=project_dir)
+    if result != 0:
+        sys.exit('pack_extio2_firmware.py failed')
+
+
+pack_extfw()
+
+# Written with the bootloader and partition table on every USB upload
+env.Append(FLASH_EXTRA_IMAGES=[(EXTFW_OFFSET, extfw_bin)])  # noqa: F821
+
+env.AddCustomTarget(  # noqa: F821
+    name='uploadextfw',
+    dependencies=None,
+    actions=[
+        env.VerboseAction(env.AutodetectUploadPort, 'Looking for upload port...'),  # noqa: F821
+        '"$PYTHONEXE" "$UPLOADER" --chip $BOARD_MCU --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED '
+        'write_flash %s "%s"' % (EXTFW_OFFSET, extfw_bin),
+    ],
+    title='Upload EXTIO2 firmware partition',
+    description='Write extio2/extfw.bin to the extfw partition over USB',
+)
@@ -0,0 +1,109 @@
+#ifndef ANALOG_ACQUISITION_H
+#define ANALOG_ACQUISITION_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Analog inputs streamed by the ADC continuous (DMA) driver. Append spare
+// ADC1 pins here; the conversion pattern round-robins over all of them.
+enum AnalogChannel {
+    ANALOG_TEC_CURRENT,  // BTS7960 IS (GPIO1)
+    ANALOG_CHANNEL_COUNT
+};
+
+struct AnalogInputConfig {
+    const char* name;
+    uint8_t adcChannel;      // ADC1 channel (GPIOn = channel n-1 on the S3)
+    uint16_t windowSamples;  // Samples per statistics window
+};
+
+constexpr AnalogInputConfig ANALOG_INPUTS[] = {
+    // 201 samples at 40.2 kHz = exactly 100 TEC PWM periods (see TECController)
+    {"tecCurrent", 0, 201},
+};
+
+// Statistics over one completed window, in volts
+struct AnalogWindow {
+    float mean;
+    float rms;
+    float min;
+    float max;
+    uint32_t sequence;  // Increments per completed window; 0 = none yet
+};
+
+// Continuous ADC1 acquisition. The DMA fills the driver's buffer without CPU
+// involvement; update() (called from loop) drains it into a per-channel ring
+// of raw samples and per-window mean/RMS/min/max.
+class AnalogAcquisition {
+public:
+    static AnalogAcquisition& getInstance();
+
+    void begin();
+    void update();  // Call every loop; never blocks
+
+    bool isRunning() const { return _running; }
+    const AnalogWindow& getWindow(AnalogChannel channel) const { return _channels[channel].window; }
+
+    // Copy the completed windows newer than afterSequence (oldest first, at
+    // most the last WINDOW_HISTORY); returns the count. Lets a consumer see
+    // every window however many completed since its last loop.
+    size_t readWindows(AnalogChannel channel, uint32_t afterSequence,
+                       AnalogWindow* dest, size_t maxCount) const;
+
+    static constexpr size_t WINDOW_HISTORY = 16;  // Completed windows kept per channel
+
+    // Copy the most recent samples (oldest first, volts); returns the count
+    size_t readSamples(AnalogChannel channel, float* dest, size_t maxCount) const;
+
+    // Conversions per second per channel. Fixed by the TEC current windows:
+    // 2 + 1/100 samples per 20 kHz PWM period.
+    static constexpr uint32_t SAMPLE_HZ_PER_CHANNEL = 40200;
+
+private:
+    AnalogAcquisition() = default;
+    AnalogAcquisition(const AnalogAcquisition&) = delete;
+    AnalogAcquisition& operator=(const AnalogAcquisition&) = delete;
+
+    void addSample(int channel, uint16_t raw);
+    void restartWindows();
+    static float toVolts(float raw) { return raw * 3.3f / 4095.0f; }
+
+    static constexpr size_t RING_SIZE = 512;  // Raw samples kept per channel
+
+    struct Channel {
+        uint16_t ring[RING_SIZE];
+        size_t head;      // Next write position
+        size_t count;     // Valid samples in the ring
+        // Window accumulators (raw counts)
+        uint32_t sum;
+        uint64_t sumSquares;
+        uint16_t min;
+        uint16_t max;
+        uint16_t samples;
+        AnalogWindow window;                   // Latest
+        AnalogWindow history[WINDOW_HISTORY];  // Indexed by sequence % WINDOW_HISTORY
+    };
+
+    Channel _channels[ANALOG_CHANNEL_COUNT];
+    bool _running = false;
+    unsigned long _lastUpdateUs = 0;
+
+    static constexpr uint32_t DMA_FRAME_BYTES = 1024;   // 256 conversions per DMA interrupt
+    static constexpr uint32_t DMA_BUFFER_BYTES = 8192;  // ~50 ms at 40 kHz between loop() calls
+    static constexpr uint32_t MAX_SAMPLE_HZ = 83333;    // ESP32-S3 continuous-mode limit
+    static constexpr uint32_t RESULT_BYTES = 4;         // Per conversion (SOC_ADC_DIGI_RESULT_BYTES)
+
+    // Longest gap between update() calls the driver buffer rides out with a
+    // frame in flight (~44 ms); after a longer one conversions were dropped
+    static constexpr uint32_t MAX_UPDATE_GAP_US = static_cast<uint32_t>(
+        (DMA_BUFFER_BYTES - DMA_FRAME_BYTES) / RESULT_BYTES * 1000000ull /
+        (SAMPLE_HZ_PER_CHANNEL * ANALOG_CHANNEL_COUNT));
+
+    static_assert(SAMPLE_HZ_PER_CHANNEL * ANALOG_CHANNEL_COUNT <= MAX_SAMPLE_HZ,
+                  "Total conversion rate exceeds the continuous-mode limit");
+};
+
+static_assert(sizeof(ANALOG_INPUTS) / sizeof(ANALOG_INPUTS[0]) == ANALOG_CHANNEL_COUNT,
+              "ANALOG_INPUTS must have one entry per AnalogChannel");
+
+#endif
@@ -12,10 +12,12 @@ enum MainScreenSelection {
 
 // Settings menu items
 enum SettingsMenuItem {
+    SETTINGS_PROFILE,
     SETTINGS_TEMP_UNIT,
     SETTINGS_PID,
     SETTINGS_CURRENT,
     SETTINGS_POWER,
+    SETTINGS_ENERGY,
     SETTINGS_FANS,
     SETTINGS_FIRMWARE,
     SETTINGS_BACK,
@@ -41,8 +43,10 @@ enum FanScreenSelection {
 // Smart control menu items
 enum SmartControlMenuItem {
     SMART_CONTROL_TOGGLE,
+    SMART_CONTROL_POLICY,
     SMART_CONTROL_SETPOINT,
     SMART_CONTROL_MAX_FAN,
+    SMART_CONTROL_LOOP,
     SMART_CONTROL_BACK,
     SMART_CONTROL_ITEM_COUNT
 };
@@ -50,7 +54,12 @@ enum SmartControlMenuItem {
 // PID menu items
 enum PIDMenuItem {
     PID_MENU_MODE,
+    PID_MENU_CONTROL,    // Controller: PID / MPC
+    PID_MENU_SCHEDULE,   // Gain schedule: Off / by setpoint / by measured temp
+    PID_MENU_FEEDFORWARD,
+    PID_MENU_ADAPT,      // Online plant estimate: monitor only / re-tune on drift
     PID_MENU_AUTOTUNE,
+    PID_MENU_IDENTIFY,   // Step-response model identification
     PID_MENU_KP,
     PID_MENU_KI,
     PID_MENU_KD,
@@ -89,6 +98,7 @@ public:
     // Auto-tune screen
     void showAutoTuneScreen();
     void updateAutoTuneScreen(int cycle, int totalCycles, const char* status);
+    void updateAutoTuneScreen(const char* progress, const char* status);
     void showAutoTuneError(const char* error);
     void closeAutoTuneScreen();
     bool isAutoTuneScreenVisible() const;
@@ -111,6 +121,12 @@ public:
     void closePowerScreen();
     bool isPowerScreenVisible() const;
 
+    // Energy monitor screen
+    void showEnergyScreen();
+    void updateEnergyScreen(float watts, float sessionWh, float lifetimeWh, float cop, float lift);
+    void closeEnergyScreen();
+    bool isEnergyScreenVisible() const;
+
     // Fan screen
     void showFanScreen();
     void updateFanScreen(int rpm, float speedPercent, FanScreenSelection selection);
@@ -152,6 +168,7 @@ private:
     void createCurrentScreen();
     void createSetpointScreen();
     void createPowerScreen();
+    void createEnergyScreen();
     void createFanScreen();
     void createFanSpeedScreen();
     void createSmartControlScreen();
@@ -212,6 +229,14 @@ private:
     lv_obj_t* _powerValue = nullptr;
     lv_obj_t* _powerBack = nullptr;
 
+    // Energy monitor screen
+    lv_obj_t* _energyScreen = nullptr;
+    lv_obj_t* _energyTitle = nullptr;
+    lv_obj_t* _energyWatts = nullptr;     // Center - large total power
+    lv_obj_t* _energyDetail = nullptr;    // Session / lifetime Wh
+    lv_obj_t* _energyCOP = nullptr;       // COP at the current lift
+    lv_obj_t* _energyBack = nullptr;
+
     // Fan screen
     lv_obj_t* _fanScreen = nullptr;
     lv_obj_t* _fanSpeedLabel = nullptr;   // Top - fan speed setpoint
@@ -242,6 +267,7 @@ private:
     bool _currentVisible = false;
     bool _setpointVisible = false;
     bool _powerVisible = false;
+    bool _energyVisible = false;
     bool _fanVisible = false;
     bool _fanSpeedVisible = false;
     bool _smartControlVisible = false;
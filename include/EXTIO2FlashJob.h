@@ -0,0 +1,55 @@
+#ifndef EXTIO2_FLASH_JOB_H
+#define EXTIO2_FLASH_JOB_H
+
+#include <Arduino.h>
+#include "FirmwareStore.h"
+
+// Runs EXTIO2Flasher on its own FreeRTOS task so loop() keeps LVGL and
+// input alive during the multi-second flash.
+//
+// start() parks the hardware behind the EXTIO2 first: the TEC is disabled
+// (REN low, power 0) and PCA9554 is suspended, so the sensor reads NaN and
+// nothing else in loop() touches the bus. While the EXTIO2 is in its
+// bootloader its pins float: REN stays off and the 4-pin fans run flat out.
+// Page progress and the result arrive through a queue (poll()). Once the
+// task has finished, update() resumes PCA9554, which re-applies every pin
+// and PWM setting to the freshly booted application, and re-enables the TEC
+// if it was enabled.
+class EXTIO2FlashJob {
+public:
+    static EXTIO2FlashJob& getInstance();
+
+    struct Progress {
+        int page;         // Current page (1-based), 0 before the first
+        int totalPages;
+        bool finished;
+        bool success;     // Valid once finished
+    };
+
+    bool start(const FirmwareStore::Image& image);
+    void cancel();  // Stops before the next page
+    bool isRunning() const { return _running; }
+
+    bool poll(Progress& progress);  // Next queued update, non-blocking
+    void update();                  // Call every loop: un-parks after the task ends
+
+private:
+    EXTIO2FlashJob() = default;
+    EXTIO2FlashJob(const EXTIO2FlashJob&) = delete;
+    EXTIO2FlashJob& operator=(const EXTIO2FlashJob&) = delete;
+
+    static void taskMain(void* arg);
+
+    QueueHandle_t _queue = nullptr;
+    const FirmwareStore::Image* _image = nullptr;
+    volatile bool _running = false;
+    volatile bool _taskDone = false;
+    bool _tecWasEnabled = false;
+
+    static constexpr int QUEUE_LENGTH = 16;        // Pages + result, drained every loop
+    static constexpr uint32_t TASK_STACK = 6144;   // Reader window + page buffer + Wire
+    static constexpr UBaseType_t TASK_PRIORITY = 1;
+    static constexpr BaseType_t TASK_CORE = 0;     // loop() and LVGL stay on core 1
+};
+
+#endif
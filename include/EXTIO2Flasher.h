@@ -12,6 +12,7 @@
 #include <Arduino.h>
 #include <Wire.h>
 #include <functional>
+#include "FirmwareStore.h"
 
 class EXTIO2Flasher {
 public:
@@ -47,6 +48,34 @@ public:
     bool flashFirmware(const uint8_t* firmware, uint32_t len,
                        std::function<void(int, int)> progressCallback = nullptr);
 
+    /**
+     * @brief Flash an image from the firmware partition
+     *
+     * The image is decompressed once to check its CRC before the EXTIO2 is
+     * touched, then again page by page while flashing.
+     * @param image Manifest entry from FirmwareStore::find()
+     * @param progressCallback Optional callback for progress updates (currentPage, totalPages)
+     * @return true on success, false on failure
+     */
+    bool flashFirmware(const FirmwareStore::Image& image,
+                       std::function<void(int, int)> progressCallback = nullptr);
+
+    /**
+     * @brief Stop a flash running on another task before its next page
+     *
+     * Cancelling after the first page has been written leaves the EXTIO2 in
+     * its bootloader until it is flashed again.
+     */
+    void cancel() { _cancelRequested = true; }
+
+    /**
+     * @brief Use the bootloader's CRC command (0x08) to skip and verify pages
+     *
+     * Only for a bootloader known to implement it. The stock bootloader does
+     * not, and is never sent the command unless this is set.
+     */
+    void setBootloaderCrc(bool supported) { _bootloaderCrc = supported; }
+
     /**
      * @brief Get the last error message
      * @return Error description string
@@ -64,6 +93,7 @@ private:
     static constexpr uint8_t CMD_IAP_MODE = 0xFD;
     static constexpr uint8_t CMD_VERSION = 0xFE;
     static constexpr uint8_t IAP_CMD_WRITE = 0x06;
+    static constexpr uint8_t IAP_CMD_CRC = 0x08;   // Opt-in: CRC-32 of a flash range
     static constexpr uint8_t IAP_CMD_JUMP = 0x77;
 
     // Flash parameters
@@ -71,6 +101,26 @@ private:
     static constexpr uint32_t FLASH_START_ADDR = 0x08001000;
     static constexpr uint32_t FIRMWARE_MAX_SIZE = 0x2C00;  // 11264 bytes
 
+    // The device NACKs while it resets, programs a page or boots: poll for
+    // its ACK instead of sleeping for the worst case
+    static constexpr uint32_t BOOTLOADER_TIMEOUT_MS = 500;
+    static constexpr uint32_t PAGE_WRITE_TIMEOUT_MS = 200;
+    static constexpr uint32_t CRC_TIMEOUT_MS = 50;
+    static constexpr uint32_t APP_BOOT_TIMEOUT_MS = 1000;
+    // Without CRC verification nothing shows a page really was programmed:
+    // keep the old fixed wait as a floor until the poll is proven on hardware
+    static constexpr uint32_t PAGE_PROGRAM_MIN_MS = 60;
+    static constexpr int PAGE_RETRIES = 3;
+
+    // Fills the next len bytes of the image
+    typedef std::function<bool(uint8_t* data, uint32_t len)> PageSource;
+
+    /**
+     * @brief Bootloader session behind flashFirmware() (bus held at 100 kHz)
+     */
+    bool flashImage(uint32_t len, PageSource source,
+                    std::function<void(int, int)> progressCallback);
+
     /**
      * @brief Enter bootloader mode
      * @return true if bootloader is ready
@@ -78,13 +128,27 @@ private:
     bool enterBootloader();
 
     /**
-     * @brief Flash a single page
+     * @brief Flash a single page and wait until the bootloader answers again
      * @param address Flash address
      * @param data Page data (1024 bytes)
      * @return true on success
      */
     bool flashPage(uint32_t address, const uint8_t* data);
 
+    /**
+     * @brief Ask the bootloader for the CRC-32 of one page
+     * @param address Flash address
+     * @param crc Receives the CRC
+     * @return false if the bootloader has no CRC command or did not answer
+     */
+    bool readPageCrc(uint32_t address, uint32_t& crc);
+
+    /**
+     * @brief Poll until a device acknowledges its address
+     * @return false on timeout
+     */
+    bool waitForAck(uint8_t addr, uint32_t timeoutMs);
+
     /**
      * @brief Jump from bootloader to application
      */
@@ -96,6 +160,8 @@ private:
     bool i2cDevicePresent(uint8_t addr);
 
     const char* _lastError;
+    volatile bool _cancelRequested = false;
+    bool _bootloaderCrc = false;
 };
 
 #endif // EXTIO2_FLASHER_H
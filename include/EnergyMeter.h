@@ -0,0 +1,67 @@
+#ifndef ENERGY_METER_H
+#define ENERGY_METER_H
+
+#include <stdint.h>
+
+// Electrical power and energy accounting for the TEC and fans.
+//
+// TEC power is supply voltage (configured) x average current from
+// TECController. Fans have no current sense, so their power is the
+// configured rating scaled by the fan affinity law (P ~ speed^3), using the
+// tach RPM relative to fanMaxRpm when available. Energy is
+// integrated every loop; session and lifetime Wh are persisted through
+// SettingsManager every PERSIST_INTERVAL_MS and before OTA updates, and the
+// previous session's total is kept when a new one starts at boot.
+//
+// COP is an estimate from the standard TEC model with datasheet parameters:
+//   Qc = duty * (S * I * Tc - I^2 * R / 2) - K * (Th - Tc)
+// with I the on-phase current, Tc the measured cold-side temperature and Th
+// the configured ambient (no hot-side sensor).
+class EnergyMeter {
+public:
+    static EnergyMeter& getInstance();
+
+    void begin();
+    void update(float coldSideC);  // Call every loop with the measured temperature (NAN if unknown)
+    void save();                   // Persist counters now (e.g. before a reboot)
+
+    float getTECPower() const { return _tecWatts; }
+    float getFanPower() const { return _fanWatts; }
+    float getTotalPower() const { return _tecWatts + _fanWatts; }
+
+    float getSessionWh() const { return static_cast<float>(_sessionWh); }
+    float getPreviousSessionWh() const { return _previousSessionWh; }
+    float getLifetimeWh() const { return static_cast<float>(_lifetimeBaseWh + _sessionWh); }
+
+    float getCOP() const { return _cop; }    // NAN while not cooling
+    float getLift() const { return _lift; }  // Hot side - cold side (°C)
+
+private:
+    EnergyMeter() = default;
+    EnergyMeter(const EnergyMeter&) = delete;
+    EnergyMeter& operator=(const EnergyMeter&) = delete;
+
+    void updateCOP(float coldSideC, float duty, float onCurrent);
+
+    float _tecWatts = 0.0f;
+    float _fanWatts = 0.0f;
+    double _sessionWh = 0.0;       // double: small increments on a growing total
+    double _lifetimeBaseWh = 0.0;  // Lifetime before this session
+    float _previousSessionWh = 0.0f;
+    float _cop = 0.0f;
+    float _lift = 0.0f;
+
+    unsigned long _lastUpdate = 0;
+    unsigned long _lastPersist = 0;
+
+    static constexpr unsigned long PERSIST_INTERVAL_MS = 600000;  // 10 minutes
+    static constexpr float MIN_COP_INPUT_W = 1.0f;                // Below this COP is meaningless
+
+    // TEC1-12710 datasheet values at Th = 27°C; adjust for the fitted module
+    static constexpr float TEC_VMAX = 15.4f;   // V
+    static constexpr float TEC_IMAX = 10.5f;   // A
+    static constexpr float TEC_DTMAX = 68.0f;  // K
+    static constexpr float TEC_TH_REF = 300.15f;  // K
+};
+
+#endif
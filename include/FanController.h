@@ -3,6 +3,14 @@
 
 #include <stdint.h>
 
+enum FanHealth {
+    FAN_HEALTH_UNKNOWN,    // EXTIO2 offline or no reading yet
+    FAN_HEALTH_OK,         // Spinning while driven
+    FAN_HEALTH_STOPPED,    // Not spinning, duty is 0 (expected)
+    FAN_HEALTH_SPIN_UP,    // Duty just rose from 0, no tach yet (grace period)
+    FAN_HEALTH_STALLED     // No tach while duty > 0 past the grace period
+};
+
 class FanController {
 public:
     static FanController& getInstance();
@@ -10,38 +18,87 @@ public:
     void begin();
     void update();  // Call periodically to read RPM from EXTIO2
 
-    // Get RPM for each fan (0 if not spinning or not detected)
-    uint16_t getFan1RPM() const { return _fan1RPM; }
-    uint16_t getFan2RPM() const { return _fan2RPM; }
+    // Filtered RPM for each fan (0 if not spinning or not detected)
+    uint16_t getFan1RPM() const { return _fans[0].rpm; }
+    uint16_t getFan2RPM() const { return _fans[1].rpm; }
 
-    // Get average RPM of both fans
+    // Get average RPM of the spinning fans
     uint16_t getAverageRPM() const;
 
-    // Fan speed control (0-100%)
+    // Tach-based health per fan, and whether any fan is stalled
+    FanHealth getFan1Health() const { return _fans[0].health; }
+    FanHealth getFan2Health() const { return _fans[1].health; }
+    bool isStalled() const;
+    static const char* healthName(FanHealth health);
+
+    // Fan speed control (0-100%), open loop
     void setSpeed(uint8_t percent);
-    uint8_t getSpeed() const { return _speedPercent; }
+    uint8_t getSpeed() const { return _speedPercent; }  // Current duty in either mode
+
+    // Closed loop: drive the shared PWM so the mean tach RPM reaches the
+    // target (0 stops the fans). Stays active until setSpeed() is called.
+    void setTargetRPM(uint16_t rpm);
+    uint16_t getTargetRPM() const { return _targetRPM; }
+    bool isRPMControlled() const { return _rpmControl; }
 
     bool isOnline() const { return _online; }
+    bool isHighFrequencyPWM() const { return _pwm25kHz; }  // 25 kHz (4-pin spec) vs 1 kHz fallback
 
 private:
     FanController() = default;
     FanController(const FanController&) = delete;
     FanController& operator=(const FanController&) = delete;
 
-    // Fan tach pins on EXTIO2
+    static constexpr int FAN_COUNT = 2;
+    static constexpr int MEDIAN_SIZE = 3;  // Rejects a single dropped/spiked reading
+
+    struct Fan {
+        uint16_t samples[MEDIAN_SIZE];
+        uint8_t sampleCount;
+        uint8_t sampleIndex;
+        float filtered;               // EMA of the median
+        uint16_t rpm;                 // Published value
+        FanHealth health;
+        bool zeroRun;                 // Median has read 0 while driven...
+        unsigned long zeroSince;      // ...since this time
+    };
+
+    void addSample(int index, uint16_t raw, unsigned long now);
+    void updateHealth(int index, uint16_t med, unsigned long now);
+    static uint16_t median(const Fan& fan);
+    void updateRPMLoop(float dt);
+    float feedForward(uint16_t rpm) const;
+    void applyDuty(uint8_t percent);
+
+    // Fan tach pins on EXTIO2 (consecutive, so one burst read covers both)
     static constexpr uint8_t PIN_FAN1_TACH = 5;  // GPIO5
     static constexpr uint8_t PIN_FAN2_TACH = 6;  // GPIO6
     static constexpr uint8_t PIN_FAN_PWM = 7;    // GPIO7 - PWM control for both fans
+    static_assert(PIN_FAN2_TACH == PIN_FAN1_TACH + 1, "Tach pins must be adjacent for the burst read");
 
     // RPM read interval (ms) - EXTIO2 calculates RPM internally
     static constexpr unsigned long READ_INTERVAL_MS = 500;
 
+    // Filtering and stall detection
+    static constexpr float RPM_EMA_ALPHA = 0.3f;
+    static constexpr unsigned long SPIN_UP_GRACE_MS = 3000;  // Fans need ~1-2 s to report a tach
+    static constexpr unsigned long STALL_CONFIRM_MS = 2000;  // Median must stay at 0 this long
+
+    // RPM loop: feedforward from fanMaxRpm plus PI trim on the filtered mean
+    static constexpr float RPM_KP = 0.01f;          // % duty per rpm error
+    static constexpr float RPM_KI = 0.01f;          // % duty per rpm error per second
+    static constexpr float RPM_TRIM_LIMIT = 50.0f;  // Max integral correction (% duty)
+
     // State tracking
     bool _online = false;
-    uint16_t _fan1RPM = 0;
-    uint16_t _fan2RPM = 0;
+    bool _pwm25kHz = false;
+    Fan _fans[FAN_COUNT] = {};
     unsigned long _lastReadTime = 0;
+    unsigned long _spinUpStart = 0;
     uint8_t _speedPercent = 100;
+    bool _rpmControl = false;
+    uint16_t _targetRPM = 0;
+    float _rpmTrim = 0.0f;  // Integral term (% duty)
 };
 
 #endif
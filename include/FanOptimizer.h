@@ -0,0 +1,97 @@
+#ifndef FAN_OPTIMIZER_H
+#define FAN_OPTIMIZER_H
+
+#include <stdint.h>
+
+// Online search for the fan speed that minimises total electrical power
+// (TEC + fans, from EnergyMeter) while the PID holds setpoint.
+//
+// More airflow lowers the heatsink temperature, so the TEC needs less current
+// for the same lift, but fan power grows with speed^3; the sum has a minimum
+// that moves with the heat load. The optimizer is a perturb-and-observe hill
+// climber: it dwells at a fan speed until the loop settles, averages total
+// power, then probes a neighbouring speed and keeps whichever is lower,
+// halving the step until it converges. The best speed per TEC duty band is
+// remembered so a load change starts from the last optimum.
+//
+// Savings are reported against the power measured at the starting (fixed
+// smart setpoint) speed of each search; a change of TEC load band restarts
+// the search, since the baseline no longer applies.
+class FanOptimizer {
+public:
+    static FanOptimizer& getInstance();
+
+    // Call every loop while the fans are in the hold-at-setpoint state; returns
+    // the fan speed (%) to apply. startPercent is the fixed smart speed the
+    // search starts from and compares against, maxPercent the upper bound.
+    float update(float temperature, float setpoint, float startPercent, float maxPercent);
+
+    // Leave the hold state (pull-down, setpoint change, sensor error)
+    void reset();
+
+    bool isActive() const { return _active; }
+    bool isConverged() const { return _state == STATE_CONVERGED; }
+    float getFanPercent() const { return _current; }
+    float getBaselineWatts() const { return _baselineWatts; }  // Power at the start speed (NAN until measured)
+    float getSavingsWatts() const;                            // Baseline - best measured (0 until known)
+    float getSavedWh() const { return static_cast<float>(_savedWh); }  // Integrated baseline - measured
+
+private:
+    FanOptimizer() = default;
+    FanOptimizer(const FanOptimizer&) = delete;
+    FanOptimizer& operator=(const FanOptimizer&) = delete;
+
+    enum State {
+        STATE_BASELINE,   // Measuring at the start speed
+        STATE_PROBE,      // Measuring at _current = _best + _direction * _step
+        STATE_REMEASURE,  // Re-measuring _best before searching again
+        STATE_CONVERGED   // Holding _best until REPROBE_MS or a load change
+    };
+
+    void moveTo(float percent, unsigned long now);
+    void startProbe(unsigned long now);
+    void finishMeasurement(float watts, unsigned long now);
+    int loadBin() const;
+
+    bool _active = false;
+    State _state = STATE_BASELINE;
+    float _maxPercent = 100.0f;
+    float _current = 100.0f;       // Speed being applied / measured
+    float _best = 100.0f;          // Lowest-power speed found so far
+    float _bestWatts = 0.0f;
+    float _step = 0.0f;
+    int _direction = -1;           // -1 = slower first (usual win at light load)
+    int _failedDirections = 0;     // Probes in a row that did not improve at this step
+
+    unsigned long _moveTime = 0;   // Last speed change, moved up when the hold window restarts
+    unsigned long _dwellStart = 0; // Last speed change, fixed
+    unsigned long _convergedTime = 0;
+    float _load = 0.0f;            // Smoothed TEC duty (0-1)
+    float _searchLoad = 0.0f;      // ...when the baseline was measured
+    double _wattSum = 0.0;
+    uint32_t _wattSamples = 0;
+
+    float _baselineWatts = 0.0f;
+    bool _haveBaseline = false;
+    double _savedWh = 0.0;
+    unsigned long _lastUpdate = 0;
+
+    // Best speed per TEC duty band (0 = unknown)
+    static constexpr int LOAD_BINS = 5;
+    float _learned[LOAD_BINS] = {};
+
+    static constexpr float MIN_FAN_PERCENT = 20.0f;     // Below this the tach/airflow is unreliable
+    static constexpr float INITIAL_STEP = 10.0f;        // % fan speed
+    static constexpr float MIN_STEP = 2.5f;
+    static constexpr float MIN_IMPROVEMENT_W = 0.2f;    // Smaller differences are noise
+    static constexpr float HOLD_BAND_C = 0.5f;          // |T - SP| while measuring
+    static constexpr float ABORT_BAND_C = 1.5f;         // Above SP: probe can't hold, revert
+    static constexpr unsigned long SETTLE_MS = 90000;   // Thermal settling after a change
+    static constexpr unsigned long MEASURE_MS = 60000;  // Power averaging window
+    static constexpr unsigned long PROBE_TIMEOUT_MS = 2 * (SETTLE_MS + MEASURE_MS);  // Probe never held a window: worse
+    static constexpr unsigned long REPROBE_MS = 900000; // Re-check a converged optimum
+    static constexpr float LOAD_TAU_S = 60.0f;          // TEC duty smoothing
+    static constexpr float LOAD_CHANGE = 0.2f;          // Duty change that restarts the search
+};
+
+#endif
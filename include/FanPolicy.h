@@ -0,0 +1,95 @@
+#ifndef FAN_POLICY_H
+#define FAN_POLICY_H
+
+#include <math.h>
+
+// Smart fan policies: map the thermal state to a fan speed (%). Policies are
+// plain C++ with no Arduino dependencies, so they also run in the host
+// simulator (sim/fan_policy_sim.cpp) for side-by-side comparison.
+
+enum FanPolicyType {
+    FAN_POLICY_HYSTERESIS = 0,  // Max above setpoint + band, smart speed at setpoint
+    FAN_POLICY_TEC_POWER = 1,   // Smart..max proportional to TEC duty
+    FAN_POLICY_TEMP_CURVE = 2,  // Smart..max linear in temperature above setpoint
+    FAN_POLICY_COUNT
+};
+
+struct FanPolicyInput {
+    unsigned long nowMs;
+    float temperature;   // °C, measured
+    float setpoint;      // °C
+    float tecPower;      // 0-1, applied TEC duty
+    float smartPercent;  // Low (at-setpoint) fan speed, %
+    float maxPercent;    // Max fan speed, %
+};
+
+struct FanPolicyOutput {
+    float percent;  // Fan speed to apply
+    bool holding;   // At the low speed holding setpoint (FanOptimizer may refine it)
+};
+
+class FanPolicy {
+public:
+    virtual ~FanPolicy() {}
+
+    virtual const char* name() const = 0;
+    virtual void reset() = 0;  // Forget state (policy switch, smart control re-enabled)
+    virtual FanPolicyOutput update(const FanPolicyInput& in) = 0;
+
+    // Shared instance for a type (out-of-range falls back to hysteresis)
+    static FanPolicy& forType(FanPolicyType type);
+};
+
+// The original smart control: run at max while more than HYSTERESIS_C above
+// setpoint or after a setpoint change until it is reached, drop to the smart
+// speed at or below setpoint, and keep the last speed in between.
+class HysteresisFanPolicy : public FanPolicy {
+public:
+    const char* name() const override { return "Hyst"; }
+    void reset() override;
+    FanPolicyOutput update(const FanPolicyInput& in) override;
+
+    static constexpr float HYSTERESIS_C = 2.78f;  // ~5°F
+
+private:
+    float _lastSetpoint = NAN;       // NAN: no change detected on the first call
+    bool _waitingForSetpoint = false;
+    bool _holding = false;
+    float _percent = -1.0f;          // Last commanded; <0 = none yet (max)
+};
+
+// Fan speed follows the TEC duty (heat being pumped), smoothed so PID
+// activity does not modulate the fans.
+class TECPowerFanPolicy : public FanPolicy {
+public:
+    const char* name() const override { return "TEC"; }
+    void reset() override { _primed = false; }
+    FanPolicyOutput update(const FanPolicyInput& in) override;
+
+    static constexpr float SMOOTHING_S = 20.0f;  // Time constant on the duty
+
+private:
+    bool _primed = false;
+    float _duty = 0.0f;
+    unsigned long _lastMs = 0;
+};
+
+// Fan speed is a linear curve of the temperature error: smart speed at or
+// below setpoint, max at CURVE_SPAN_C above it. Slew-limited to avoid audible
+// hunting around setpoint.
+class TemperatureCurveFanPolicy : public FanPolicy {
+public:
+    const char* name() const override { return "Curve"; }
+    void reset() override { _primed = false; }
+    FanPolicyOutput update(const FanPolicyInput& in) override;
+
+    static constexpr float CURVE_SPAN_C = 2.78f;        // Error for max speed
+    static constexpr float SLEW_PERCENT_PER_S = 5.0f;
+
+private:
+    bool _primed = false;
+    float _percent = 0.0f;
+    unsigned long _lastMs = 0;
+};
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef FEED_FORWARD_H
+#define FEED_FORWARD_H
+
+#include <stdint.h>
+#include "ThermalModel.h"
+
+// Static feed-forward model for TEC power, learned from steady-state points.
+//
+//   power% = bias + setpointGain * (setpoint / 10°C) + fanGain * (fan / 100%)
+//
+// The bias and setpoint terms capture the heat load (ambient leak grows as the
+// setpoint drops), the fan term the heatsink's effect on TEC efficiency. Each
+// time the loop holds setpoint at constant conditions for STEADY_TIME_MS, the
+// average total output is fed to a recursive least-squares fit with
+// forgetting, so the model follows slow ambient drift.
+//
+// Points from one operating point can't separate the three terms, so a gain
+// is only fitted once learned points differ in its regressor (setpoint by
+// MIN_SETPOINT_SPREAD_C, fan by MIN_FAN_SPREAD_PCT). Until then it is held -
+// the setpoint gain at its model seed (or 0), the fan gain at 0 - and the
+// bias absorbs the rest.
+class FeedForward {
+public:
+    void begin();  // Load the model from SettingsManager
+
+    // Use an identified plant gain as the prior for the setpoint term (only
+    // while nothing has been learned yet)
+    void seedFromModel(const FopdtModel& model);
+
+    // Feed-forward power (%) for the given operating point; 0 until learned
+    float compute(float setpoint, float fanPercent) const;
+
+    // Call every PID update while in closed loop with the total output (%)
+    void observe(float input, float setpoint, float fanPercent, float totalOutput,
+                 float minOutput, float maxOutput);
+
+    void resetSteadyState() { _steadyStart = 0; }
+    bool isLearned() const { return _samples >= MIN_SAMPLES; }
+    uint32_t getSampleCount() const { return _samples; }
+
+private:
+    void learn(float setpoint, float fanPercent, float output);
+    void noteSpread(float setpoint, float fanPercent);
+    static void regressors(float setpoint, float fanPercent, float* x);
+
+    float _coef[3] = {0.0f, 0.0f, 0.0f};  // bias, setpointGain, fanGain
+    float _P[3][3] = {{0}};               // RLS covariance
+    uint32_t _samples = 0;
+
+    // Which gains are fitted (persisted), and the spread of this session's
+    // points that decides it
+    static constexpr uint8_t VARIED_SETPOINT = 0x01;
+    static constexpr uint8_t VARIED_FAN = 0x02;
+    uint8_t _varied = 0;
+    bool _haveSpread = false;
+    float _setpointMin = 0.0f;
+    float _setpointMax = 0.0f;
+    float _fanMin = 0.0f;
+    float _fanMax = 0.0f;
+
+    // Steady-state window
+    unsigned long _steadyStart = 0;
+    float _steadySetpoint = 0.0f;
+    float _steadyFan = 0.0f;
+    float _outputSum = 0.0f;
+    uint32_t _outputCount = 0;
+
+    static constexpr uint32_t MIN_SAMPLES = 2;              // Points before the model is applied
+    static constexpr float MIN_SETPOINT_SPREAD_C = 2.0f;    // Setpoint range before its gain is fitted
+    static constexpr float MIN_FAN_SPREAD_PCT = 10.0f;      // Fan range before its gain is fitted
+    static constexpr uint32_t PERSIST_EVERY = 10;           // Save coefficients every N points
+    static constexpr unsigned long STEADY_TIME_MS = 60000;  // Hold time per learned point
+    static constexpr float STEADY_BAND_C = 0.3f;            // Max |error| while steady
+    static constexpr float FAN_CHANGE_PCT = 2.0f;           // Fan change that restarts the window
+    static constexpr float FORGETTING = 0.98f;              // RLS forgetting factor per point
+    static constexpr float P_INITIAL = 100.0f;              // Covariance for an untrained model
+    static constexpr float P_RESUMED = 10.0f;               // Covariance after reboot with a model
+};
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef FIRMWARE_STORE_H
+#define FIRMWARE_STORE_H
+
+#include <esp_partition.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// EXTIO2 firmware images in the "extfw" data partition (partitions.csv),
+// written by pack_extio2_firmware.py independently of the app.
+//
+// Layout: a 12-byte header (magic "EXFW", format, image count, window and
+// lookahead bits, CRC-32 of the entry table), 4 entries of 36 bytes (name,
+// version, offset, compressed size, size, CRC-32 of the image), then the
+// images, each compressed with heatshrink-style LZSS (tag 1 + literal byte,
+// or tag 0 + distance-1 + length-1, MSB first). Reader streams an image back
+// through a 1 KB window, so a page is decoded only when it is flashed.
+class FirmwareStore {
+public:
+    static FirmwareStore& getInstance();
+
+    static constexpr uint8_t FORMAT = 1;
+    static constexpr uint8_t WINDOW_BITS = 10;
+    static constexpr uint8_t LOOKAHEAD_BITS = 4;
+    static constexpr int MAX_IMAGES = 4;
+
+    struct Image {
+        char name[16];
+        uint8_t version;
+        uint32_t offset;          // From the start of the partition
+        uint32_t compressedSize;
+        uint32_t size;
+        uint32_t crc;             // CRC-32 of the decompressed image
+    };
+
+    // Decompresses one image sequentially
+    class Reader {
+    public:
+        explicit Reader(const Image& image);
+
+        // Next len bytes of the image; false on a read error, corrupt
+        // stream or past the end
+        bool read(uint8_t* out, size_t len);
+
+    private:
+        bool readBits(int count, uint16_t& value);
+        void emit(uint8_t value);
+
+        static constexpr size_t INPUT_CHUNK = 64;
+
+        const esp_partition_t* _partition;
+        uint32_t _inputOffset;     // Next partition offset to fetch
+        uint32_t _inputRemaining;  // Compressed bytes not yet fetched
+        uint8_t _input[INPUT_CHUNK];
+        size_t _inputLength = 0;
+        size_t _inputIndex = 0;
+        uint8_t _bitMask = 0;      // Current bit in _input[_inputIndex], 0 = fetch next byte
+
+        uint32_t _outputRemaining;
+        uint32_t _produced = 0;
+        uint8_t _history[1 << WINDOW_BITS];  // Last 1 KB of output
+        uint16_t _head = 0;
+        uint16_t _copyDistance = 0;
+        uint16_t _copyRemaining = 0;
+    };
+
+    // Find the partition and load the manifest; false if it is missing or
+    // corrupt (flashing from the store is then unavailable)
+    bool begin();
+    bool isAvailable() const { return _partition != nullptr; }
+
+    const Image* find(const char* name) const;
+
+    // Decompress the whole image once and check its CRC, before anything is
+    // erased on the EXTIO2
+    bool verify(const Image& image) const;
+
+private:
+    FirmwareStore() = default;
+    FirmwareStore(const FirmwareStore&) = delete;
+    FirmwareStore& operator=(const FirmwareStore&) = delete;
+
+    const esp_partition_t* _partition = nullptr;
+    Image _images[MAX_IMAGES];
+    int _imageCount = 0;
+};
+
+#endif
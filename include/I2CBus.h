@@ -0,0 +1,87 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdint.h>
+
+// Owner of the Port A I2C clock (EXTIO2 link).
+//
+// The bus starts in standard mode (100 kHz) for the scan and the EXTIO2
+// handshake; negotiate() then probes Fast-mode Plus (1 MHz) and Fast-mode
+// (400 kHz) with repeated register reads and keeps the fastest clean one.
+// PCA9554 reports every transaction outcome; a burst of errors steps the
+// clock down one level, and after a clean interval the next faster level is
+// retried (with doubling back-off if it fails again). Per-clock transaction
+// and error counts are logged periodically.
+class I2CBus {
+public:
+    static I2CBus& getInstance();
+
+    void begin(int sda, int scl);
+    void update();  // Call every loop: stats log, step-up retry
+
+    // Probe clocks from fastest to slowest by reading reg from addr; returns
+    // the chosen clock (Hz). Standard mode is always accepted.
+    uint32_t negotiate(uint8_t addr, uint8_t reg);
+
+    // Transaction outcomes (from PCA9554)
+    void recordSuccess();
+    void recordError();
+
+    // Bus clear (I2C spec 3.1.16): release the controller, clock SCL until a
+    // slave stuck mid-byte lets go of SDA, issue a STOP and restart Wire at
+    // the current clock. Returns true if SDA is released. Takes ~100 us.
+    bool recover();
+
+    // Force 100 kHz while talking to devices that were not negotiated (the
+    // EXTIO2 bootloader during flashing); false restores the negotiated clock
+    void holdStandardMode(bool hold);
+
+    uint32_t getClock() const { return clockHz(_level); }
+
+    struct ClockStats {
+        uint32_t transactions;
+        uint32_t errors;
+        unsigned long activeMs;  // Time spent at this clock
+    };
+    static constexpr int CLOCK_COUNT = 3;
+    static uint32_t clockHz(int level);  // 0 = fastest
+    ClockStats getStats(int level) const;
+
+private:
+    I2CBus() = default;
+    I2CBus(const I2CBus&) = delete;
+    I2CBus& operator=(const I2CBus&) = delete;
+
+    void setLevel(int level);
+    void logStats();
+
+    int _sda = -1;
+    int _scl = -1;
+    int _level = CLOCK_COUNT - 1;  // Current clock (standard mode until negotiated)
+    int _fastestLevel = CLOCK_COUNT - 1;  // Best level the probe accepted
+    bool _held = false;
+    int _levelBeforeHold = CLOCK_COUNT - 1;
+
+    ClockStats _stats[CLOCK_COUNT] = {};
+    unsigned long _levelSince = 0;
+    unsigned long _lastStatsLog = 0;
+
+    // Error burst detection: BURST_ERRORS errors within BURST_WINDOW_MS
+    static constexpr int BURST_ERRORS = 3;
+    unsigned long _errorTimes[BURST_ERRORS] = {};
+    int _errorIndex = 0;
+    uint32_t _errorsSeen = 0;
+
+    unsigned long _lastStepDown = 0;
+    unsigned long _lastStepUp = 0;  // 0 = not on probation after a step up
+    unsigned long _stepUpDelayMs = STEP_UP_INITIAL_MS;
+
+    static constexpr int BUS_CLEAR_PULSES = 9;  // One byte + ACK
+    static constexpr unsigned long BURST_WINDOW_MS = 2000;
+    static constexpr int PROBE_READS = 32;                        // Clean reads required per clock
+    static constexpr unsigned long STEP_UP_INITIAL_MS = 600000;   // 10 min clean before retrying faster
+    static constexpr unsigned long STEP_UP_MAX_MS = 14400000;     // Back-off cap (4 h)
+    static constexpr unsigned long STATS_INTERVAL_MS = 300000;    // Stats log every 5 min
+};
+
+#endif
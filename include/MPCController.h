@@ -0,0 +1,79 @@
+#ifndef MPC_CONTROLLER_H
+#define MPC_CONTROLLER_H
+
+#include <stdint.h>
+#include "ThermalModel.h"
+
+// Small-horizon model-predictive controller for the TEC, built on the
+// identified FOPDT model discretised at a step of about tau / HORIZON:
+//
+//   T[k+1] = a * T[k] + b * u[k - d] + c
+//
+// c is an offset (heat load) estimated from the prediction error each step,
+// which gives offset-free tracking without an integrator. Each step the
+// controller chooses MOVES power levels (the last is held to the end of the
+// horizon) minimising the squared tracking error over HORIZON steps after the
+// dead time plus a penalty on power changes, subject to:
+//   - power limits (PID min/max output),
+//   - a slew limit in %/s (also applied between steps, so the TEC ramps
+//     identically at any loop rate),
+//   - a fan-coupled power cap: a slow heatsink fan can't reject full TEC
+//     power, so the maximum is reduced at low fan speeds.
+// The QP is solved with Hildreth's dual method on fixed-size arrays; all
+// model-dependent matrices are computed once in configure().
+class MPCController {
+public:
+    bool configure(const FopdtModel& model);  // False if the model is unusable
+    bool isConfigured() const { return _configured; }
+
+    // Start from the currently applied output (%) so enabling MPC is bumpless
+    void reset(float output);
+
+    // Call every loop; returns the TEC power (%) to apply
+    float update(float temperature, float setpoint, float fanPercent,
+                 float minOutput, float maxOutput, float slewPerSecond);
+
+    float getPrediction() const { return _prediction; }  // Temperature at the end of the horizon
+    float getDisturbance() const { return _c; }          // Estimated offset per step (°C)
+    unsigned long getStepMs() const { return _stepMs; }
+
+private:
+    static constexpr int HORIZON = 12;    // Prediction steps after the dead time
+    static constexpr int MOVES = 3;       // Free power levels (move blocking)
+    static constexpr int CONSTRAINTS = 4 * MOVES;
+    static constexpr int MAX_DELAY = 40;  // Dead time in steps
+
+    void solve(float temperature, float setpoint, float minOutput, float maxOutput, float slew);
+    static bool invert(float m[MOVES][MOVES], float inv[MOVES][MOVES]);
+
+    bool _configured = false;
+    float _a = 0.0f;
+    float _b = 0.0f;
+    int _delay = 0;
+    unsigned long _stepMs = 1000;
+
+    // Model-dependent QP terms
+    float _G[HORIZON][MOVES];           // Forced response to each move
+    float _Einv[MOVES][MOVES];          // Inverse Hessian
+    float _Hd[CONSTRAINTS][CONSTRAINTS];  // Dual Hessian A * Einv * A'
+    float _rho = 0.0f;                  // Move penalty
+
+    // Runtime state
+    float _uPast[MAX_DELAY + 1];        // [0] = last step's output, [j] = j steps earlier
+    float _u = 0.0f;                    // Power chosen for the current step (%)
+    float _applied = 0.0f;              // Slew-limited output (%)
+    float _c = 0.0f;
+    float _lastT = 0.0f;
+    bool _primed = false;
+    unsigned long _lastStep = 0;
+    unsigned long _lastApply = 0;
+    float _prediction = 0.0f;
+
+    static constexpr float MOVE_WEIGHT = 0.5f;         // Move penalty relative to K^2
+    static constexpr float DISTURBANCE_GAIN = 0.3f;    // Offset observer gain per step
+    static constexpr float FAN_MIN_POWER = 0.3f;       // Power cap fraction with the fan stopped
+    static constexpr float FAN_FULL_POWER_PCT = 60.0f;  // Fan speed allowing full power
+    static constexpr int SOLVER_ITERATIONS = 40;
+};
+
+#endif
@@ -26,18 +26,40 @@ public:
     // PWM mode (firmware v3+)
     void setPWMPinMode(uint8_t pin);
     void setPWMFrequency(uint8_t freqMode);  // 0=2kHz, 1=1kHz, 2=500Hz, 3=250Hz, 4=125Hz, 5=25kHz
+    uint8_t readPWMFrequency();              // Mode the firmware latched (0xFF on error)
+
+    static constexpr uint8_t PWM_FREQ_1KHZ = 1;
+    static constexpr uint8_t PWM_FREQ_25KHZ = 5;
+    // First custom firmware generating mode 5 from a hardware timer; older
+    // builds bit-bang PWM and starve I2C at 25 kHz. A reconnect restores
+    // mode 5 only to firmware at least this new, 1 kHz otherwise.
+    static constexpr uint8_t HW_PWM_FIRMWARE_VERSION = 6;
     void setPWMDutyCycle(uint8_t pin, uint8_t percent);  // 0-100
 
     // FAN_RPM mode (custom firmware v5+)
     void setFanRPMPinMode(uint8_t pin);
     uint16_t readFanRPM(uint8_t pin);  // Returns RPM value (0 if not available)
+    // Burst-read consecutive tach pins in one transaction; false on I2C error
+    bool readFanRPMs(uint8_t firstPin, uint8_t count, uint16_t* rpm);
 
     // Get current output state (for debugging)
     uint8_t getOutputState() const { return _outputState; }
 
-    // Error handling
+    // Firmware version read at begin() (0 if unknown)
+    uint8_t getFirmwareVersion() const { return _firmwareVersion; }
+
+    // Error handling. Pin modes, outputs and PWM settings are shadowed (also
+    // while offline), and after a reconnect they are re-applied one register
+    // per update() before isOnline() turns true again.
     bool isOnline() const { return _online; }
-    void tryReconnect();  // Call periodically to attempt reconnection
+    void update();  // Call every loop: non-blocking reconnection while offline
+    uint32_t getReconnectCount() const { return _reconnects; }  // Changes after each recovery
+
+    // Hand the bus to another user (EXTIO2Flasher): offline with no I2C
+    // traffic and no reconnect attempts; setters only update the shadows.
+    // resume() reconnects immediately and re-applies everything.
+    void suspend();
+    void resume();
 
 private:
     PCA9554() = default;
@@ -47,20 +69,47 @@ private:
     void recordError();
     void recordSuccess();
 
+    // Reconnection
+    enum ReconnectState {
+        RECONNECT_IDLE,     // Online
+        RECONNECT_WAIT,     // Backing off before the next bus clear + probe
+        RECONNECT_RESTORE,  // Responding; re-applying shadowed registers
+        RECONNECT_SUSPENDED // Bus lent out by suspend()
+    };
+    bool deferWhileOffline();  // true (and marks the shadow dirty) while offline
+    void goOffline();
+    void attemptReconnect(unsigned long now);
+    bool restoreNext();  // Write the next shadowed register; false on I2C error
+    bool writeRegister(uint8_t reg, uint8_t value);  // Raw write, no error accounting
+
     M5_EXTIO2 _extio;
-    uint8_t _outputState = 0xFF;  // Track output state for debugging
+    uint8_t _outputState = 0xFF;  // Output levels (shadow, also for debugging)
+    uint8_t _firmwareVersion = 0;
+
+    // Register shadows for restore
+    static constexpr uint8_t MODE_UNSET = 0xFF;
+    uint8_t _pinMode[8];          // Mode register values (MODE_UNSET = never set)
+    uint8_t _pwmDuty[8] = {};
+    uint8_t _pwmFreq = MODE_UNSET;
 
     // Error tracking
     bool _online = true;
     uint8_t _errorCount = 0;
-    unsigned long _lastRetryTime = 0;
+    ReconnectState _reconnectState = RECONNECT_IDLE;
+    unsigned long _nextAttempt = 0;
+    unsigned long _backoffMs = 0;
+    uint8_t _restoreIndex = 0;
+    bool _shadowDirty = false;  // Shadow changed since the restore started
+    uint32_t _reconnects = 0;
 
     // EXTIO2 I2C configuration
     static constexpr uint8_t I2C_ADDR = 0x45;  // Default EXTIO2 address
+    static constexpr uint8_t REG_VERSION = 0xFE;  // Firmware version register
 
     // Error thresholds
     static constexpr uint8_t MAX_ERRORS = 5;
-    static constexpr unsigned long RETRY_INTERVAL_MS = 5000;
+    static constexpr unsigned long BACKOFF_MIN_MS = 250;    // First retry after going offline
+    static constexpr unsigned long BACKOFF_MAX_MS = 30000;  // Doubling cap
 };
 
 #endif
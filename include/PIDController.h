@@ -3,6 +3,10 @@
 
 #include <QuickPID.h>
 #include "SettingsManager.h"  // For PIDMode enum
+#include "FeedForward.h"
+#include "StepIdentifier.h"
+#include "PlantEstimator.h"
+#include "MPCController.h"
 
 class PIDController {
 public:
@@ -11,8 +15,17 @@ public:
     void begin();
     void update(float currentTemp, float setpoint);  // Call every loop
 
-    // Get computed output (0.0 to 1.0)
-    float getOutput() const { return _output / 100.0f; }
+    // Get computed output (0.0 to 1.0): PID plus feed-forward, within the output limits
+    float getOutput() const;
+
+    // Feed-forward contribution (%) currently added to the PID output
+    float getFeedForward() const { return _feedForward; }
+    const FeedForward& getFeedForwardModel() const { return _ff; }
+
+    // True while PID_ON is served by the model-predictive controller
+    // (MPC enabled and a model identified); the MPC applies its own slew limit
+    bool isModelPredictive() const { return _mpcActive; }
+    const MPCController& getMPC() const { return _mpc; }
 
     // Mode control
     void setMode(PIDMode mode, bool saveToEeprom = false);
@@ -29,20 +42,58 @@ public:
     float getMinOutput() const { return _minOutput; }
     float getMaxOutput() const { return _maxOutput; }
 
+    // Gain scheduling: true while the applied gains come from the schedule table
+    bool isGainScheduled() const { return _scheduled; }
+    float getAppliedKp() const { return _appliedKp; }
+    float getAppliedKi() const { return _appliedKi; }
+    float getAppliedKd() const { return _appliedKd; }
+
+    // Reload gains and limits from SettingsManager (e.g. after a profile switch).
+    // The integral is re-seeded from the current output so there is no bump.
+    void applySettings();
+
     // Auto-tune status
     bool isAutoTuning() const { return _autoTuning; }
     bool isAutoTuneCooling() const { return _autoTuneHigh; }  // True when outputting max (cooling)
     bool checkAndClearAutoTuneComplete();  // Returns true once when auto-tune completes
-    int getAutoTuneCycle() const { return _autoTuneCycles / 2; }  // Full cycles (not half-cycles)
+    int getAutoTuneCycle() const { return _autoTuneCycles; }  // Completed full cycles
+    int getAutoTuneMaxCycles() const { return AUTOTUNE_MAX_CYCLES; }
+    float getAutoTuneConfidence() const { return _autoTuneConfidence; }  // 0..1, stops at convergence
     void startAutoTune();
     void stopAutoTune();
 
+    // Step-response identification (alternative to the relay auto-tune; also
+    // reported through isAutoTuning()/checkAndClearAutoTuneComplete())
+    void startIdentification();
+    bool isIdentifying() const { return _autoTuning && _identifying; }
+    const StepIdentifier& getIdentifier() const { return _identifier; }
+
+    // Online plant estimate from closed-loop data; drifted when the gain or
+    // time constant moved more than the configured threshold from the model
+    // the tunings are based on
+    const PlantEstimator& getPlantEstimator() const { return _estimator; }
+    bool isPlantDrifted() const { return _plantDrifted; }
+
 private:
     PIDController() = default;
     PIDController(const PIDController&) = delete;
     PIDController& operator=(const PIDController&) = delete;
 
     void runAutoTune();
+    void runIdentification();
+    void recordAutoTuneCycle(unsigned long periodMs, unsigned long highMs, unsigned long lowMs);
+    void finishAutoTune(float kp, float ki, float kd);
+    void updateFeedForward(float currentTemp);
+    void checkPlantDrift();
+    void selectController(bool mpc, float currentTemp);
+    void adaptToEstimate();
+    void applyOutputLimits();
+    // Error as QuickPID's pOnError term sees it (reverse action): P = Kp * this
+    float proportionalError() const { return _input - _setpoint; }
+    void applyGainSchedule(float currentTemp, float setpoint);
+    void loadTunings(float kp, float ki, float kd);  // Into QuickPID, bumpless
+    bool scheduledTunings(float x, float& kp, float& ki, float& kd) const;
+    void storeScheduleEntry(float temperature, float kp, float ki, float kd);
 
     // PID variables (QuickPID uses floats)
     float _input = 0.0f;
@@ -54,30 +105,70 @@ private:
     float _ki = 0.1f;
     float _kd = 1.0f;
 
+    // Gains currently loaded into QuickPID (scheduled or the base gains above)
+    float _appliedKp = 2.0f;
+    float _appliedKi = 0.1f;
+    float _appliedKd = 1.0f;
+    bool _scheduled = false;
+
     // Output limits (percentage)
     float _minOutput = 0.0f;
     float _maxOutput = 100.0f;
 
     PIDMode _mode = PID_OFF;
 
+    // Feed-forward: QuickPID runs within [min - ff, max - ff] so the sum stays in limits
+    FeedForward _ff;
+    float _feedForward = 0.0f;
+    float _ffSetpoint = 0.0f;  // Operating point _feedForward was computed for
+    float _ffFan = 0.0f;
+    bool _ffTracking = false;  // False while off or under MPC: the next term starts fresh
+
+    // Auto-tune limits
+    static constexpr int AUTOTUNE_WINDOW = 3;               // Estimates compared for convergence
+    static constexpr int AUTOTUNE_MAX_CYCLES = 8;
+    static constexpr float AUTOTUNE_SPREAD = 0.05f;         // Converged when Ku/Tu agree within 5%
+    static constexpr float AUTOTUNE_MAX_ASYMMETRY = 0.15f;  // ...and half-periods within 15%
+    static constexpr unsigned long AUTOTUNE_TIMEOUT_MS = 600000;
+
     // Auto-tune state
     bool _autoTuning = false;
     bool _autoTuneComplete = false;
     unsigned long _autoTuneStart = 0;
-    float _autoTuneOutput = 0.0f;
-    bool _autoTuneHigh = true;
+    bool _autoTuneHigh = true;              // Relay state: true = cooling (high output)
+    float _autoTuneBias = 50.0f;            // Relay centre (%), adapted for asymmetry
+    float _autoTuneAmplitude = 50.0f;       // Relay half-swing (%)
+    float _autoTuneNoiseBand = 0.15f;       // Relay hysteresis (°C)
     float _autoTunePeakHigh = -1000.0f;
     float _autoTunePeakLow = 1000.0f;
-    int _autoTuneCycles = 0;
-    unsigned long _autoTuneLastCross = 0;
-    float _autoTunePeriodSum = 0.0f;
-    float _autoTuneAmplitudeSum = 0.0f;
+    unsigned long _autoTuneCycleStart = 0;  // Start of the current full cycle (0 = not synced yet)
+    unsigned long _autoTuneLastSwitch = 0;
+    unsigned long _autoTuneHighTime = 0;    // Duration of the last cooling half-cycle
+    int _autoTuneCycles = 0;                // Completed full cycles
+    float _autoTuneKu[AUTOTUNE_WINDOW] = {0};  // Ring of the latest estimates
+    float _autoTuneTu[AUTOTUNE_WINDOW] = {0};
+    float _autoTuneConfidence = 0.0f;
     float _savedSetpoint = 0.0f;  // Original setpoint to restore after auto-tune
 
+    // Step identification state
+    StepIdentifier _identifier;
+    bool _identifying = false;
+
+    // Model-predictive control (alternative to QuickPID in PID_ON)
+    MPCController _mpc;
+    bool _mpcActive = false;
+
+    // Online plant estimation
+    PlantEstimator _estimator;
+    bool _plantDrifted = false;
+    unsigned long _lastAdapt = 0;
+
     QuickPID* _pid = nullptr;
 
     static constexpr int SAMPLE_TIME_MS = 500;
-    static constexpr int AUTOTUNE_CYCLES = 5;
+    static constexpr float SCHEDULE_MERGE_BAND_C = 2.5f;  // Auto-tune replaces a point this close
+    static constexpr float MODEL_LAMBDA_FACTOR = 0.5f;    // IMC closed-loop time = 0.5 * plant time constant
+    static constexpr unsigned long ADAPT_MIN_INTERVAL_MS = 1800000;  // At most one automatic re-tune per 30 min
 
     // Debug mode: set to true for quick fake auto-tune (3 seconds instead of full run)
     static constexpr bool DEBUG_FAKE_AUTOTUNE = false;
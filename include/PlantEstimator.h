@@ -0,0 +1,62 @@
+#ifndef PLANT_ESTIMATOR_H
+#define PLANT_ESTIMATOR_H
+
+#include <stdint.h>
+#include "ThermalModel.h"
+
+// Background recursive-least-squares estimate of the FOPDT plant from normal
+// closed-loop data (TEC power vs. temperature), sampled at 1 Hz:
+//
+//   T[k+1] = a * T[k] + b * u[k - d] + c
+//
+// d is the dead time of the reference model (rounded to samples), c absorbs
+// the ambient/heat-load offset. Gain and time constant follow from a and b:
+// K = b / (1 - a), tau = -Ts / ln(a). Drift is the larger relative change of
+// K or tau against the reference model, low-pass filtered so a single
+// disturbance doesn't trip it.
+class PlantEstimator {
+public:
+    void begin(const FopdtModel& reference);
+    void setReference(const FopdtModel& reference);
+
+    void update(float temperature, float output);  // Call every closed-loop PID update
+    void pause() { _haveLast = false; _uCount = 0; }  // Break the data series (open-loop tests, mode changes)
+
+    bool hasEstimate() const;
+    FopdtModel getEstimate() const;
+    const FopdtModel& getReference() const { return _reference; }
+    float getDrift() const { return _drift; }  // Relative, 0.3 = 30%
+    uint32_t getUpdateCount() const { return _updates; }
+
+private:
+    void resetCovariance();
+
+    FopdtModel _reference = {0.0f, 0.0f, 0.0f, false};
+    int _delay = DEFAULT_DELAY_S;
+
+    float _theta[3] = {0.9f, 0.0f, 0.0f};  // a, b, c
+    float _P[3][3] = {{0}};
+    uint32_t _updates = 0;
+
+    // Output history for the dead time
+    static constexpr int MAX_DELAY = 120;
+    float _uHistory[MAX_DELAY];
+    int _uHead = 0;
+    int _uCount = 0;
+
+    float _lastT = 0.0f;
+    bool _haveLast = false;
+    unsigned long _lastSample = 0;
+    float _drift = 0.0f;
+
+    static constexpr unsigned long SAMPLE_MS = 1000;
+    static constexpr int DEFAULT_DELAY_S = 5;            // Until a model has been identified
+    static constexpr uint32_t MIN_UPDATES = 600;         // 10 minutes of data before trusting it
+    static constexpr float FORGETTING = 0.999f;          // ~17 minute memory
+    static constexpr float P_INITIAL = 1000.0f;
+    static constexpr float P_MAX_TRACE = 3000.0f;        // Bound covariance windup in quiet periods
+    static constexpr float DRIFT_FILTER = 0.01f;         // EMA weight per sample (~100 s)
+    static constexpr float MIN_REFERENCE_GAIN = 1e-4f;   // °C per %, smaller is no usable model
+};
+
+#endif
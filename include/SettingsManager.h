@@ -2,6 +2,10 @@
 #define SETTINGS_MANAGER_H
 
 #include <stdint.h>
+#include <Preferences.h>
+#include "SettingsSchema.h"
+#include "ThermalModel.h"
+#include "FanPolicy.h"
 
 enum TempUnit {
     CELSIUS,
@@ -14,14 +18,43 @@ enum PIDMode {
     PID_AUTOTUNE = 2
 };
 
+// Variable the gain schedule is indexed by
+enum GainScheduleSource {
+    GS_SOURCE_SETPOINT = 0,
+    GS_SOURCE_MEASURED = 1
+};
+
+enum TECRampProfile {
+    RAMP_LINEAR = 0,
+    RAMP_S_CURVE = 1    // Eased start and stop, same peak slope as linear
+};
+
+struct GainSchedulePoint {
+    float temperature;  // °C
+    float kp;
+    float ki;
+    float kd;
+};
+
 class SettingsManager {
 public:
     static SettingsManager& getInstance();
 
     void begin();
-    void save();
+    void update();  // Call in loop() - commits deferred saves after a quiet period
+    void save();    // Request a deferred commit (batched with other changes)
+    void flush();   // Commit any pending or unsaved change now (before flashing/reboot)
     void load();
 
+    // Persistence diagnostics
+    uint32_t getGeneration() const { return _generation; }
+    bool isDirty() const { return _dirtyFields != 0 || _profilesDirty; }
+    bool isSavePending() const { return _savePending; }
+    uint32_t getSaveRequestCount() const { return _saveRequests; }
+    uint32_t getCommitCount() const { return _commitCount; }
+    // The first-boot commit in load() has no save() behind it
+    uint32_t getCommitsAvoided() const { return _saveRequests > _commitCount ? _saveRequests - _commitCount : 0; }
+
     TempUnit getTempUnit() const;
     void setTempUnit(TempUnit unit);
     void toggleTempUnit();
@@ -40,6 +73,20 @@ public:
     float getSmartSetpoint() const;
     void setSmartSetpoint(float percent);
 
+    // Closed-loop fan RPM: fan percentages become a fraction of the max RPM
+    bool getFanRPMMode() const;
+    void setFanRPMMode(bool enabled);
+    float getFanMaxRPM() const;
+    void setFanMaxRPM(float rpm);
+
+    // Energy-optimal fan speed at setpoint (smart control)
+    bool getFanOptimizeEnabled() const;
+    void setFanOptimizeEnabled(bool enabled);
+
+    // Smart fan policy
+    FanPolicyType getFanPolicy() const;
+    void setFanPolicy(FanPolicyType policy);
+
     // PID settings
     PIDMode getPIDMode() const;
     void setPIDMode(PIDMode mode, bool saveNow = true);
@@ -51,6 +98,72 @@ public:
     float getPIDMaxOutput() const;
     void setPIDOutputLimits(float min, float max, bool saveNow = true);
 
+    // Auto-tune relay hysteresis (°C); should exceed the sensor noise
+    float getAutoTuneNoiseBand() const;
+    void setAutoTuneNoiseBand(float celsius);
+
+    // Identified plant model (step-response identification)
+    FopdtModel getThermalModel() const;
+    void setThermalModel(const FopdtModel& model, bool saveNow = true);
+
+    // Online plant estimation: drift threshold (relative change of gain or
+    // time constant) and whether to re-derive the PID gains automatically
+    bool getAdaptiveTuningEnabled() const;
+    void setAdaptiveTuningEnabled(bool enabled);
+    float getPlantDriftThreshold() const;
+    void setPlantDriftThreshold(float fraction);
+
+    // Model-predictive control (used instead of the PID when a model exists)
+    bool getMPCEnabled() const;
+    void setMPCEnabled(bool enabled);
+    float getMPCSlewRate() const;  // % per second
+    void setMPCSlewRate(float percentPerSecond);
+
+    // TEC soft-start ramp
+    float getTECRampRate() const;  // % per second
+    void setTECRampRate(float percentPerSecond);
+    TECRampProfile getTECRampProfile() const;
+    void setTECRampProfile(TECRampProfile profile);
+    bool getTECHardwareFade() const;
+    void setTECHardwareFade(bool enabled);
+
+    // Energy metering
+    float getSupplyVoltage() const;
+    void setSupplyVoltage(float volts);
+    float getFanRatedPower() const;  // W, both fans at 100%
+    void setFanRatedPower(float watts);
+    float getAmbientTemperature() const;  // °C
+    void setAmbientTemperature(float celsius);
+    void getEnergyCounters(float& lifetimeWh, float& sessionWh, float& previousSessionWh) const;
+    void setEnergyCounters(float lifetimeWh, float sessionWh, float previousSessionWh);
+
+    // Gain schedule (global, shared by all profiles)
+    bool getGainScheduleEnabled() const;
+    void setGainScheduleEnabled(bool enabled);
+    GainScheduleSource getGainScheduleSource() const;
+    void setGainScheduleSource(GainScheduleSource source);
+    bool getGainSchedulePoint(uint8_t index, GainSchedulePoint& point) const;  // Returns true if populated
+    void setGainSchedulePoint(uint8_t index, const GainSchedulePoint& point, bool saveNow = true);
+    void clearGainSchedulePoint(uint8_t index);
+    uint8_t getGainSchedulePointCount() const;  // Number of populated points
+
+    // Feed-forward model: power% = bias + setpointGain * (SP / 10°C) + fanGain * (fan / 100%)
+    bool getFeedForwardEnabled() const;
+    void setFeedForwardEnabled(bool enabled);
+    // 'varied' flags the gains whose regressor has varied enough to be fitted
+    void getFeedForwardModel(float& bias, float& setpointGain, float& fanGain, uint32_t& samples,
+                             uint8_t& varied) const;
+    void setFeedForwardModel(float bias, float setpointGain, float fanGain, uint32_t samples, uint8_t varied,
+                             bool saveNow = true);
+
+    // Profiles: setpoint, PID gains/limits, fan speed and smart setpoint are
+    // stored per profile; the getters/setters above act on the active one
+    uint8_t getProfileCount() const { return SETTINGS_PROFILE_COUNT; }
+    uint8_t getActiveProfile() const;
+    const char* getProfileName(uint8_t index) const;
+    void setProfileName(uint8_t index, const char* name);
+    bool selectProfile(uint8_t index);  // Returns false if index is invalid or already active
+
     // Temperature conversion helpers
     float toDisplayUnit(float celsius) const;
     float celsiusToFahrenheit(float celsius) const;
@@ -59,40 +172,57 @@ public:
     const char* getUnitSymbol() const;
 
 private:
-    SettingsManager() = default;
+    struct Profile {
+        char name[SETTINGS_PROFILE_NAME_LEN];
+        float values[PROFILE_FIELD_COUNT];  // Indexed like PROFILE_FIELDS
+    };
+
+    SettingsManager() { loadDefaults(); initProfiles(_values, _profiles); }
     SettingsManager(const SettingsManager&) = delete;
     SettingsManager& operator=(const SettingsManager&) = delete;
 
-    TempUnit _tempUnit = CELSIUS;
-    float _setpoint = 0.0f;  // Stored in Celsius
-    float _fanSpeed = 100.0f;  // Fan speed 0-100%
-    bool _smartControlEnabled = false;
-    float _smartSetpoint = 50.0f;  // Smart control setpoint 0-100%
-
-    // PID settings
-    PIDMode _pidMode = PID_OFF;
-    float _pidKp = 0.0f;
-    float _pidKi = 0.55f;
-    float _pidKd = 2.60f;
-    float _pidMinOutput = 0.0f;
-    float _pidMaxOutput = 100.0f;
-
-    static constexpr int EEPROM_SIZE = 64;
-    static constexpr int EEPROM_ADDR_TEMP_UNIT = 0;
-    static constexpr int EEPROM_ADDR_SETPOINT = 1;   // 4 bytes for float
-    static constexpr int EEPROM_ADDR_PID_MODE = 5;   // 1 byte
-    static constexpr int EEPROM_ADDR_PID_KP = 6;     // 4 bytes
-    static constexpr int EEPROM_ADDR_PID_KI = 10;    // 4 bytes
-    static constexpr int EEPROM_ADDR_PID_KD = 14;    // 4 bytes
-    static constexpr int EEPROM_ADDR_PID_MIN = 18;   // 4 bytes
-    static constexpr int EEPROM_ADDR_PID_MAX = 22;   // 4 bytes
-    static constexpr int EEPROM_ADDR_FAN_SPEED = 26;        // 4 bytes
-    static constexpr int EEPROM_ADDR_SMART_ENABLED = 30;   // 1 byte
-    static constexpr int EEPROM_ADDR_SMART_SETPOINT = 31;  // 4 bytes
-
-    static constexpr float DEFAULT_SETPOINT = 0.0f;  // 0°C = 32°F
-    static constexpr float DEFAULT_FAN_SPEED = 100.0f;
-    static constexpr float DEFAULT_SMART_SETPOINT = 50.0f;
+    // Generic field access (validated against the schema bounds)
+    float getValue(SettingsFieldId id) const { return _values[id]; }
+    bool setValue(SettingsFieldId id, float value);  // Returns true if the value changed
+
+    void commit();
+    void loadDefaults();
+    void storeActiveProfile();
+    bool readSlot(uint8_t slot, float* values, Profile* profiles, uint32_t& generation);
+    bool loadLegacyEeprom(float* values);
+    static void decodePayload(const uint8_t* payload, uint16_t size, float* values);
+    static void encodePayload(const float* values, uint8_t* payload);
+    static void decodeLegacy(const uint8_t* image, const LegacyFieldDef* layout, int count, float* values);
+    static bool decodeProfiles(const uint8_t* block, uint16_t size, Profile* profiles);
+    static void encodeProfiles(const Profile* profiles, uint8_t* block);
+    static void initProfiles(const float* values, Profile* profiles);
+    static void sanitize(float* values);
+    static void sanitizeProfiles(Profile* profiles);
+
+    // Current values, indexed by SettingsFieldId
+    float _values[SETTING_COUNT];
+    Profile _profiles[SETTINGS_PROFILE_COUNT];
+
+    // Persistence state
+    Preferences _prefs;
+    uint64_t _dirtyFields = 0;  // One bit per SettingsFieldId
+    bool _profilesDirty = false;
+    uint32_t _generation = 0;   // Generation of the last committed record
+    uint8_t _activeSlot = 1;    // Slot holding the newest record (next write goes to the other)
+
+    // Write-behind state and metrics
+    bool _savePending = false;
+    unsigned long _firstSaveRequest = 0;
+    unsigned long _lastSaveRequest = 0;
+    uint32_t _saveRequests = 0;
+    uint32_t _commitCount = 0;
+
+    static constexpr unsigned long SAVE_QUIET_MS = 2000;       // Commit after 2s without changes
+    static constexpr unsigned long SAVE_MAX_DELAY_MS = 10000;  // ...or at most 10s after the first request
+
+    static constexpr const char* NVS_NAMESPACE = "settings";
+    static constexpr uint32_t RECORD_MAGIC = 0x53434F4C;  // "SCOL"
+    static constexpr uint16_t RECORD_VERSION = 3;         // v3: schema-driven payload + profile block
 };
 
 #endif
@@ -0,0 +1,280 @@
+#ifndef SETTINGS_SCHEMA_H
+#define SETTINGS_SCHEMA_H
+
+#include <stdint.h>
+
+// Declarative description of every persisted setting.
+//
+// The record payload is the fields below packed in table order; offsets are
+// computed at compile time from the field types, so adding a setting means
+// appending one entry here (and its id to SettingsFieldId). Never reorder or
+// remove entries: records written by older firmware are decoded with the same
+// table, and fields beyond the stored payload size fall back to defaults.
+
+enum SettingsFieldType : uint8_t {
+    FIELD_U8,     // 1 byte (enums, booleans)
+    FIELD_FLOAT   // 4 bytes, little-endian IEEE 754
+};
+
+struct SettingsFieldDef {
+    const char* name;
+    SettingsFieldType type;
+    float minValue;
+    float maxValue;
+    float defaultValue;
+};
+
+// Gain schedule: up to GAIN_SCHEDULE_POINTS tuning points, each stored as
+// GAIN_SCHEDULE_PARAMS consecutive fields {temperature, Kp, Ki, Kd}
+constexpr uint8_t GAIN_SCHEDULE_POINTS = 5;
+constexpr uint8_t GAIN_SCHEDULE_PARAMS = 4;
+
+enum SettingsFieldId : uint8_t {
+    SETTING_TEMP_UNIT,
+    SETTING_SETPOINT,
+    SETTING_PID_MODE,
+    SETTING_PID_KP,
+    SETTING_PID_KI,
+    SETTING_PID_KD,
+    SETTING_PID_MIN,
+    SETTING_PID_MAX,
+    SETTING_FAN_SPEED,
+    SETTING_SMART_ENABLED,
+    SETTING_SMART_SETPOINT,
+    SETTING_ACTIVE_PROFILE,
+    SETTING_GS_ENABLED,
+    SETTING_GS_SOURCE,
+    SETTING_GS_VALID_MASK,
+    SETTING_GS_POINTS,
+    SETTING_GS_POINTS_LAST = SETTING_GS_POINTS + GAIN_SCHEDULE_POINTS * GAIN_SCHEDULE_PARAMS - 1,
+    SETTING_FF_ENABLED,
+    SETTING_FF_BIAS,
+    SETTING_FF_SETPOINT_GAIN,
+    SETTING_FF_FAN_GAIN,
+    SETTING_FF_SAMPLES,
+    SETTING_AT_NOISE_BAND,
+    SETTING_MODEL_VALID,
+    SETTING_MODEL_GAIN,
+    SETTING_MODEL_TAU,
+    SETTING_MODEL_DEAD_TIME,
+    SETTING_ADAPT_AUTO,
+    SETTING_ADAPT_DRIFT,
+    SETTING_MPC_ENABLED,
+    SETTING_MPC_SLEW,
+    SETTING_TEC_RAMP_RATE,
+    SETTING_TEC_RAMP_PROFILE,
+    SETTING_TEC_HW_FADE,
+    SETTING_SUPPLY_VOLTS,
+    SETTING_FAN_RATED_W,
+    SETTING_AMBIENT,
+    SETTING_ENERGY_LIFETIME,
+    SETTING_ENERGY_SESSION,
+    SETTING_ENERGY_PREVIOUS,
+    SETTING_FAN_RPM_MODE,
+    SETTING_FAN_MAX_RPM,
+    SETTING_FAN_OPTIMIZE,
+    SETTING_FAN_POLICY,
+    SETTING_FF_VARIED,
+    SETTING_COUNT
+};
+
+constexpr SettingsFieldDef SETTINGS_FIELDS[] = {
+    // name             type         min      max     default
+    {"tempUnit",       FIELD_U8,     0.0f,    1.0f,   0.0f},    // TempUnit (CELSIUS)
+    {"setpoint",       FIELD_FLOAT, -50.0f,   50.0f,  0.0f},    // °C (0°C = 32°F)
+    {"pidMode",        FIELD_U8,     0.0f,    2.0f,   0.0f},    // PIDMode (PID_OFF)
+    {"pidKp",          FIELD_FLOAT,  0.0f,  100.0f,   2.0f},
+    {"pidKi",          FIELD_FLOAT,  0.0f,  100.0f,   0.1f},
+    {"pidKd",          FIELD_FLOAT,  0.0f,  100.0f,   1.0f},
+    {"pidMinOutput",   FIELD_FLOAT,  0.0f,  100.0f,   0.0f},    // %
+    {"pidMaxOutput",   FIELD_FLOAT,  0.0f,  100.0f, 100.0f},    // %
+    {"fanSpeed",       FIELD_FLOAT,  0.0f,  100.0f, 100.0f},    // %
+    {"smartEnabled",   FIELD_U8,     0.0f,    1.0f,   0.0f},    // bool
+    {"smartSetpoint",  FIELD_FLOAT,  0.0f,  100.0f,  50.0f},    // %
+    {"activeProfile",  FIELD_U8,     0.0f,    3.0f,   0.0f},    // Index into the profile table
+    {"gsEnabled",      FIELD_U8,     0.0f,    1.0f,   0.0f},    // bool
+    {"gsSource",       FIELD_U8,     0.0f,    1.0f,   0.0f},    // GainScheduleSource (setpoint)
+    {"gsValidMask",    FIELD_U8,     0.0f,   31.0f,   0.0f},    // One bit per populated point
+    {"gs0Temp",        FIELD_FLOAT, -50.0f,   50.0f, -10.0f},    // °C
+    {"gs0Kp",          FIELD_FLOAT,  0.0f,  100.0f,   2.0f},
+    {"gs0Ki",          FIELD_FLOAT,  0.0f,  100.0f,   0.1f},
+    {"gs0Kd",          FIELD_FLOAT,  0.0f,  100.0f,   1.0f},
+    {"gs1Temp",        FIELD_FLOAT, -50.0f,   50.0f,   0.0f},    // °C
+    {"gs1Kp",          FIELD_FLOAT,  0.0f,  100.0f,   2.0f},
+    {"gs1Ki",          FIELD_FLOAT,  0.0f,  100.0f,   0.1f},
+    {"gs1Kd",          FIELD_FLOAT,  0.0f,  100.0f,   1.0f},
+    {"gs2Temp",        FIELD_FLOAT, -50.0f,   50.0f,  10.0f},    // °C
+    {"gs2Kp",          FIELD_FLOAT,  0.0f,  100.0f,   2.0f},
+    {"gs2Ki",          FIELD_FLOAT,  0.0f,  100.0f,   0.1f},
+    {"gs2Kd",          FIELD_FLOAT,  0.0f,  100.0f,   1.0f},
+    {"gs3Temp",        FIELD_FLOAT, -50.0f,   50.0f,  20.0f},    // °C
+    {"gs3Kp",          FIELD_FLOAT,  0.0f,  100.0f,   2.0f},
+    {"gs3Ki",          FIELD_FLOAT,  0.0f,  100.0f,   0.1f},
+    {"gs3Kd",          FIELD_FLOAT,  0.0f,  100.0f,   1.0f},
+    {"gs4Temp",        FIELD_FLOAT, -50.0f,   50.0f,  30.0f},    // °C
+    {"gs4Kp",          FIELD_FLOAT,  0.0f,  100.0f,   2.0f},
+    {"gs4Ki",          FIELD_FLOAT,  0.0f,  100.0f,   0.1f},
+    {"gs4Kd",          FIELD_FLOAT,  0.0f,  100.0f,   1.0f},
+    {"ffEnabled",      FIELD_U8,     0.0f,    1.0f,   0.0f},    // bool
+    {"ffBias",         FIELD_FLOAT, -200.0f, 200.0f,  0.0f},    // % TEC power
+    {"ffSetpointGain", FIELD_FLOAT, -200.0f, 200.0f,  0.0f},    // % per 10°C of setpoint
+    {"ffFanGain",      FIELD_FLOAT, -200.0f, 200.0f,  0.0f},    // % per 100% fan speed
+    {"ffSamples",      FIELD_FLOAT,  0.0f,    1.0e6f, 0.0f},    // Steady-state points learned
+    {"atNoiseBand",    FIELD_FLOAT,  0.02f,   2.0f,   0.15f},   // °C relay hysteresis for auto-tune
+    {"modelValid",     FIELD_U8,     0.0f,    1.0f,   0.0f},    // bool, identified FOPDT model
+    {"modelGain",      FIELD_FLOAT, -10.0f,   10.0f,  0.0f},    // °C per % TEC power
+    {"modelTau",       FIELD_FLOAT,  0.0f, 3600.0f,   0.0f},    // s
+    {"modelDeadTime",  FIELD_FLOAT,  0.0f,  600.0f,   0.0f},    // s
+    {"adaptAuto",      FIELD_U8,     0.0f,    1.0f,   0.0f},    // bool, re-derive gains on plant drift
+    {"adaptDrift",     FIELD_FLOAT,  0.05f,   1.0f,   0.3f},    // Relative K/tau change flagged as drift
+    {"mpcEnabled",     FIELD_U8,     0.0f,    1.0f,   0.0f},    // bool, MPC instead of PID (needs a model)
+    {"mpcSlew",        FIELD_FLOAT,  0.5f,  100.0f,   5.0f},    // % TEC power per second
+    {"tecRampRate",    FIELD_FLOAT,  1.0f, 1000.0f,  40.0f},    // % TEC power per second (soft-start)
+    {"tecRampProfile", FIELD_U8,     0.0f,    1.0f,   0.0f},    // TECRampProfile
+    {"tecHwFade",      FIELD_U8,     0.0f,    1.0f,   0.0f},    // bool, ramp with the LEDC fade engine
+    {"supplyVolts",    FIELD_FLOAT,  5.0f,   30.0f,  12.0f},    // V, TEC supply
+    {"fanRatedW",      FIELD_FLOAT,  0.0f,   50.0f,   3.6f},    // W, both fans at 100%
+    {"ambientC",       FIELD_FLOAT, -20.0f,  50.0f,  25.0f},    // °C, TEC hot side for COP
+    {"energyTotalWh",  FIELD_FLOAT,  0.0f,    1.0e9f, 0.0f},    // Lifetime energy
+    {"energySessWh",   FIELD_FLOAT,  0.0f,    1.0e9f, 0.0f},    // Current session (since boot)
+    {"energyPrevWh",   FIELD_FLOAT,  0.0f,    1.0e9f, 0.0f},    // Previous session
+    {"fanRpmMode",     FIELD_U8,     0.0f,    1.0f,   0.0f},    // bool, fan % = % of fanMaxRpm (closed loop)
+    {"fanMaxRpm",      FIELD_FLOAT, 500.0f, 10000.0f, 2000.0f}, // rpm at 100% duty
+    {"fanOptimize",    FIELD_U8,     0.0f,    1.0f,   0.0f},    // bool, search min-power fan speed at setpoint
+    {"fanPolicy",      FIELD_U8,     0.0f,    2.0f,   0.0f},    // FanPolicyType (hysteresis)
+    {"ffVaried",       FIELD_U8,     0.0f,    3.0f,   0.0f},    // FeedForward gains fitted: bit 0 setpoint, bit 1 fan
+};
+
+constexpr uint16_t settingsFieldSize(SettingsFieldType type) {
+    return (type == FIELD_FLOAT) ? 4 : 1;
+}
+
+// Byte offset of a field within the payload (sum of all preceding field sizes)
+constexpr uint16_t settingsFieldOffset(int id) {
+    return (id == 0) ? 0
+        : settingsFieldOffset(id - 1) + settingsFieldSize(SETTINGS_FIELDS[id - 1].type);
+}
+
+constexpr uint16_t SETTINGS_PAYLOAD_SIZE = settingsFieldOffset(SETTING_COUNT);
+
+// Record framing: header {magic u32, version u16, payloadSize u16, generation u32},
+// payload, then CRC32 over everything before it
+constexpr uint16_t SETTINGS_HEADER_SIZE = 12;
+constexpr uint16_t SETTINGS_CRC_SIZE = 4;
+constexpr uint16_t SETTINGS_MAX_RECORD_SIZE = 512;
+
+// --- Profiles ---
+//
+// Each profile holds its own copy of the fields below; the active profile's
+// values are the live settings. Profiles follow the global payload as
+// {count u8, stride u8} and then 'count' entries of 'stride' bytes
+// (name, then the profile fields packed in PROFILE_FIELDS order). Like the
+// main table, PROFILE_FIELDS is append-only.
+
+constexpr uint8_t SETTINGS_PROFILE_COUNT = 4;
+constexpr uint8_t SETTINGS_PROFILE_NAME_LEN = 12;  // Including terminator
+
+constexpr SettingsFieldId PROFILE_FIELDS[] = {
+    SETTING_SETPOINT,
+    SETTING_PID_KP,
+    SETTING_PID_KI,
+    SETTING_PID_KD,
+    SETTING_PID_MIN,
+    SETTING_PID_MAX,
+    SETTING_FAN_SPEED,
+    SETTING_SMART_SETPOINT,
+};
+
+constexpr int PROFILE_FIELD_COUNT = sizeof(PROFILE_FIELDS) / sizeof(PROFILE_FIELDS[0]);
+
+// Byte offset of a profile field within a profile entry (after the name)
+constexpr uint16_t profileFieldOffset(int index) {
+    return (index == 0) ? SETTINGS_PROFILE_NAME_LEN
+        : profileFieldOffset(index - 1) + settingsFieldSize(SETTINGS_FIELDS[PROFILE_FIELDS[index - 1]].type);
+}
+
+constexpr uint16_t SETTINGS_PROFILE_SIZE = profileFieldOffset(PROFILE_FIELD_COUNT);
+constexpr uint16_t SETTINGS_PROFILE_BLOCK_SIZE = 2 + SETTINGS_PROFILE_COUNT * SETTINGS_PROFILE_SIZE;
+
+// --- Legacy layouts (read-only, used for migration) ---
+
+struct LegacyFieldDef {
+    SettingsFieldId id;
+    SettingsFieldType type;
+    uint16_t offset;
+};
+
+// v0: raw EEPROM byte offsets (original firmware, no header or CRC)
+constexpr uint16_t LEGACY_EEPROM_SIZE = 64;
+constexpr LegacyFieldDef LEGACY_EEPROM_LAYOUT[] = {
+    {SETTING_TEMP_UNIT,      FIELD_U8,     0},
+    {SETTING_SETPOINT,       FIELD_FLOAT,  1},
+    {SETTING_PID_MODE,       FIELD_U8,     5},
+    {SETTING_PID_KP,         FIELD_FLOAT,  6},
+    {SETTING_PID_KI,         FIELD_FLOAT, 10},
+    {SETTING_PID_KD,         FIELD_FLOAT, 14},
+    {SETTING_PID_MIN,        FIELD_FLOAT, 18},
+    {SETTING_PID_MAX,        FIELD_FLOAT, 22},
+    {SETTING_FAN_SPEED,      FIELD_FLOAT, 26},
+    {SETTING_SMART_ENABLED,  FIELD_U8,    30},
+    {SETTING_SMART_SETPOINT, FIELD_FLOAT, 31},
+};
+
+// v1: fixed-struct NVS record (same header/CRC framing, 52 bytes total)
+constexpr uint16_t LEGACY_V1_RECORD_SIZE = 52;
+constexpr LegacyFieldDef LEGACY_V1_LAYOUT[] = {
+    {SETTING_TEMP_UNIT,      FIELD_U8,    12},
+    {SETTING_PID_MODE,       FIELD_U8,    13},
+    {SETTING_SMART_ENABLED,  FIELD_U8,    14},
+    {SETTING_SETPOINT,       FIELD_FLOAT, 16},
+    {SETTING_PID_KP,         FIELD_FLOAT, 20},
+    {SETTING_PID_KI,         FIELD_FLOAT, 24},
+    {SETTING_PID_KD,         FIELD_FLOAT, 28},
+    {SETTING_PID_MIN,        FIELD_FLOAT, 32},
+    {SETTING_PID_MAX,        FIELD_FLOAT, 36},
+    {SETTING_FAN_SPEED,      FIELD_FLOAT, 40},
+    {SETTING_SMART_SETPOINT, FIELD_FLOAT, 44},
+};
+
+constexpr int LEGACY_EEPROM_FIELD_COUNT = sizeof(LEGACY_EEPROM_LAYOUT) / sizeof(LEGACY_EEPROM_LAYOUT[0]);
+constexpr int LEGACY_V1_FIELD_COUNT = sizeof(LEGACY_V1_LAYOUT) / sizeof(LEGACY_V1_LAYOUT[0]);
+
+// --- Compile-time validation ---
+
+constexpr bool settingsFieldsValid(int id) {
+    return (id == SETTING_COUNT) ? true
+        : (SETTINGS_FIELDS[id].minValue <= SETTINGS_FIELDS[id].maxValue &&
+           SETTINGS_FIELDS[id].defaultValue >= SETTINGS_FIELDS[id].minValue &&
+           SETTINGS_FIELDS[id].defaultValue <= SETTINGS_FIELDS[id].maxValue &&
+           (SETTINGS_FIELDS[id].type != FIELD_U8 || SETTINGS_FIELDS[id].maxValue <= 255.0f) &&
+           settingsFieldsValid(id + 1));
+}
+
+// Legacy entries must be sorted, non-overlapping, match the field's type and end before 'limit'
+constexpr bool legacyLayoutValid(const LegacyFieldDef* layout, int count, int i, uint16_t limit) {
+    return (i == count) ? true
+        : (layout[i].type == SETTINGS_FIELDS[layout[i].id].type &&
+           layout[i].offset + settingsFieldSize(layout[i].type) <= limit &&
+           (i == 0 || layout[i].offset >= layout[i - 1].offset + settingsFieldSize(layout[i - 1].type)) &&
+           legacyLayoutValid(layout, count, i + 1, limit));
+}
+
+static_assert(sizeof(SETTINGS_FIELDS) / sizeof(SETTINGS_FIELDS[0]) == SETTING_COUNT,
+              "SETTINGS_FIELDS must have one entry per SettingsFieldId");
+static_assert(settingsFieldsValid(0), "Settings field bounds/defaults are inconsistent");
+static_assert(SETTINGS_HEADER_SIZE + SETTINGS_PAYLOAD_SIZE + SETTINGS_PROFILE_BLOCK_SIZE +
+              SETTINGS_CRC_SIZE <= SETTINGS_MAX_RECORD_SIZE,
+              "Settings record exceeds SETTINGS_MAX_RECORD_SIZE");
+static_assert(SETTINGS_FIELDS[SETTING_ACTIVE_PROFILE].maxValue == SETTINGS_PROFILE_COUNT - 1,
+              "activeProfile bounds must match SETTINGS_PROFILE_COUNT");
+static_assert(SETTINGS_PROFILE_SIZE <= 255, "Profile stride is stored as u8");
+static_assert(SETTING_COUNT > 0 && SETTING_COUNT <= 64, "Dirty-field mask is 64 bits");
+static_assert(SETTINGS_FIELDS[SETTING_GS_VALID_MASK].maxValue == (1 << GAIN_SCHEDULE_POINTS) - 1,
+              "gsValidMask bounds must match GAIN_SCHEDULE_POINTS");
+static_assert(legacyLayoutValid(LEGACY_EEPROM_LAYOUT, LEGACY_EEPROM_FIELD_COUNT, 0, LEGACY_EEPROM_SIZE),
+              "Legacy EEPROM layout overlaps or overflows");
+static_assert(legacyLayoutValid(LEGACY_V1_LAYOUT, LEGACY_V1_FIELD_COUNT, 0,
+                                LEGACY_V1_RECORD_SIZE - SETTINGS_CRC_SIZE),
+              "Legacy v1 record layout overlaps or overflows");
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef STEP_IDENTIFIER_H
+#define STEP_IDENTIFIER_H
+
+#include <stdint.h>
+#include "ThermalModel.h"
+
+// Open-loop step-response identification of a FOPDT model.
+//
+// Holds the current output for a baseline period (to measure the starting
+// temperature and its drift), steps TEC power, logs the response at 1 Hz
+// until it settles, then fits gain/time constant/dead time by least squares:
+// for each candidate dead time d the discrete model
+//   y[k+1] = a * y[k] + b * step[k - d]
+// is solved in closed form and the d with the smallest residual wins.
+class StepIdentifier {
+public:
+    enum State {
+        IDLE,
+        BASELINE,
+        STEP,
+        DONE,
+        FAILED
+    };
+
+    void start(float input, float baseOutput, float minOutput, float maxOutput);
+    float update(float input);  // Call every loop; returns the output (%) to apply
+    void cancel() { _state = IDLE; }
+
+    State getState() const { return _state; }
+    int getProgress() const;  // 0-100 (estimate, the step ends once settled)
+    const char* getError() const { return _error; }
+    const FopdtModel& getModel() const { return _model; }
+
+private:
+    bool fit();
+
+    State _state = IDLE;
+    const char* _error = "";
+    FopdtModel _model = {0.0f, 0.0f, 0.0f, false};
+
+    float _baseOutput = 0.0f;
+    float _stepOutput = 0.0f;
+    unsigned long _phaseStart = 0;
+    unsigned long _lastSample = 0;
+
+    // Baseline line fit (t in s since baseline start)
+    float _baseSumT = 0.0f;
+    float _baseSumY = 0.0f;
+    float _baseSumTY = 0.0f;
+    float _baseSumTT = 0.0f;
+    int _baseCount = 0;
+    float _baseline = 0.0f;   // Temperature at the step
+    float _drift = 0.0f;      // °C/s, removed from the response
+
+    // Step response (deviation from baseline), 1 sample per second
+    static constexpr int MAX_SAMPLES = 600;
+    float _samples[MAX_SAMPLES];
+    int _count = 0;
+
+    static constexpr unsigned long SAMPLE_MS = 1000;
+    static constexpr unsigned long BASELINE_MS = 30000;
+    static constexpr int MIN_STEP_SAMPLES = 60;
+    static constexpr int SETTLE_WINDOW = 60;          // Settled when the last 60 s moved < 5%
+    static constexpr float SETTLE_FRACTION = 0.05f;
+    static constexpr float STEP_PCT = 30.0f;
+    static constexpr int MAX_DEAD_TIME_S = 120;
+    static constexpr float MIN_RESPONSE_C = 0.3f;     // Smaller responses are treated as noise
+    static constexpr float MAX_TIME_CONSTANT_S = 3600.0f;  // modelTau upper bound
+    static constexpr float MAX_GAIN = 10.0f;          // |modelGain| upper bound, °C per %
+    static constexpr float MIN_GAIN = 1e-4f;          // Below this the model is unusable
+};
+
+#endif
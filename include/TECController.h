@@ -8,7 +8,7 @@ public:
     static TECController& getInstance();
 
     void begin();
-    void update();  // Call in loop() for soft-start ramping
+    void update();  // Call in loop() for soft-start ramping (time-based, any loop rate)
 
     // Enable/disable the TEC
     void setEnabled(bool enabled);
@@ -20,8 +20,10 @@ public:
     float getPower() const { return _power; }
     float getTargetPower() const { return _targetPower; }
 
-    // Current sensing
-    float readCurrent();  // Returns current in amps
+    // Current sensing: average TEC current (A) over whole PWM periods, from
+    // AnalogAcquisition windows taken at evenly spread PWM phases
+    float readCurrent() const { return _current; }
+    float getOnPhaseCurrent() const;  // Current while the high side conducts
 
     // Convenience methods
     void stop();  // Disable and set power to 0
@@ -32,11 +34,38 @@ private:
     TECController& operator=(const TECController&) = delete;
 
     void updatePWM();
+    void updateRamp(unsigned long now);
+    void updateSCurve(float dt, float rate);
+    void updateFade(unsigned long now);
+    void stopFade();
+    uint32_t dutyFor(float power) const;
+    void updateCurrentSense();
 
     bool _enabled = false;
     float _power = 0.0f;
     float _targetPower = 0.0f;
 
+    // Current ramp segment: _rampFrom -> _rampTo over _rampDuration ms
+    float _rampFrom = 0.0f;
+    float _rampTo = 0.0f;
+    unsigned long _rampStart = 0;
+    unsigned long _rampDuration = 0;
+    bool _ramping = false;
+
+    // S-curve profile: applied power moves at _rampVelocity (fraction/s)
+    float _rampVelocity = 0.0f;
+    unsigned long _lastRampUpdate = 0;
+
+    // Filtered current, fed every completed acquisition window
+    uint32_t _currentSequence = 0;
+    float _current = 0.0f;
+
+    // Hardware fade: the LEDC engine owns the duty until _fadeEnd, or until
+    // a new target or direct write stops it
+    bool _fadeInstalled = false;
+    bool _fadeRunning = false;
+    unsigned long _fadeEnd = 0;
+
     // Hardware configuration
     static constexpr uint8_t PIN_RPWM = 2;       // GPIO2 on M5Dial Port B
     static constexpr uint8_t PIN_REN = 4;        // PCA9554 pin 4
@@ -47,11 +76,20 @@ private:
     static constexpr uint32_t PWM_FREQ = 20000;  // 20kHz (above human hearing)
     static constexpr uint8_t PWM_RESOLUTION = 10; // 10-bit (0-1023)
 
-    // Soft-start configuration
-    static constexpr float RAMP_RATE = 0.01f;    // 1% per update (~2-3 sec to full power)
+    // Soft-start configuration (rate and profile come from SettingsManager)
+    static constexpr float S_CURVE_ACCEL_S = 1.0f;       // Time to reach the ramp rate from rest
+    static constexpr float S_CURVE_SNAP = 0.001f;        // Closer than this lands on the target
+    static constexpr unsigned long FADE_MIN_MS = 20;     // Shorter moves are written directly
+    static constexpr unsigned long FADE_MARGIN_MS = 5;   // Let the fade-end interrupt run before the next
 
-    // Current sensing (BTS7960 IS pin)
-    static constexpr float IS_MV_PER_AMP = 8.5f; // ~8.5mV per amp
+    // Current sensing (BTS7960 IS pin, ANALOG_TEC_CURRENT). The IS output
+    // only carries current while the PWM is on, so it is sampled at
+    // 2 + 1/100 samples per PWM period: each window of 201 samples covers
+    // exactly 100 periods and hits 201 distinct phases (equivalent-time
+    // sampling), making the window mean the true average current.
+    static constexpr uint32_t CURRENT_WINDOW_PERIODS = 100;
+    static constexpr float CURRENT_FILTER = 0.1f;               // EMA weight per window (5 ms): ~50 ms
+    static constexpr float VOLTS_PER_AMP = 0.038f;              // Calibrated: 0.33V at 8.7A
 };
 
 #endif
@@ -13,7 +13,7 @@ public:
 
     // Error handling
     bool hasError() const { return _hasError; }
-    void tryReconnect();  // Attempt to reconnect if in error state
+    void tryReconnect();  // Non-blocking re-init while in error state (call every loop)
 
 private:
     TemperatureSensor() = default;
@@ -59,6 +59,9 @@ private:
 
     // Error state
     bool _hasError = false;
+    uint32_t _reconnectCount = 0;    // PCA9554 reconnects seen
+    unsigned long _lastReinit = 0;
+    static constexpr unsigned long REINIT_INTERVAL_MS = 1000;  // Fault-clear retry while in error
 };
 
 #endif
@@ -0,0 +1,36 @@
+#ifndef THERMAL_MODEL_H
+#define THERMAL_MODEL_H
+
+#include <math.h>
+
+// First-order-plus-dead-time model of the cold plate:
+//
+//   dT/dt = (gain * u(t - deadTime) - (T - T0)) / timeConstant
+//
+// u is TEC power in %, gain is in °C per % (negative: more power = colder).
+struct FopdtModel {
+    float gain;          // °C per % TEC power
+    float timeConstant;  // s
+    float deadTime;      // s
+    bool valid;
+};
+
+// IMC-PID tunings for a FOPDT plant (Rivera/Morari), in QuickPID units:
+// Kp in %/°C, Ki in %/(°C*s), Kd in %*s/°C. The closed-loop time constant
+// lambda is kept above 0.8 * deadTime for robustness; larger is gentler.
+inline void imcPidTunings(const FopdtModel& model, float lambda, float& kp, float& ki, float& kd) {
+    float k = fabsf(model.gain);
+    float tau = model.timeConstant;
+    float theta = model.deadTime;
+
+    if (lambda < 0.8f * theta) lambda = 0.8f * theta;
+    if (lambda < 0.1f * tau) lambda = 0.1f * tau;
+
+    float ti = tau + theta / 2.0f;
+    float td = (tau * theta) / (2.0f * tau + theta);
+    kp = ti / (k * (lambda + theta / 2.0f));
+    ki = kp / ti;
+    kd = kp * td;
+}
+
+#endif
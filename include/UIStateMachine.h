@@ -13,6 +13,7 @@ enum UIMode {
     MODE_CURRENT,
     MODE_SETPOINT,
     MODE_POWER,
+    MODE_ENERGY,
     MODE_FAN,
     MODE_FAN_SPEED,
     MODE_SMART_CONTROL,
@@ -47,6 +48,7 @@ private:
     void handleSetpointMode(int delta);
     void handleSettingsMode(int delta);
     void handleSettingsButtonPress();
+    void selectNextProfile();
     void handlePIDMenuMode(int delta);
     void handlePIDMenuButtonPress();
     void handlePIDEditMode(int delta);
@@ -61,12 +63,14 @@ private:
     void handleMaxFanEditMode(int delta);
     void handleFirmwareMode(int delta);
     void handleFirmwareButtonPress();
+    void startFirmwareFlash(const char* imageName, const char* status, const char* doneText);
+    void handleFirmwareFlashing();
     void updateTemperature();
     void refreshDisplay();
 
     UIMode _mode = MODE_NAVIGATE;
     MainScreenSelection _mainSelection = MAIN_SELECT_SETPOINT;
-    SettingsMenuItem _settingsSelection = SETTINGS_TEMP_UNIT;
+    SettingsMenuItem _settingsSelection = SETTINGS_PROFILE;
     PIDMenuItem _pidSelection = PID_MENU_MODE;
     bool _pidSettingsChanged = false;  // Track if PID settings need saving
     FanScreenSelection _fanSelection = FAN_SELECT_SPEED;
@@ -74,6 +78,16 @@ private:
     SmartControlMenuItem _smartSelection = SMART_CONTROL_TOGGLE;
     FirmwareMenuItem _firmwareSelection = FIRMWARE_VERSION;
 
+    // Background flash (EXTIO2FlashJob) progress screen
+    const char* _flashStatus = "";
+    const char* _flashDoneText = "";
+    int _flashPage = 0;
+    int _flashTotal = 0;
+    bool _flashCancelling = false;
+    bool _flashFinished = false;    // Result shown, waiting to return to the menu
+    bool _flashSucceeded = false;
+    unsigned long _flashFinishedAt = 0;
+
     float _setpoint = 22.0f;
     float _currentTemp = 25.0f;
     bool _sensorError = false;
@@ -83,6 +97,8 @@ private:
 
     static constexpr unsigned long INACTIVITY_DELAY = 3000;  // 3 seconds
     static constexpr unsigned long TEMP_UPDATE_INTERVAL = 1000;  // 1 second
+    static constexpr unsigned long FLASH_SUCCESS_HOLD_MS = 1000;
+    static constexpr unsigned long FLASH_FAILURE_HOLD_MS = 2000;
     static constexpr float SETPOINT_MIN = -12.2f;  // 10°F
     static constexpr float SETPOINT_MAX = 35.0f;
     static constexpr float SETPOINT_STEP = 0.25f;  // Per encoder pulse
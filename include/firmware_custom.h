@@ -1,716 +0,0 @@
-// Auto-generated from ../EXTIO/build/EXTIO_crc.bin
-// Size: 11264 bytes
-
-#ifndef FIRMWARE_CUSTOM_H
-#define FIRMWARE_CUSTOM_H
-
-const uint8_t extio2_custom_firmware[] = {
-    0x00, 0x10, 0x00, 0x20, 0x15, 0x38, 0x00, 0x08, 0xD5, 0x28, 0x00, 0x08, 0xDD, 0x28, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x28, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x28, 0x00, 0x08, 0xE9, 0x28, 0x00, 0x08,
-    0x65, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x65, 0x38, 0x00, 0x08, 0x65, 0x38, 0x00, 0x08,
-    0x65, 0x38, 0x00, 0x08, 0x65, 0x38, 0x00, 0x08, 0x65, 0x38, 0x00, 0x08, 0x65, 0x38, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x38, 0x00, 0x08, 0x65, 0x38, 0x00, 0x08, 0x65, 0x38, 0x00, 0x08,
-    0x65, 0x38, 0x00, 0x08, 0x65, 0x38, 0x00, 0x08, 0x65, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x65, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x38, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x38, 0x00, 0x08, 0x65, 0x38, 0x00, 0x08, 0x65, 0x27, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x65, 0x38, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xB4, 0x71, 0x46, 0x49, 0x08, 0x49, 0x00, 0x09, 0x5C, 0x49, 0x00, 0x8E, 0x44, 0x02, 0xBC,
-    0x70, 0x47, 0xC0, 0x46, 0x00, 0x22, 0x43, 0x08, 0x8B, 0x42, 0x74, 0xD3, 0x03, 0x09, 0x8B, 0x42,
-    0x5F, 0xD3, 0x03, 0x0A, 0x8B, 0x42, 0x44, 0xD3, 0x03, 0x0B, 0x8B, 0x42, 0x28, 0xD3, 0x03, 0x0C,
-    0x8B, 0x42, 0x0D, 0xD3, 0xFF, 0x22, 0x09, 0x02, 0x12, 0xBA, 0x03, 0x0C, 0x8B, 0x42, 0x02, 0xD3,
-    0x12, 0x12, 0x09, 0x02, 0x65, 0xD0, 0x03, 0x0B, 0x8B, 0x42, 0x19, 0xD3, 0x00, 0xE0, 0x09, 0x0A,
-    0xC3, 0x0B, 0x8B, 0x42, 0x01, 0xD3, 0xCB, 0x03, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x0B, 0x8B, 0x42,
-    0x01, 0xD3, 0x8B, 0x03, 0xC0, 0x1A, 0x52, 0x41, 0x43, 0x0B, 0x8B, 0x42, 0x01, 0xD3, 0x4B, 0x03,
-    0xC0, 0x1A, 0x52, 0x41, 0x03, 0x0B, 0x8B, 0x42, 0x01, 0xD3, 0x0B, 0x03, 0xC0, 0x1A, 0x52, 0x41,
-    0xC3, 0x0A, 0x8B, 0x42, 0x01, 0xD3, 0xCB, 0x02, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x0A, 0x8B, 0x42,
-    0x01, 0xD3, 0x8B, 0x02, 0xC0, 0x1A, 0x52, 0x41, 0x43, 0x0A, 0x8B, 0x42, 0x01, 0xD3, 0x4B, 0x02,
-    0xC0, 0x1A, 0x52, 0x41, 0x03, 0x0A, 0x8B, 0x42, 0x01, 0xD3, 0x0B, 0x02, 0xC0, 0x1A, 0x52, 0x41,
-    0xCD, 0xD2, 0xC3, 0x09, 0x8B, 0x42, 0x01, 0xD3, 0xCB, 0x01, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x09,
-    0x8B, 0x42, 0x01, 0xD3, 0x8B, 0x01, 0xC0, 0x1A, 0x52, 0x41, 0x43, 0x09, 0x8B, 0x42, 0x01, 0xD3,
-    0x4B, 0x01, 0xC0, 0x1A, 0x52, 0x41, 0x03, 0x09, 0x8B, 0x42, 0x01, 0xD3, 0x0B, 0x01, 0xC0, 0x1A,
-    0x52, 0x41, 0xC3, 0x08, 0x8B, 0x42, 0x01, 0xD3, 0xCB, 0x00, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x08,
-    0x8B, 0x42, 0x01, 0xD3, 0x8B, 0x00, 0xC0, 0x1A, 0x52, 0x41, 0x43, 0x08, 0x8B, 0x42, 0x01, 0xD3,
-    0x4B, 0x00, 0xC0, 0x1A, 0x52, 0x41, 0x41, 0x1A, 0x00, 0xD2, 0x01, 0x46, 0x52, 0x41, 0x10, 0x46,
-    0x70, 0x47, 0xFF, 0xE7, 0x01, 0xB5, 0x00, 0x20, 0x00, 0xF0, 0xF0, 0xF8, 0x02, 0xBD, 0xC0, 0x46,
-    0x00, 0x29, 0xF7, 0xD0, 0x76, 0xE7, 0x70, 0x47, 0x03, 0x46, 0x0B, 0x43, 0x7F, 0xD4, 0x00, 0x22,
-    0x43, 0x08, 0x8B, 0x42, 0x74, 0xD3, 0x03, 0x09, 0x8B, 0x42, 0x5F, 0xD3, 0x03, 0x0A, 0x8B, 0x42,
-    0x44, 0xD3, 0x03, 0x0B, 0x8B, 0x42, 0x28, 0xD3, 0x03, 0x0C, 0x8B, 0x42, 0x0D, 0xD3, 0xFF, 0x22,
-    0x09, 0x02, 0x12, 0xBA, 0x03, 0x0C, 0x8B, 0x42, 0x02, 0xD3, 0x12, 0x12, 0x09, 0x02, 0x65, 0xD0,
-    0x03, 0x0B, 0x8B, 0x42, 0x19, 0xD3, 0x00, 0xE0, 0x09, 0x0A, 0xC3, 0x0B, 0x8B, 0x42, 0x01, 0xD3,
-    0xCB, 0x03, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x0B, 0x8B, 0x42, 0x01, 0xD3, 0x8B, 0x03, 0xC0, 0x1A,
-    0x52, 0x41, 0x43, 0x0B, 0x8B, 0x42, 0x01, 0xD3, 0x4B, 0x03, 0xC0, 0x1A, 0x52, 0x41, 0x03, 0x0B,
-    0x8B, 0x42, 0x01, 0xD3, 0x0B, 0x03, 0xC0, 0x1A, 0x52, 0x41, 0xC3, 0x0A, 0x8B, 0x42, 0x01, 0xD3,
-    0xCB, 0x02, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x0A, 0x8B, 0x42, 0x01, 0xD3, 0x8B, 0x02, 0xC0, 0x1A,
-    0x52, 0x41, 0x43, 0x0A, 0x8B, 0x42, 0x01, 0xD3, 0x4B, 0x02, 0xC0, 0x1A, 0x52, 0x41, 0x03, 0x0A,
-    0x8B, 0x42, 0x01, 0xD3, 0x0B, 0x02, 0xC0, 0x1A, 0x52, 0x41, 0xCD, 0xD2, 0xC3, 0x09, 0x8B, 0x42,
-    0x01, 0xD3, 0xCB, 0x01, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x09, 0x8B, 0x42, 0x01, 0xD3, 0x8B, 0x01,
-    0xC0, 0x1A, 0x52, 0x41, 0x43, 0x09, 0x8B, 0x42, 0x01, 0xD3, 0x4B, 0x01, 0xC0, 0x1A, 0x52, 0x41,
-    0x03, 0x09, 0x8B, 0x42, 0x01, 0xD3, 0x0B, 0x01, 0xC0, 0x1A, 0x52, 0x41, 0xC3, 0x08, 0x8B, 0x42,
-    0x01, 0xD3, 0xCB, 0x00, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x08, 0x8B, 0x42, 0x01, 0xD3, 0x8B, 0x00,
-    0xC0, 0x1A, 0x52, 0x41, 0x43, 0x08, 0x8B, 0x42, 0x01, 0xD3, 0x4B, 0x00, 0xC0, 0x1A, 0x52, 0x41,
-    0x41, 0x1A, 0x00, 0xD2, 0x01, 0x46, 0x52, 0x41, 0x10, 0x46, 0x70, 0x47, 0x5D, 0xE0, 0xCA, 0x0F,
-    0x00, 0xD0, 0x49, 0x42, 0x03, 0x10, 0x00, 0xD3, 0x40, 0x42, 0x53, 0x40, 0x00, 0x22, 0x9C, 0x46,
-    0x03, 0x09, 0x8B, 0x42, 0x2D, 0xD3, 0x03, 0x0A, 0x8B, 0x42, 0x12, 0xD3, 0xFC, 0x22, 0x89, 0x01,
-    0x12, 0xBA, 0x03, 0x0A, 0x8B, 0x42, 0x0C, 0xD3, 0x89, 0x01, 0x92, 0x11, 0x8B, 0x42, 0x08, 0xD3,
-    0x89, 0x01, 0x92, 0x11, 0x8B, 0x42, 0x04, 0xD3, 0x89, 0x01, 0x3A, 0xD0, 0x92, 0x11, 0x00, 0xE0,
-    0x89, 0x09, 0xC3, 0x09, 0x8B, 0x42, 0x01, 0xD3, 0xCB, 0x01, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x09,
-    0x8B, 0x42, 0x01, 0xD3, 0x8B, 0x01, 0xC0, 0x1A, 0x52, 0x41, 0x43, 0x09, 0x8B, 0x42, 0x01, 0xD3,
-    0x4B, 0x01, 0xC0, 0x1A, 0x52, 0x41, 0x03, 0x09, 0x8B, 0x42, 0x01, 0xD3, 0x0B, 0x01, 0xC0, 0x1A,
-    0x52, 0x41, 0xC3, 0x08, 0x8B, 0x42, 0x01, 0xD3, 0xCB, 0x00, 0xC0, 0x1A, 0x52, 0x41, 0x83, 0x08,
-    0x8B, 0x42, 0x01, 0xD3, 0x8B, 0x00, 0xC0, 0x1A, 0x52, 0x41, 0xD9, 0xD2, 0x43, 0x08, 0x8B, 0x42,
-    0x01, 0xD3, 0x4B, 0x00, 0xC0, 0x1A, 0x52, 0x41, 0x41, 0x1A, 0x00, 0xD2, 0x01, 0x46, 0x63, 0x46,
-    0x52, 0x41, 0x5B, 0x10, 0x10, 0x46, 0x01, 0xD3, 0x40, 0x42, 0x00, 0x2B, 0x00, 0xD5, 0x49, 0x42,
-    0x70, 0x47, 0x63, 0x46, 0x5B, 0x10, 0x00, 0xD3, 0x40, 0x42, 0x01, 0xB5, 0x00, 0x20, 0x00, 0xF0,
-    0x05, 0xF8, 0x02, 0xBD, 0x00, 0x29, 0xF8, 0xD0, 0x16, 0xE7, 0x70, 0x47, 0x70, 0x47, 0xC0, 0x46,
-    0xD0, 0x40, 0x0B, 0x00, 0xD1, 0x40, 0x9C, 0x46, 0x20, 0x3A, 0xD3, 0x40, 0x18, 0x43, 0x52, 0x42,
-    0x63, 0x46, 0x93, 0x40, 0x18, 0x43, 0x70, 0x47, 0x04, 0x48, 0x05, 0x4B, 0x10, 0xB5, 0x83, 0x42,
-    0x03, 0xD0, 0x04, 0x4B, 0x00, 0x2B, 0x00, 0xD0, 0x98, 0x47, 0x10, 0xBD, 0x6C, 0x01, 0x00, 0x20,
-    0x6C, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06, 0x48, 0x07, 0x49, 0x09, 0x1A, 0x8B, 0x10,
-    0xC9, 0x0F, 0xC9, 0x18, 0x10, 0xB5, 0x49, 0x10, 0x03, 0xD0, 0x04, 0x4B, 0x00, 0x2B, 0x00, 0xD0,
-    0x98, 0x47, 0x10, 0xBD, 0x6C, 0x01, 0x00, 0x20, 0x6C, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0xB5, 0x07, 0x4C, 0x23, 0x78, 0x00, 0x2B, 0x09, 0xD1, 0xFF, 0xF7, 0xD5, 0xFF, 0x05, 0x4B,
-    0x00, 0x2B, 0x02, 0xD0, 0x04, 0x48, 0x00, 0xE0, 0x00, 0xBF, 0x01, 0x23, 0x23, 0x70, 0x10, 0xBD,
-    0x70, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x3A, 0x00, 0x08, 0x05, 0x4B, 0x10, 0xB5,
-    0x00, 0x2B, 0x03, 0xD0, 0x04, 0x49, 0x05, 0x48, 0x00, 0xE0, 0x00, 0xBF, 0xFF, 0xF7, 0xCC, 0xFF,
-    0x10, 0xBD, 0xC0, 0x46, 0x00, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x20, 0xDC, 0x3A, 0x00, 0x08,
-    0x80, 0x23, 0x13, 0xB5, 0x0D, 0x4A, 0x0E, 0x49, 0x9B, 0x05, 0x18, 0x00, 0x10, 0xCA, 0x04, 0x33,
-    0x04, 0x60, 0x8B, 0x42, 0xF9, 0xD1, 0x01, 0x21, 0x0A, 0x4B, 0x9A, 0x69, 0x0A, 0x43, 0x9A, 0x61,
-    0x03, 0x22, 0x9B, 0x69, 0x0B, 0x40, 0x01, 0x93, 0x01, 0x9B, 0x07, 0x4B, 0x19, 0x68, 0x91, 0x43,
-    0x19, 0x60, 0x19, 0x68, 0x0A, 0x43, 0x1A, 0x60, 0x13, 0xBD, 0xC0, 0x46, 0x00, 0x10, 0x00, 0x08,
-    0xC0, 0x00, 0x00, 0x20, 0x00, 0x10, 0x02, 0x40, 0x00, 0x00, 0x01, 0x40, 0x70, 0xB5, 0x0C, 0x4C,
-    0x20, 0x21, 0x20, 0x00, 0x00, 0xF0, 0x9C, 0xFF, 0x00, 0x28, 0x01, 0xD1, 0x00, 0x20, 0x70, 0xBD,
-    0x15, 0x25, 0x08, 0x4B, 0x1B, 0x78, 0x23, 0x70, 0x20, 0x21, 0x20, 0x00, 0x00, 0xF0, 0xAE, 0xFF,
-    0x00, 0x28, 0x01, 0xD0, 0x01, 0x20, 0xF2, 0xE7, 0x01, 0x3D, 0x00, 0x2D, 0xF4, 0xD1, 0xED, 0xE7,
-    0x16, 0x02, 0x00, 0x20, 0x36, 0x02, 0x00, 0x20, 0xF0, 0xB5, 0x87, 0xB0, 0x0C, 0x00, 0x07, 0x00,
-    0x16, 0x00, 0x00, 0x21, 0x14, 0x22, 0x01, 0xA8, 0x1D, 0x00, 0x02, 0xF0, 0x97, 0xFA, 0x03, 0x2C,
-    0x09, 0xD1, 0x80, 0x21, 0x15, 0x4B, 0x89, 0x00, 0x9A, 0x69, 0x0A, 0x43, 0x9A, 0x61, 0x9B, 0x69,
-    0x0B, 0x40, 0x00, 0x93, 0x00, 0x9B, 0x90, 0x20, 0x01, 0xA9, 0xC0, 0x05, 0x01, 0x97, 0x02, 0x94,
-    0x03, 0x96, 0x04, 0x95, 0x01, 0xF0, 0x42, 0xFF, 0x03, 0x2C, 0x14, 0xD1, 0x04, 0x21, 0x0C, 0x48,
-    0x0C, 0x4B, 0x41, 0x61, 0xC2, 0x21, 0x01, 0x22, 0x03, 0x60, 0x00, 0x23, 0xFF, 0x31, 0xC1, 0x61,
-    0x41, 0x1D, 0x43, 0x60, 0x83, 0x60, 0xC3, 0x60, 0x02, 0x61, 0x83, 0x61, 0x03, 0x62, 0xCB, 0x77,
-    0x82, 0x62, 0x01, 0xF0, 0xB9, 0xFB, 0x07, 0xB0, 0xF0, 0xBD, 0xC0, 0x46, 0x00, 0x10, 0x02, 0x40,
-    0x50, 0x02, 0x00, 0x20, 0x00, 0x24, 0x01, 0x40, 0xF0, 0xB5, 0x00, 0x24, 0x9F, 0xB0, 0x06, 0x00,
-    0x58, 0x22, 0x0F, 0x00, 0x08, 0xA8, 0x00, 0x21, 0x02, 0xF0, 0x58, 0xFA, 0x10, 0x22, 0x00, 0x21,
-    0x04, 0xA8, 0x02, 0xF0, 0x53, 0xFA, 0x2F, 0x4D, 0x01, 0xA9, 0x2B, 0x68, 0x28, 0x00, 0x9C, 0x62,
-    0x80, 0x23, 0x5B, 0x01, 0x02, 0x93, 0x80, 0x23, 0x5B, 0x05, 0x01, 0x96, 0x03, 0x93, 0x01, 0xF0,
-    0xC9, 0xFC, 0x28, 0x00, 0x01, 0xF0, 0x3E, 0xFD, 0x26, 0x00, 0x28, 0x00, 0x01, 0xF0, 0x2E, 0xFC,
-    0x0A, 0x21, 0x28, 0x00, 0x01, 0xF0, 0x56, 0xFC, 0x28, 0x00, 0x01, 0xF0, 0x31, 0xFD, 0x80, 0x23,
-    0x9B, 0x00, 0x18, 0x42, 0x08, 0xD0, 0x28, 0x00, 0x01, 0xF0, 0xB0, 0xFC, 0x6A, 0x46, 0x20, 0x21,
-    0xA3, 0x00, 0x52, 0x18, 0xD0, 0x50, 0x36, 0x18, 0x01, 0x34, 0x16, 0x2C, 0xE5, 0xD1, 0x08, 0x9B,
-    0x00, 0x22, 0x18, 0x00, 0x6C, 0x46, 0x20, 0x25, 0x91, 0x00, 0x64, 0x19, 0x61, 0x58, 0x8B, 0x42,
-    0x00, 0xD2, 0x0B, 0x00, 0x88, 0x42, 0x00, 0xD9, 0x08, 0x00, 0x01, 0x32, 0x16, 0x2A, 0xF1, 0xD1,
-    0x18, 0x18, 0x14, 0x21, 0x30, 0x1A, 0xFF, 0xF7, 0x5D, 0xFD, 0x03, 0x00, 0x0C, 0x2F, 0x07, 0xD1,
-    0x6A, 0x46, 0x02, 0x21, 0x10, 0x82, 0x04, 0xA8, 0x01, 0xF0, 0x40, 0xF8, 0x1F, 0xB0, 0xF0, 0xBD,
-    0x00, 0x21, 0x08, 0x2F, 0xF7, 0xD1, 0x80, 0x22, 0x52, 0x01, 0x90, 0x42, 0x00, 0xDB, 0x06, 0x4B,
-    0xFF, 0x20, 0x05, 0x49, 0x58, 0x43, 0xFF, 0xF7, 0xCF, 0xFD, 0x6B, 0x46, 0x01, 0x21, 0x18, 0x74,
-    0xE9, 0xE7, 0xC0, 0x46, 0x50, 0x02, 0x00, 0x20, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xB5, 0x8F, 0xB0,
-    0x0E, 0x00, 0x04, 0x00, 0x20, 0x22, 0x00, 0x21, 0x06, 0xA8, 0x02, 0xF0, 0xE7, 0xF9, 0x01, 0x2E,
-    0x00, 0xD8, 0x4A, 0xE1, 0x23, 0x78, 0x07, 0x2B, 0x00, 0xD9, 0x57, 0xE1, 0x08, 0x22, 0xD3, 0x1A,
-    0xDB, 0xB2, 0x01, 0x93, 0xB3, 0x42, 0x02, 0xD3, 0x01, 0x3E, 0xF3, 0xB2, 0x01, 0x93, 0x00, 0x23,
-    0x01, 0x26, 0x00, 0x93, 0x00, 0x9D, 0x2B, 0x00, 0x01, 0x33, 0xE0, 0x5C, 0x00, 0x93, 0x06, 0x28,
-    0x3A, 0xD8, 0xC6, 0x4B, 0x22, 0x78, 0x5B, 0x19, 0x98, 0x54, 0x01, 0x38, 0x23, 0x78, 0x05, 0x28,
-    0x05, 0xD8, 0xC3, 0x4A, 0xFF, 0xF7, 0x04, 0xFD, 0x36, 0x60, 0x68, 0x95, 0xBE, 0xE9, 0x01, 0x27,
-    0x38, 0x00, 0x5B, 0x19, 0x98, 0x40, 0x00, 0x23, 0x3A, 0x00, 0x19, 0x00, 0x80, 0xB2, 0xFF, 0xF7,
-    0x13, 0xFF, 0x38, 0x00, 0x22, 0x78, 0xBA, 0x49, 0x52, 0x19, 0x90, 0x40, 0x0B, 0x78, 0x83, 0x43,
-    0x38, 0x00, 0x0B, 0x70, 0x22, 0x78, 0xB7, 0x49, 0x52, 0x19, 0x90, 0x40, 0x0B, 0x78, 0x83, 0x43,
-    0x38, 0x00, 0x0B, 0x70, 0x22, 0x78, 0xB4, 0x49, 0x52, 0x19, 0x90, 0x40, 0x0B, 0x78, 0xB3, 0x4A,
-    0x83, 0x43, 0x0B, 0x70, 0x23, 0x78, 0x5B, 0x19, 0xD7, 0x54, 0xB1, 0x4B, 0x22, 0x78, 0x5B, 0x19,
-    0x9F, 0x54, 0x00, 0x22, 0xAF, 0x4B, 0x1A, 0x80, 0x00, 0x9B, 0x01, 0x9A, 0x93, 0x42, 0xB9, 0xDB,
-    0x0F, 0xB0, 0xF0, 0xBD, 0x30, 0x00, 0x5B, 0x19, 0x98, 0x40, 0x00, 0x23, 0x01, 0x21, 0x1A, 0x00,
-    0x80, 0xB2, 0xFF, 0xF7, 0xE1, 0xFE, 0x30, 0x00, 0x22, 0x78, 0xA1, 0x49, 0x52, 0x19, 0x90, 0x40,
-    0x0B, 0x78, 0x83, 0x43, 0x30, 0x00, 0x0B, 0x70, 0x22, 0x78, 0x9E, 0x49, 0x52, 0x19, 0x90, 0x40,
-    0x0B, 0x78, 0x83, 0x43, 0x30, 0x00, 0x0B, 0x70, 0x22, 0x78, 0x9B, 0x49, 0x52, 0x19, 0x90, 0x40,
-    0x0B, 0x78, 0x9A, 0x4A, 0x83, 0x43, 0x0B, 0x70, 0x23, 0x78, 0x5B, 0x19, 0xD6, 0x54, 0x98, 0x4B,
-    0x22, 0x78, 0x5B, 0x19, 0x9E, 0x54, 0xCC, 0xE7, 0x30, 0x00, 0x5B, 0x19, 0x98, 0x40, 0x00, 0x23,
-    0x03, 0x21, 0x1A, 0x00, 0x80, 0xB2, 0xD4, 0xE7, 0x30, 0x00, 0x5B, 0x19, 0x98, 0x40, 0x00, 0x22,
-    0x03, 0x23, 0x01, 0x21, 0x80, 0xB2, 0xFF, 0xF7, 0xAF, 0xFE, 0x30, 0x00, 0x22, 0x78, 0x88, 0x49,
-    0x52, 0x19, 0x90, 0x40, 0x0B, 0x78, 0x83, 0x43, 0x30, 0x00, 0x0B, 0x70, 0x22, 0x78, 0x85, 0x49,
-    0x52, 0x19, 0x90, 0x40, 0x0B, 0x78, 0x03, 0x43, 0x30, 0x00, 0xDB, 0xB2, 0x0B, 0x70, 0x22, 0x78,
-    0x81, 0x49, 0x52, 0x19, 0x90, 0x40, 0x00, 0x22, 0x0B, 0x78, 0x83, 0x43, 0x0B, 0x70, 0x23, 0x78,
-    0x7E, 0x49, 0x5B, 0x19, 0xCA, 0x54, 0x7E, 0x4B, 0x21, 0x78, 0x5B, 0x19, 0x5E, 0x54, 0x7D, 0x4B,
-    0x99, 0xE7, 0x01, 0x21, 0x0F, 0x00, 0x5B, 0x19, 0x9F, 0x40, 0x10, 0x78, 0xB8, 0x43, 0x0F, 0x00,
-    0x10, 0x70, 0x22, 0x78, 0x73, 0x48, 0x52, 0x19, 0x97, 0x40, 0x03, 0x78, 0xBB, 0x43, 0x0F, 0x00,
-    0x03, 0x70, 0x22, 0x78, 0x70, 0x48, 0x52, 0x19, 0x97, 0x40, 0x03, 0x78, 0x6F, 0x4A, 0xBB, 0x43,
-    0x03, 0x70, 0x08, 0x00, 0x23, 0x78, 0x5B, 0x19, 0xD1, 0x54, 0x6D, 0x4B, 0x22, 0x78, 0x5B, 0x19,
-    0x99, 0x54, 0x23, 0x78, 0x00, 0x22, 0x5B, 0x19, 0x98, 0x40, 0x0B, 0x00, 0x80, 0xB2, 0xFF, 0xF7,
-    0x63, 0xFE, 0x71, 0xE7, 0x01, 0x21, 0x0F, 0x00, 0x5B, 0x19, 0x9F, 0x40, 0x3B, 0x00, 0x0F, 0x00,
-    0x10, 0x78, 0x03, 0x43, 0xDB, 0xB2, 0x13, 0x70, 0x22, 0x78, 0x5E, 0x48, 0x52, 0x19, 0x97, 0x40,
-    0x03, 0x78, 0xBB, 0x43, 0x0F, 0x00, 0x03, 0x70, 0x22, 0x78, 0x5B, 0x48, 0x52, 0x19, 0x97, 0x40,
-    0x03, 0x78, 0x5A, 0x4A, 0xBB, 0x43, 0x03, 0x70, 0x23, 0x78, 0x5B, 0x19, 0xD1, 0x54, 0x00, 0x22,
-    0x57, 0x4B, 0x20, 0x78, 0x5B, 0x19, 0x1A, 0x54, 0x08, 0x00, 0x56, 0x4B, 0x1A, 0x80, 0x23, 0x78,
-    0x5B, 0x19, 0x98, 0x40, 0x03, 0x23, 0x80, 0xB2, 0xD1, 0xE7, 0x30, 0x00, 0x5B, 0x19, 0x98, 0x40,
-    0x01, 0x22, 0x03, 0x23, 0x00, 0x21, 0x80, 0xB2, 0xFF, 0xF7, 0x2E, 0xFE, 0x30, 0x00, 0x22, 0x78,
-    0x47, 0x49, 0x52, 0x19, 0x90, 0x40, 0x0B, 0x78, 0x83, 0x43, 0x30, 0x00, 0x0B, 0x70, 0x22, 0x78,
-    0x44, 0x49, 0x52, 0x19, 0x90, 0x40, 0x0B, 0x78, 0x83, 0x43, 0x30, 0x00, 0x0B, 0x70, 0x22, 0x78,
-    0x41, 0x49, 0x52, 0x19, 0x90, 0x40, 0x0B, 0x78, 0x40, 0x4A, 0x03, 0x43, 0xDB, 0xB2, 0x0B, 0x70,
-    0x23, 0x78, 0x30, 0x00, 0x5B, 0x19, 0xD6, 0x54, 0x3D, 0x4B, 0x22, 0x78, 0x5B, 0x19, 0x9E, 0x54,
-    0x00, 0x22, 0x3C, 0x4B, 0x3C, 0x49, 0x1A, 0x80, 0x23, 0x78, 0x5B, 0x19, 0x5B, 0x00, 0x5A, 0x52,
-    0x23, 0x78, 0x3A, 0x49, 0x5B, 0x19, 0x5B, 0x00, 0x5A, 0x52, 0x22, 0x78, 0x38, 0x49, 0x52, 0x19,
-    0x90, 0x40, 0x0B, 0x78, 0x83, 0x43, 0x0B, 0x70, 0x06, 0xE7, 0x01, 0x2E, 0x00, 0xD0, 0x07, 0xE7,
-    0x25, 0x78, 0x07, 0x2D, 0x66, 0xD8, 0x08, 0x24, 0x28, 0x49, 0x22, 0x00, 0x06, 0xA8, 0x02, 0xF0,
-    0xD3, 0xF8, 0x61, 0x1B, 0x89, 0xB2, 0x06, 0xAB, 0x58, 0x19, 0x81, 0xE0, 0x1A, 0x00, 0x10, 0x3A,
-    0xD2, 0xB2, 0x07, 0x2A, 0x27, 0xD8, 0x08, 0x25, 0xAD, 0x1A, 0xED, 0xB2, 0xB5, 0x42, 0x01, 0xD3,
-    0x01, 0x3E, 0xF5, 0xB2, 0x90, 0x27, 0x00, 0x26, 0xFF, 0x05, 0x23, 0x78, 0x1B, 0x4A, 0x30, 0x00,
-    0xD2, 0x18, 0x92, 0x19, 0x10, 0x3A, 0x11, 0x78, 0x01, 0x36, 0x01, 0x29, 0x0C, 0xD1, 0xA2, 0x5D,
-    0x00, 0x2A, 0x0C, 0xD0, 0x01, 0x2A, 0x07, 0xD1, 0x11, 0x00, 0x18, 0x18, 0x10, 0x38, 0x81, 0x40,
-    0x38, 0x00, 0x89, 0xB2, 0x01, 0xF0, 0xE0, 0xFD, 0xB5, 0x42, 0xE6, 0xDC, 0xD0, 0xE6, 0x1B, 0x18,
-    0x10, 0x3B, 0x99, 0x40, 0xF4, 0xE7, 0x18, 0x2B, 0x70, 0xD1, 0x90, 0x26, 0x00, 0x25, 0xF6, 0x05,
-    0x0A, 0x4B, 0x5B, 0x5D, 0x01, 0x2B, 0x0C, 0xD1, 0x60, 0x78, 0x19, 0x00, 0x28, 0x41, 0xA9, 0x40,
-    0x02, 0x00, 0x89, 0xB2, 0x1A, 0x40, 0x18, 0x42, 0x00, 0xD0, 0x1A, 0x00, 0x30, 0x00, 0x01, 0xF0,
-    0xC3, 0xFD, 0x01, 0x35, 0x08, 0x2D, 0xEB, 0xD1, 0xB2, 0xE6, 0xC0, 0x46, 0xD2, 0x01, 0x00, 0x20,
-    0xD1, 0x01, 0x00, 0x20, 0xD0, 0x01, 0x00, 0x20, 0xBE, 0x01, 0x00, 0x20, 0xF6, 0x01, 0x00, 0x20,
-    0xDE, 0x01, 0x00, 0x20, 0xDC, 0x01, 0x00, 0x20, 0xAE, 0x01, 0x00, 0x20, 0x9E, 0x01, 0x00, 0x20,
-    0x9C, 0x01, 0x00, 0x20, 0x2B, 0x00, 0x20, 0x3B, 0x08, 0x2B, 0x24, 0xD8, 0x00, 0x25, 0xCB, 0x4F,
-    0x3D, 0x70, 0x31, 0x00, 0x90, 0x20, 0xA9, 0x40, 0xC0, 0x05, 0x89, 0xB2, 0x01, 0xF0, 0x96, 0xFD,
-    0xC7, 0x49, 0x3B, 0x78, 0x48, 0x55, 0xA8, 0x40, 0x03, 0x43, 0xDB, 0xB2, 0x01, 0x35, 0x3B, 0x70,
-    0x08, 0x2D, 0xEE, 0xD1, 0x2A, 0x00, 0x06, 0xA8, 0x02, 0xF0, 0x56, 0xF8, 0x29, 0x21, 0x3B, 0x78,
-    0x02, 0xAA, 0x13, 0x76, 0x23, 0x78, 0x06, 0xAA, 0xC9, 0x1A, 0x20, 0x3B, 0x89, 0xB2, 0xD0, 0x18,
-    0x00, 0xF0, 0x3C, 0xFE, 0x74, 0xE6, 0x28, 0x00, 0x30, 0x38, 0xC0, 0xB2, 0x07, 0x28, 0x08, 0xD8,
-    0xB8, 0x4B, 0x08, 0x21, 0x1B, 0x5C, 0x02, 0x2B, 0x00, 0xD0, 0x69, 0xE6, 0xFF, 0xF7, 0x94, 0xFD,
-    0x66, 0xE6, 0x28, 0x00, 0x40, 0x38, 0xC3, 0xB2, 0x0F, 0x2B, 0x1F, 0xD8, 0xB1, 0x4B, 0x40, 0x10,
-    0x1B, 0x5C, 0x02, 0x2B, 0x00, 0xD0, 0x5B, 0xE6, 0x0C, 0x21, 0xEF, 0xE7, 0x1A, 0x00, 0x50, 0x3A,
-    0xD2, 0xB2, 0x07, 0x2A, 0x22, 0xD8, 0x08, 0x25, 0xAD, 0x1A, 0xED, 0xB2, 0xB5, 0x42, 0x01, 0xD3,
-    0x01, 0x3E, 0xF5, 0xB2, 0x00, 0x26, 0x20, 0x78, 0x50, 0x38, 0x80, 0x19, 0x01, 0x36, 0xA1, 0x5D,
-    0xC0, 0xB2, 0x00, 0xF0, 0x29, 0xFC, 0xAE, 0x42, 0xF5, 0xDB, 0x41, 0xE6, 0x2C, 0x00, 0x50, 0x3C,
-    0xE3, 0xB2, 0x07, 0x2B, 0x31, 0xD8, 0xA0, 0x49, 0x08, 0x22, 0x06, 0xA8, 0x02, 0xF0, 0x0C, 0xF8,
-    0x58, 0x21, 0x49, 0x1B, 0x06, 0xAB, 0x89, 0xB2, 0x18, 0x19, 0xB9, 0xE7, 0x1A, 0x00, 0x60, 0x3A,
-    0xD1, 0xB2, 0x0F, 0x29, 0x2D, 0xD8, 0x08, 0x23, 0x52, 0x10, 0x01, 0x3E, 0x9B, 0x1A, 0x76, 0x10,
-    0x1D, 0x1C, 0xF2, 0xB2, 0xDB, 0xB2, 0x93, 0x42, 0x00, 0xD9, 0x35, 0x1C, 0x26, 0x00, 0xED, 0xB2,
-    0x6D, 0x00, 0x65, 0x19, 0xB5, 0x42, 0x00, 0xD1, 0x1A, 0xE6, 0xB3, 0x78, 0x71, 0x78, 0x1B, 0x02,
-    0x19, 0x43, 0x23, 0x78, 0x32, 0x1B, 0x9B, 0x18, 0x60, 0x3B, 0xD8, 0x0F, 0xC0, 0x18, 0x40, 0x10,
-    0xC0, 0xB2, 0x00, 0xF0, 0x09, 0xFC, 0x02, 0x36, 0xEC, 0xE7, 0x2C, 0x00, 0x60, 0x3C, 0xE3, 0xB2,
-    0x0F, 0x2B, 0x3C, 0xD8, 0x85, 0x49, 0x10, 0x22, 0x06, 0xA8, 0x01, 0xF0, 0xD5, 0xFF, 0x70, 0x21,
-    0xC7, 0xE7, 0x18, 0x00, 0x70, 0x38, 0xC0, 0xB2, 0x17, 0x28, 0x53, 0xD8, 0x03, 0x21, 0xFF, 0xF7,
-    0xD1, 0xFA, 0x08, 0x25, 0x03, 0x21, 0x2D, 0x1A, 0x70, 0x1E, 0xFF, 0xF7, 0x55, 0xFB, 0x2B, 0x1C,
-    0xC2, 0xB2, 0xED, 0xB2, 0x95, 0x42, 0x00, 0xD9, 0x03, 0x1C, 0x03, 0x22, 0x25, 0x00, 0x01, 0x27,
-    0xDB, 0xB2, 0x53, 0x43, 0xE3, 0x18, 0x00, 0x93, 0x00, 0x9B, 0xAB, 0x42, 0x00, 0xD1, 0xDF, 0xE5,
-    0x6E, 0x78, 0xAB, 0x78, 0x36, 0x06, 0x1B, 0x04, 0x1E, 0x43, 0xEB, 0x78, 0x20, 0x78, 0x1B, 0x02,
-    0x1E, 0x43, 0x2B, 0x1B, 0xC0, 0x18, 0x03, 0x21, 0x70, 0x38, 0xFF, 0xF7, 0x35, 0xFB, 0x31, 0x00,
-    0xC0, 0xB2, 0x00, 0xF0, 0x79, 0xFF, 0x6A, 0x4B, 0x03, 0x35, 0x1F, 0x70, 0xE4, 0xE7, 0x2F, 0x00,
-    0x70, 0x3F, 0xFB, 0xB2, 0x1F, 0x2B, 0x35, 0xD8, 0x00, 0x26, 0x66, 0x4B, 0x06, 0xAC, 0x1B, 0x68,
-    0x00, 0x93, 0x30, 0x00, 0x03, 0x21, 0xFF, 0xF7, 0x1F, 0xFB, 0x00, 0x9B, 0x80, 0x00, 0x18, 0x18,
-    0x03, 0x68, 0x03, 0x36, 0x1B, 0x0A, 0x23, 0x70, 0x03, 0x68, 0x1B, 0x0C, 0x63, 0x70, 0x03, 0x68,
-    0xA3, 0x70, 0x03, 0x34, 0x18, 0x2E, 0xEC, 0xD1, 0x90, 0x21, 0x06, 0xAB, 0x49, 0x1B, 0x89, 0xB2,
-    0xD8, 0x19, 0x2D, 0xE7, 0x1A, 0x00, 0x70, 0x32, 0xD2, 0xB2, 0x07, 0x2A, 0x32, 0xD8, 0x08, 0x25,
-    0xAD, 0x1A, 0xED, 0xB2, 0xB5, 0x42, 0x01, 0xD3, 0x01, 0x3E, 0xF5, 0xB2, 0x00, 0x26, 0x20, 0x78,
-    0x70, 0x30, 0x80, 0x19, 0x01, 0x36, 0xA1, 0x5D, 0xC0, 0xB2, 0x00, 0xF0, 0x9B, 0xFB, 0xAE, 0x42,
-    0xF5, 0xDB, 0x8D, 0xE5, 0x2B, 0x00, 0x70, 0x33, 0xDB, 0xB2, 0x07, 0x2B, 0x4B, 0xD8, 0x00, 0x24,
-    0x49, 0x4B, 0x4A, 0x4F, 0x4A, 0x4E, 0x00, 0x93, 0x62, 0x00, 0xB0, 0x5A, 0x64, 0x22, 0x3B, 0x78,
-    0x50, 0x43, 0x00, 0x9A, 0x5B, 0x00, 0x99, 0x5A, 0xFF, 0xF7, 0xDE, 0xFA, 0x10, 0x22, 0x02, 0xAB,
-    0x9B, 0x18, 0x18, 0x55, 0x01, 0x34, 0x08, 0x2C, 0xEE, 0xD1, 0x98, 0x21, 0x49, 0x1B, 0x89, 0xB2,
-    0x90, 0x3D, 0x70, 0xE6, 0xA0, 0x2B, 0x4B, 0xD1, 0x67, 0x78, 0x05, 0x2F, 0x00, 0xD9, 0x67, 0xE5,
-    0x00, 0x24, 0x08, 0x22, 0x00, 0x21, 0x02, 0xA8, 0x01, 0xF0, 0xF0, 0xFE, 0x37, 0x4D, 0x38, 0x4E,
-    0x62, 0x00, 0xB0, 0x5A, 0x64, 0x22, 0x2B, 0x78, 0x50, 0x43, 0x33, 0x4A, 0x5B, 0x00, 0x99, 0x5A,
-    0x00, 0x92, 0xFF, 0xF7, 0xB9, 0xFA, 0x02, 0xAB, 0x18, 0x55, 0x01, 0x34, 0x08, 0x2C, 0xEF, 0xD1,
-    0x00, 0x24, 0x2F, 0x70, 0x2B, 0x78, 0x00, 0x99, 0x5B, 0x00, 0x02, 0xAA, 0x12, 0x5D, 0xC8, 0x5A,
-    0x64, 0x21, 0x50, 0x43, 0xFF, 0xF7, 0xA8, 0xFA, 0x67, 0x00, 0xF7, 0x19, 0x01, 0x34, 0x38, 0x80,
-    0x08, 0x2C, 0xEF, 0xD1, 0x3C, 0xE5, 0x25, 0x48, 0xA0, 0x2D, 0x34, 0xD0, 0xAF, 0x2D, 0x00, 0xD8,
-    0x36, 0xE5, 0xBF, 0x2D, 0x25, 0xD8, 0x02, 0xAB, 0x00, 0x22, 0x18, 0x00, 0x50, 0x35, 0x21, 0x4C,
-    0xED, 0xB2, 0x51, 0x00, 0x0E, 0x5B, 0x09, 0x5B, 0x01, 0x32, 0x09, 0x0A, 0x1E, 0x70, 0x59, 0x70,
-    0x02, 0x33, 0x08, 0x2A, 0xF5, 0xD1, 0x10, 0x21, 0x49, 0x1B, 0x89, 0xB2, 0x40, 0x19, 0xA7, 0xE6,
-    0xFF, 0x2B, 0x39, 0xD1, 0x02, 0x2E, 0x00, 0xD0, 0x1A, 0xE5, 0x01, 0x23, 0xE3, 0x56, 0x62, 0x78,
-    0x00, 0x2B, 0x00, 0xDC, 0x14, 0xE5, 0x14, 0x4B, 0x1A, 0x70, 0x01, 0x22, 0x13, 0x4B, 0x1A, 0x70,
-    0x0E, 0xE5, 0x13, 0x48, 0xC0, 0x2D, 0x06, 0xD0, 0x0F, 0x48, 0xFF, 0x2D, 0x03, 0xD0, 0xFE, 0x2D,
-    0x00, 0xD0, 0x05, 0xE5, 0x0F, 0x48, 0x01, 0x21, 0x8A, 0xE6, 0xC0, 0x46, 0xC7, 0x01, 0x00, 0x20,
-    0xBF, 0x01, 0x00, 0x20, 0xD2, 0x01, 0x00, 0x20, 0xFE, 0x01, 0x00, 0x20, 0x06, 0x02, 0x00, 0x20,
-    0x94, 0x01, 0x00, 0x20, 0xE8, 0x07, 0x00, 0x20, 0xC2, 0x00, 0x00, 0x20, 0xC0, 0x00, 0x00, 0x20,
-    0xE6, 0x01, 0x00, 0x20, 0x9E, 0x01, 0x00, 0x20, 0x36, 0x02, 0x00, 0x20, 0x95, 0x01, 0x00, 0x20,
-    0xCE, 0x00, 0x00, 0x20, 0xCF, 0x00, 0x00, 0x20, 0x02, 0x2E, 0x09, 0xD1, 0xC0, 0x2B, 0x07, 0xD1,
-    0x63, 0x78, 0x5A, 0x1E, 0x07, 0x2A, 0x00, 0xD9, 0xDA, 0xE4, 0x06, 0x4A, 0x13, 0x70, 0xD7, 0xE4,
-    0xFD, 0x2B, 0x00, 0xD0, 0xD4, 0xE4, 0x63, 0x78, 0x01, 0x2B, 0x00, 0xD0, 0xD0, 0xE4, 0x02, 0x4A,
-    0xF4, 0xE7, 0xC0, 0x46, 0xCE, 0x00, 0x00, 0x20, 0x8C, 0x01, 0x00, 0x20, 0x10, 0xB5, 0x72, 0xB6,
-    0x01, 0xF0, 0xD2, 0xF9, 0xFC, 0xE7, 0x00, 0x00, 0xF8, 0xB5, 0x01, 0x25, 0xFA, 0x27, 0x00, 0x26,
-    0x44, 0x4C, 0xFF, 0x01, 0x23, 0x68, 0xAB, 0x43, 0x2B, 0x43, 0x23, 0x60, 0x23, 0x68, 0x2B, 0x42,
-    0x59, 0xD0, 0x41, 0x4C, 0xFA, 0x27, 0x23, 0x68, 0x02, 0x26, 0x1D, 0x43, 0x25, 0x60, 0x00, 0x25,
-    0xFF, 0x01, 0x23, 0x68, 0x33, 0x42, 0x54, 0xD0, 0xF8, 0x23, 0x22, 0x68, 0xFA, 0x27, 0x9A, 0x43,
-    0x78, 0x3B, 0x13, 0x43, 0x23, 0x60, 0x01, 0x23, 0x00, 0x25, 0x02, 0x26, 0x62, 0x6B, 0xFF, 0x01,
-    0x13, 0x43, 0x63, 0x63, 0x63, 0x6B, 0x33, 0x42, 0x49, 0xD0, 0xF8, 0x23, 0x62, 0x6B, 0x80, 0x26,
-    0x9A, 0x43, 0x78, 0x3B, 0x13, 0x43, 0x63, 0x63, 0x62, 0x68, 0x30, 0x4B, 0xFA, 0x27, 0x1A, 0x40,
-    0xA0, 0x23, 0x9B, 0x03, 0x13, 0x43, 0x0F, 0x22, 0x63, 0x60, 0xE3, 0x6A, 0x00, 0x25, 0x93, 0x43,
-    0xE3, 0x62, 0x80, 0x23, 0x22, 0x68, 0x5B, 0x04, 0x13, 0x43, 0x23, 0x60, 0xB6, 0x04, 0xFF, 0x01,
-    0x23, 0x68, 0x33, 0x42, 0x31, 0xD0, 0xF0, 0x22, 0x63, 0x68, 0xFA, 0x27, 0x93, 0x43, 0x63, 0x60,
-    0x63, 0x68, 0x23, 0x4A, 0x00, 0x25, 0x13, 0x40, 0x63, 0x60, 0x03, 0x23, 0x0C, 0x26, 0x62, 0x68,
-    0xFF, 0x01, 0x9A, 0x43, 0x01, 0x3B, 0x13, 0x43, 0x63, 0x60, 0x63, 0x68, 0x33, 0x40, 0x08, 0x2B,
-    0x21, 0xD1, 0x1C, 0x48, 0x01, 0xF0, 0xD8, 0xFC, 0x03, 0x20, 0x00, 0xF0, 0x95, 0xFE, 0x00, 0x28,
-    0x1F, 0xD0, 0xFF, 0xF7, 0x93, 0xFF, 0x01, 0x36, 0xBE, 0x42, 0x9F, 0xD9, 0x01, 0xF0, 0x64, 0xF9,
-    0x9C, 0xE7, 0x01, 0x35, 0xBD, 0x42, 0xA4, 0xD9, 0x01, 0xF0, 0x5E, 0xF9, 0xA1, 0xE7, 0x01, 0x35,
-    0xBD, 0x42, 0xAF, 0xD9, 0x01, 0xF0, 0x58, 0xF9, 0xAC, 0xE7, 0x01, 0x35, 0xBD, 0x42, 0xC7, 0xD9,
-    0x01, 0xF0, 0x52, 0xF9, 0xC4, 0xE7, 0x01, 0x35, 0xBD, 0x42, 0xD6, 0xD9, 0x01, 0xF0, 0x4C, 0xF9,
-    0xD3, 0xE7, 0x04, 0x22, 0x63, 0x6B, 0x93, 0x43, 0x63, 0x63, 0x23, 0x6B, 0x0C, 0x32, 0x93, 0x43,
-    0x23, 0x63, 0xF8, 0xBD, 0x00, 0x20, 0x02, 0x40, 0x00, 0x10, 0x02, 0x40, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x6C, 0xDC, 0x02, 0xF0, 0xB5, 0x87, 0xB0, 0xFF, 0xF7, 0xD0, 0xFA,
-    0x00, 0xF0, 0x7E, 0xFE, 0xFF, 0xF7, 0x60, 0xFF, 0x00, 0xF0, 0x16, 0xFB, 0x00, 0xF0, 0x2A, 0xFD,
-    0x00, 0xF0, 0x42, 0xFD, 0xCA, 0x4D, 0x20, 0x21, 0x28, 0x00, 0x00, 0xF0, 0x89, 0xFA, 0xC9, 0x4B,
-    0x04, 0x1E, 0x45, 0xD1, 0x45, 0x22, 0x1A, 0x70, 0x2A, 0x70, 0x20, 0x21, 0x28, 0x00, 0x00, 0xF0,
-    0x9D, 0xFA, 0x00, 0x28, 0x36, 0xD0, 0x00, 0xF0, 0xD1, 0xF9, 0x08, 0x20, 0x00, 0xF0, 0xA6, 0xFD,
-    0xC1, 0x4B, 0x18, 0x00, 0x02, 0x93, 0x01, 0xF0, 0x41, 0xFB, 0xC0, 0x4B, 0x18, 0x00, 0x03, 0x93,
-    0x01, 0xF0, 0x3C, 0xFB, 0x00, 0xF0, 0x0C, 0xFB, 0x00, 0xF0, 0x94, 0xFB, 0xBC, 0x4B, 0x1B, 0x78,
-    0xD9, 0xB2, 0x00, 0x2B, 0x27, 0xD0, 0xBB, 0x4C, 0x20, 0x00, 0x01, 0xF0, 0x13, 0xFC, 0x63, 0x68,
-    0xB9, 0x4A, 0x02, 0x98, 0x13, 0x40, 0x01, 0x22, 0x63, 0x60, 0x23, 0x68, 0x93, 0x43, 0x23, 0x60,
-    0x23, 0x68, 0x07, 0x32, 0x93, 0x43, 0x23, 0x60, 0x01, 0xF0, 0xF4, 0xFA, 0x03, 0x98, 0x01, 0xF0,
-    0xF1, 0xFA, 0xBF, 0xF3, 0x4F, 0x8F, 0xB1, 0x4B, 0xB1, 0x4A, 0xDA, 0x60, 0xBF, 0xF3, 0x4F, 0x8F,
-    0xC0, 0x46, 0xFD, 0xE7, 0x01, 0x34, 0x14, 0x2C, 0xBF, 0xD9, 0x01, 0xF0, 0xDD, 0xF8, 0xBC, 0xE7,
-    0x2A, 0x78, 0x1A, 0x70, 0xBF, 0xE7, 0xAB, 0x4B, 0x19, 0x60, 0x01, 0x93, 0xAA, 0x4B, 0x1B, 0x78,
-    0x00, 0x2B, 0x28, 0xD0, 0xA9, 0x4B, 0xAA, 0x48, 0x44, 0x6A, 0x1A, 0x78, 0xA9, 0x4B, 0x52, 0x00,
-    0xD3, 0x5A, 0x9C, 0x42, 0x00, 0xD3, 0x41, 0x62, 0xA7, 0x4C, 0x00, 0x22, 0xA4, 0x46, 0xA7, 0x49,
-    0xA7, 0x4B, 0xA1, 0x4F, 0x3C, 0x78, 0x01, 0x25, 0x14, 0x41, 0x2C, 0x42, 0x0E, 0xD0, 0x64, 0x46,
-    0xA4, 0x5C, 0x00, 0x2C, 0x0A, 0xD1, 0xA3, 0x4D, 0x54, 0x00, 0x2C, 0x5B, 0x00, 0x2C, 0x00, 0xD0,
-    0xE9, 0xE0, 0x90, 0x26, 0x8D, 0x88, 0xF6, 0x05, 0xB5, 0x62, 0x1C, 0x70, 0x01, 0x32, 0x08, 0x31,
-    0x01, 0x33, 0x08, 0x2A, 0xE6, 0xD1, 0x9C, 0x4B, 0x1B, 0x78, 0x00, 0x2B, 0x28, 0xD0, 0x9B, 0x48,
-    0x9B, 0x4B, 0x42, 0x6A, 0x9A, 0x42, 0x01, 0xD9, 0x00, 0x23, 0x43, 0x62, 0x00, 0x23, 0x9C, 0x46,
-    0x92, 0x49, 0x93, 0x4A, 0x97, 0x4C, 0x66, 0x46, 0x01, 0x9D, 0x2E, 0x60, 0x5D, 0x00, 0x47, 0x6A,
-    0x2E, 0x5B, 0xB7, 0x42, 0x00, 0xD9, 0xE0, 0xE0, 0x16, 0x78, 0x00, 0x2E, 0x00, 0xD0, 0xDC, 0xE0,
-    0x91, 0x4E, 0xF6, 0x5C, 0x00, 0x2E, 0x00, 0xD0, 0xD7, 0xE0, 0x90, 0x26, 0x8D, 0x88, 0xF6, 0x05,
-    0xB5, 0x61, 0x01, 0x25, 0x15, 0x70, 0x01, 0x33, 0x08, 0x31, 0x01, 0x32, 0x08, 0x2B, 0xE2, 0xD1,
-    0x8A, 0x4E, 0x33, 0x78, 0x00, 0x2B, 0x52, 0xD0, 0x00, 0xF0, 0xDE, 0xFD, 0x88, 0x4B, 0x04, 0x00,
-    0x1A, 0x68, 0x00, 0x2A, 0x00, 0xD1, 0x18, 0x60, 0x90, 0x23, 0xDB, 0x05, 0x1A, 0x69, 0x00, 0x23,
-    0x84, 0x4D, 0x85, 0x49, 0xD2, 0xB2, 0x30, 0x78, 0x01, 0x27, 0x18, 0x41, 0x38, 0x42, 0x0E, 0xD0,
-    0x38, 0x00, 0x98, 0x40, 0xC7, 0xB2, 0x04, 0x97, 0x2F, 0x78, 0x38, 0x42, 0x07, 0xD0, 0x04, 0x98,
-    0x10, 0x42, 0x04, 0xD1, 0x5F, 0x00, 0x78, 0x5A, 0x01, 0x30, 0x80, 0xB2, 0x78, 0x52, 0x01, 0x33,
-    0x08, 0x2B, 0xE8, 0xD1, 0x77, 0x4B, 0x1A, 0x70, 0xFA, 0x22, 0x75, 0x4B, 0x52, 0x00, 0x1B, 0x68,
-    0xE3, 0x1A, 0x93, 0x42, 0x23, 0xD3, 0x00, 0x25, 0x74, 0x4A, 0x12, 0x78, 0x53, 0x43, 0x04, 0x93,
-    0x71, 0x4B, 0x05, 0x93, 0x33, 0x78, 0x01, 0x22, 0x2B, 0x41, 0x13, 0x42, 0x12, 0xD0, 0x05, 0x9B,
-    0x6F, 0x00, 0xF8, 0x5A, 0x6E, 0x4B, 0x04, 0x99, 0x58, 0x43, 0xFF, 0xF7, 0x03, 0xF8, 0x80, 0x23,
-    0x5B, 0x02, 0x98, 0x42, 0x00, 0xD3, 0x6B, 0x48, 0x00, 0x22, 0x6B, 0x4B, 0x80, 0xB2, 0xD8, 0x53,
-    0x65, 0x4B, 0xDA, 0x53, 0x01, 0x35, 0x08, 0x2D, 0xE4, 0xD1, 0x61, 0x4B, 0x1C, 0x60, 0x67, 0x4E,
-    0x67, 0x4D, 0x33, 0x68, 0x00, 0x2B, 0x0C, 0xD0, 0x00, 0xF0, 0x86, 0xFD, 0x65, 0x4C, 0x23, 0x68,
-    0x98, 0x42, 0x06, 0xD9, 0x2B, 0x68, 0x01, 0x33, 0x2B, 0x60, 0x00, 0xF0, 0x7D, 0xFD, 0x0A, 0x30,
-    0x20, 0x60, 0x2B, 0x68, 0x32, 0x2B, 0x1A, 0xD9, 0x42, 0x4C, 0x20, 0x00, 0x01, 0xF0, 0x22, 0xFB,
-    0x63, 0x68, 0x41, 0x4A, 0x13, 0x40, 0x01, 0x22, 0x63, 0x60, 0x23, 0x68, 0x93, 0x43, 0x23, 0x60,
-    0x23, 0x68, 0x07, 0x32, 0x93, 0x43, 0x23, 0x60, 0x00, 0xF0, 0x02, 0xFA, 0x00, 0xF0, 0x8A, 0xFA,
-    0xFA, 0x20, 0x40, 0x00, 0x00, 0xF0, 0x66, 0xFD, 0x00, 0x23, 0x33, 0x60, 0x2B, 0x60, 0x52, 0x4D,
-    0x2B, 0x78, 0x00, 0x2B, 0x16, 0xD0, 0x00, 0x24, 0x00, 0x23, 0x01, 0x9A, 0x13, 0x60, 0x4F, 0x4B,
-    0x1B, 0x5D, 0x04, 0x2B, 0x09, 0xD1, 0x03, 0x3B, 0xA3, 0x40, 0x4D, 0x4A, 0x9B, 0xB2, 0x13, 0x80,
-    0x4C, 0x4A, 0xE3, 0xB2, 0x13, 0x70, 0x00, 0xF0, 0xF5, 0xFC, 0x01, 0x34, 0x08, 0x2C, 0xEB, 0xD1,
-    0x00, 0x23, 0x2B, 0x70, 0x48, 0x4D, 0x2B, 0x78, 0x00, 0x2B, 0x00, 0xD1, 0xCE, 0xE6, 0x72, 0xB6,
-    0x00, 0xF0, 0xD6, 0xF9, 0x15, 0x24, 0xFF, 0xF7, 0x91, 0xF9, 0x00, 0x28, 0x32, 0xD0, 0x62, 0xB6,
-    0x00, 0x23, 0x2B, 0x70, 0xC2, 0xE6, 0x45, 0x6A, 0xA5, 0x42, 0x08, 0xD8, 0x1D, 0x78, 0x00, 0x2D,
-    0x05, 0xD1, 0x90, 0x25, 0x8C, 0x88, 0xED, 0x05, 0xAC, 0x61, 0x01, 0x24, 0x0D, 0xE7, 0x45, 0x6A,
-    0xAC, 0x42, 0x00, 0xD3, 0x0A, 0xE7, 0x1C, 0x78, 0x01, 0x2C, 0x00, 0xD0, 0x06, 0xE7, 0x90, 0x24,
-    0x8D, 0x88, 0xE4, 0x05, 0xA5, 0x62, 0x00, 0x24, 0xFF, 0xE6, 0x46, 0x6A, 0x65, 0x5B, 0xAE, 0x42,
-    0x00, 0xD8, 0x28, 0xE7, 0x15, 0x78, 0x01, 0x2D, 0x00, 0xD0, 0x24, 0xE7, 0x1E, 0x4D, 0xED, 0x5C,
-    0xEE, 0xB2, 0x00, 0x2D, 0x00, 0xD0, 0x1E, 0xE7, 0x90, 0x27, 0x8D, 0x88, 0xFF, 0x05, 0xBD, 0x62,
-    0x16, 0x70, 0x18, 0xE7, 0x01, 0x3C, 0x00, 0x2C, 0xC5, 0xD1, 0x00, 0xF0, 0x95, 0xFF, 0xC1, 0xE7,
-    0x16, 0x02, 0x00, 0x20, 0x36, 0x02, 0x00, 0x20, 0xA0, 0x07, 0x00, 0x20, 0x58, 0x07, 0x00, 0x20,
-    0x8C, 0x01, 0x00, 0x20, 0x00, 0x54, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xED, 0x00, 0xE0,
-    0x04, 0x00, 0xFA, 0x05, 0x98, 0x02, 0x00, 0x20, 0xD1, 0x01, 0x00, 0x20, 0xC0, 0x00, 0x00, 0x20,
-    0x00, 0x44, 0x01, 0x40, 0xC2, 0x00, 0x00, 0x20, 0xDE, 0x01, 0x00, 0x20, 0xD0, 0x00, 0x00, 0x20,
-    0xC8, 0x01, 0x00, 0x20, 0xE6, 0x01, 0x00, 0x20, 0xD0, 0x01, 0x00, 0x20, 0x00, 0x48, 0x01, 0x40,
-    0x1F, 0x4E, 0x00, 0x00, 0x06, 0x02, 0x00, 0x20, 0xF6, 0x01, 0x00, 0x20, 0xBE, 0x01, 0x00, 0x20,
-    0x98, 0x01, 0x00, 0x20, 0x9C, 0x01, 0x00, 0x20, 0xAE, 0x01, 0x00, 0x20, 0xCE, 0x00, 0x00, 0x20,
-    0x60, 0xEA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x9E, 0x01, 0x00, 0x20, 0x94, 0x02, 0x00, 0x20,
-    0x90, 0x02, 0x00, 0x20, 0x90, 0x01, 0x00, 0x20, 0x94, 0x01, 0x00, 0x20, 0xD2, 0x01, 0x00, 0x20,
-    0xDC, 0x01, 0x00, 0x20, 0xDA, 0x01, 0x00, 0x20, 0x95, 0x01, 0x00, 0x20, 0x01, 0x22, 0x70, 0xB5,
-    0x00, 0x23, 0xFF, 0x24, 0x07, 0x4E, 0x08, 0x4D, 0x52, 0x42, 0x08, 0x49, 0x58, 0x00, 0xF4, 0x54,
-    0xEC, 0x54, 0x42, 0x52, 0x06, 0x49, 0x0A, 0x52, 0x06, 0x49, 0xCA, 0x54, 0x01, 0x33, 0x08, 0x2B,
-    0xF3, 0xD1, 0x70, 0xBD, 0xFE, 0x01, 0x00, 0x20, 0x48, 0x02, 0x00, 0x20, 0x06, 0x02, 0x00, 0x20,
-    0x38, 0x02, 0x00, 0x20, 0xF6, 0x01, 0x00, 0x20, 0x10, 0xB5, 0x04, 0x00, 0xB4, 0x29, 0x0D, 0xD8,
-    0x07, 0x4B, 0x64, 0x00, 0x19, 0x54, 0xFA, 0x20, 0xC0, 0x00, 0x48, 0x43, 0xB4, 0x21, 0xFE, 0xF7,
-    0x73, 0xFF, 0xF5, 0x30, 0x03, 0x4B, 0xFF, 0x30, 0x80, 0xB2, 0xE0, 0x52, 0x10, 0xBD, 0xC0, 0x46,
-    0xFE, 0x01, 0x00, 0x20, 0x06, 0x02, 0x00, 0x20, 0x0B, 0x00, 0xFA, 0x22, 0xF5, 0x3B, 0xFF, 0x3B,
-    0x9B, 0xB2, 0xD2, 0x00, 0x93, 0x42, 0x02, 0xD8, 0x01, 0x4B, 0x40, 0x00, 0xC1, 0x52, 0x70, 0x47,
-    0x06, 0x02, 0x00, 0x20, 0x70, 0xB5, 0x64, 0x29, 0x0B, 0xD8, 0x06, 0x4B, 0x44, 0x00, 0x1A, 0x78,
-    0x05, 0x4B, 0x52, 0x00, 0xD0, 0x5A, 0x05, 0x4D, 0x48, 0x43, 0x64, 0x21, 0xFE, 0xF7, 0x4C, 0xFF,
-    0x28, 0x53, 0x70, 0xBD, 0xC0, 0x00, 0x00, 0x20, 0xC2, 0x00, 0x00, 0x20, 0xE6, 0x01, 0x00, 0x20,
-    0x10, 0xB5, 0x04, 0x00, 0x88, 0xB0, 0x14, 0x22, 0x00, 0x21, 0x03, 0xA8, 0x01, 0xF0, 0x66, 0xFB,
-    0x10, 0x4B, 0x22, 0x68, 0x9A, 0x42, 0x1B, 0xD1, 0x80, 0x21, 0x0F, 0x4B, 0x89, 0x00, 0x9A, 0x69,
-    0x90, 0x20, 0x0A, 0x43, 0x9A, 0x61, 0x9A, 0x69, 0xC0, 0x05, 0x0A, 0x40, 0x80, 0x21, 0x01, 0x92,
-    0x01, 0x9A, 0x5A, 0x69, 0x89, 0x02, 0x0A, 0x43, 0x5A, 0x61, 0x5B, 0x69, 0x0B, 0x40, 0x02, 0x93,
-    0x02, 0x9B, 0x01, 0x23, 0x03, 0xA9, 0x03, 0x93, 0x02, 0x33, 0x04, 0x93, 0x01, 0xF0, 0x06, 0xF8,
-    0x08, 0xB0, 0x10, 0xBD, 0x00, 0x24, 0x01, 0x40, 0x00, 0x10, 0x02, 0x40, 0x05, 0x4B, 0x00, 0x20,
-    0x1A, 0x88, 0x05, 0x4B, 0x9A, 0x42, 0x04, 0xD1, 0x04, 0x4B, 0x18, 0x88, 0x43, 0x1E, 0x98, 0x41,
-    0xC0, 0xB2, 0x70, 0x47, 0x00, 0x3C, 0x00, 0x08, 0x55, 0xAA, 0x00, 0x00, 0x02, 0x3C, 0x00, 0x08,
-    0x04, 0x4B, 0x00, 0x20, 0x1A, 0x88, 0x04, 0x4B, 0x9A, 0x42, 0x01, 0xD1, 0x03, 0x4B, 0x18, 0x88,
-    0x70, 0x47, 0xC0, 0x46, 0x00, 0x3C, 0x00, 0x08, 0x55, 0xAA, 0x00, 0x00, 0x02, 0x3C, 0x00, 0x08,
-    0xF8, 0xB5, 0x05, 0x00, 0x0C, 0x00, 0xFF, 0xF7, 0xD9, 0xFF, 0x00, 0x28, 0x0E, 0xD0, 0xFF, 0xF7,
-    0xE7, 0xFF, 0x09, 0x4B, 0x01, 0x00, 0x00, 0x22, 0x9C, 0x46, 0x06, 0x1C, 0x27, 0x1C, 0x30, 0x1C,
-    0xA1, 0x42, 0x00, 0xD9, 0x38, 0x1C, 0x80, 0xB2, 0x90, 0x42, 0x00, 0xDC, 0xF8, 0xBD, 0x63, 0x46,
-    0xD3, 0x5C, 0xAB, 0x54, 0x01, 0x32, 0xF2, 0xE7, 0x04, 0x3C, 0x00, 0x08, 0xFF, 0x23, 0xF0, 0xB5,
-    0x9B, 0x00, 0x05, 0x00, 0x0C, 0x00, 0x85, 0xB0, 0x99, 0x42, 0x11, 0xD8, 0x00, 0xF0, 0xBA, 0xFE,
-    0x00, 0x28, 0x0D, 0xD1, 0x01, 0x26, 0x27, 0x4F, 0x01, 0x90, 0x00, 0x90, 0x69, 0x46, 0x01, 0xA8,
-    0x02, 0x97, 0x03, 0x96, 0x00, 0xF0, 0x60, 0xFF, 0x00, 0x28, 0x04, 0xD0, 0x00, 0xF0, 0xBE, 0xFE,
-    0x00, 0x20, 0x05, 0xB0, 0xF0, 0xBD, 0x00, 0x23, 0x39, 0x00, 0x30, 0x00, 0x1E, 0x4A, 0x00, 0xF0,
-    0xE9, 0xFE, 0x03, 0x1E, 0xF2, 0xD1, 0x22, 0x00, 0x30, 0x00, 0x1C, 0x49, 0x00, 0xF0, 0xE2, 0xFE,
-    0x00, 0x28, 0xEB, 0xD1, 0x2E, 0x00, 0x67, 0x08, 0x7F, 0x00, 0x7F, 0x19, 0xBE, 0x42, 0x14, 0xD1,
-    0x01, 0x20, 0x04, 0x42, 0x09, 0xD0, 0x16, 0x49, 0x2B, 0x19, 0x01, 0x3B, 0x1A, 0x78, 0x61, 0x18,
-    0x00, 0x23, 0x00, 0xF0, 0xCF, 0xFE, 0x00, 0x28, 0xD8, 0xD1, 0x00, 0x23, 0x11, 0x4A, 0xA3, 0x42,
-    0x12, 0xDB, 0x00, 0xF0, 0x93, 0xFE, 0x01, 0x20, 0xD3, 0xE7, 0x73, 0x78, 0x32, 0x78, 0x1B, 0x02,
-    0x1A, 0x43, 0x0C, 0x4B, 0x71, 0x1B, 0xC9, 0x18, 0x01, 0x20, 0x00, 0x23, 0x00, 0xF0, 0xBA, 0xFE,
-    0x02, 0x36, 0x00, 0x28, 0xDA, 0xD0, 0xC1, 0xE7, 0x98, 0x5C, 0xE9, 0x5C, 0x88, 0x42, 0xBD, 0xD1,
-    0x01, 0x33, 0xE4, 0xE7, 0x00, 0x3C, 0x00, 0x08, 0x55, 0xAA, 0x00, 0x00, 0x02, 0x3C, 0x00, 0x08,
-    0x03, 0x3C, 0x00, 0x08, 0x04, 0x3C, 0x00, 0x08, 0x7F, 0xB5, 0x10, 0x22, 0x00, 0x21, 0x02, 0xA8,
-    0x01, 0xF0, 0x94, 0xFA, 0x80, 0x21, 0x09, 0x4B, 0x89, 0x02, 0x5A, 0x69, 0x90, 0x20, 0x0A, 0x43,
-    0x5A, 0x61, 0x5B, 0x69, 0xC0, 0x05, 0x0B, 0x40, 0x00, 0x93, 0x00, 0x9B, 0xFF, 0x23, 0x01, 0xA9,
-    0x01, 0x93, 0x00, 0xF0, 0x43, 0xFF, 0x07, 0xB0, 0x00, 0xBD, 0xC0, 0x46, 0x00, 0x10, 0x02, 0x40,
-    0xF0, 0xB5, 0x91, 0xB0, 0x1C, 0x22, 0x00, 0x21, 0x09, 0xA8, 0x01, 0xF0, 0x77, 0xFA, 0x80, 0x22,
-    0x33, 0x4D, 0x92, 0x02, 0x6B, 0x69, 0x90, 0x20, 0x13, 0x43, 0x6B, 0x61, 0x6B, 0x69, 0x00, 0x24,
-    0x13, 0x40, 0x02, 0x93, 0x02, 0x9B, 0x80, 0x23, 0x02, 0x27, 0x01, 0x22, 0x04, 0x26, 0x9B, 0x00,
-    0x03, 0x93, 0xFE, 0x3B, 0xFF, 0x3B, 0x03, 0xA9, 0xC0, 0x05, 0x05, 0x93, 0x06, 0x92, 0x08, 0x96,
-    0x04, 0x97, 0x07, 0x94, 0x01, 0xF0, 0x9C, 0xF8, 0x80, 0x23, 0x90, 0x20, 0xDB, 0x00, 0x01, 0x22,
-    0x03, 0x93, 0x03, 0x23, 0x03, 0xA9, 0xC0, 0x05, 0x05, 0x93, 0x06, 0x92, 0x08, 0x96, 0x04, 0x97,
-    0x07, 0x94, 0x01, 0xF0, 0x8D, 0xF8, 0x80, 0x22, 0xC5, 0x21, 0xEB, 0x69, 0x92, 0x03, 0x13, 0x43,
-    0xEB, 0x61, 0xEB, 0x69, 0x89, 0x00, 0x13, 0x40, 0x1A, 0x4A, 0x01, 0x93, 0x01, 0x9B, 0x53, 0x58,
-    0x19, 0x4D, 0x1B, 0x02, 0x1B, 0x0A, 0x53, 0x50, 0x80, 0x23, 0x1B, 0x04, 0x13, 0x60, 0xEB, 0x68,
-    0x16, 0x4A, 0x17, 0x4E, 0x13, 0x40, 0xEB, 0x60, 0x2B, 0x68, 0x16, 0x4A, 0x09, 0xA9, 0x13, 0x40,
-    0x2B, 0x60, 0x2B, 0x68, 0x14, 0x4A, 0x28, 0x00, 0x13, 0x40, 0x2B, 0x60, 0x13, 0x4B, 0x09, 0x94,
-    0x0A, 0x93, 0x33, 0x78, 0x0B, 0x94, 0x5B, 0x00, 0x0D, 0x93, 0x0C, 0x94, 0x0E, 0x94, 0x0F, 0x94,
-    0x01, 0xF0, 0xC8, 0xF8, 0x80, 0x23, 0x6A, 0x68, 0x9B, 0x04, 0x13, 0x43, 0x6B, 0x60, 0xEB, 0x68,
-    0x0B, 0x4A, 0x13, 0x40, 0xEB, 0x60, 0x30, 0x78, 0x00, 0xF0, 0x14, 0xF8, 0x11, 0xB0, 0xF0, 0xBD,
-    0x00, 0x10, 0x02, 0x40, 0x00, 0xE1, 0x00, 0xE0, 0x00, 0x54, 0x00, 0x40, 0xFF, 0x7F, 0xFF, 0xFF,
-    0x36, 0x02, 0x00, 0x20, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x0B, 0x02, 0x00, 0x00,
-    0x01, 0xF8, 0xFF, 0xFF, 0x02, 0x4B, 0x40, 0x00, 0xC0, 0xB2, 0x18, 0x70, 0x70, 0x47, 0xC0, 0x46,
-    0xA0, 0x02, 0x00, 0x20, 0x01, 0x22, 0x0A, 0x4B, 0x19, 0x68, 0x0A, 0x43, 0x1A, 0x60, 0x08, 0x22,
-    0x19, 0x68, 0x0A, 0x43, 0x1A, 0x60, 0x10, 0x22, 0x19, 0x68, 0x0A, 0x43, 0x1A, 0x60, 0x80, 0x22,
-    0x19, 0x68, 0x0A, 0x43, 0x1A, 0x60, 0x20, 0x22, 0x19, 0x68, 0x0A, 0x43, 0x1A, 0x60, 0x70, 0x47,
-    0x00, 0x54, 0x00, 0x40, 0x08, 0x21, 0x08, 0x4B, 0x1A, 0x68, 0x8A, 0x43, 0x1A, 0x60, 0x1A, 0x68,
-    0x49, 0x18, 0x8A, 0x43, 0x1A, 0x60, 0x1A, 0x68, 0x70, 0x31, 0x8A, 0x43, 0x1A, 0x60, 0x1A, 0x68,
-    0x60, 0x39, 0x8A, 0x43, 0x1A, 0x60, 0x70, 0x47, 0x00, 0x54, 0x00, 0x40, 0x96, 0x23, 0x10, 0xB5,
-    0x9B, 0x00, 0x0C, 0x00, 0x99, 0x42, 0x02, 0xD8, 0x00, 0x29, 0x01, 0xD1, 0x10, 0xBD, 0x1C, 0x00,
-    0x00, 0x28, 0xFB, 0xD0, 0x05, 0x4B, 0x22, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0xF0, 0xFC, 0xF9,
-    0x00, 0x22, 0x03, 0x4B, 0x1A, 0x80, 0x03, 0x4B, 0x1C, 0x80, 0xEF, 0xE7, 0xA4, 0x02, 0x00, 0x20,
-    0x9E, 0x02, 0x00, 0x20, 0x9C, 0x02, 0x00, 0x20, 0x09, 0x4B, 0x0A, 0x49, 0x1A, 0x88, 0x49, 0x6A,
-    0x09, 0x48, 0x92, 0xB2, 0xC9, 0xB2, 0x81, 0x54, 0x1A, 0x88, 0x01, 0x32, 0x92, 0xB2, 0x1A, 0x80,
-    0x96, 0x22, 0x19, 0x88, 0x92, 0x00, 0x91, 0x42, 0x01, 0xD3, 0x00, 0x22, 0x1A, 0x80, 0x70, 0x47,
-    0xA2, 0x02, 0x00, 0x20, 0x00, 0x54, 0x00, 0x40, 0xFC, 0x04, 0x00, 0x20, 0x0D, 0x4B, 0x0E, 0x49,
-    0x1A, 0x88, 0x92, 0xB2, 0x8A, 0x5C, 0x0D, 0x49, 0xD2, 0xB2, 0x8A, 0x62, 0x1A, 0x88, 0x01, 0x32,
-    0x92, 0xB2, 0x1A, 0x80, 0x0A, 0x4A, 0x19, 0x88, 0x12, 0x88, 0x91, 0x42, 0x01, 0xD3, 0x00, 0x22,
-    0x1A, 0x80, 0x96, 0x22, 0x19, 0x88, 0x92, 0x00, 0x91, 0x42, 0x01, 0xD3, 0x00, 0x22, 0x1A, 0x80,
-    0x70, 0x47, 0xC0, 0x46, 0x9E, 0x02, 0x00, 0x20, 0xA4, 0x02, 0x00, 0x20, 0x00, 0x54, 0x00, 0x40,
-    0x9C, 0x02, 0x00, 0x20, 0x70, 0xB5, 0x47, 0x4D, 0x47, 0x4C, 0x2B, 0x68, 0x01, 0x33, 0x2B, 0x60,
-    0xFA, 0x23, 0x2A, 0x68, 0xDB, 0x01, 0x9A, 0x42, 0x14, 0xD9, 0x20, 0x00, 0x00, 0xF0, 0xF2, 0xFF,
-    0x63, 0x68, 0x42, 0x4A, 0x13, 0x40, 0x01, 0x22, 0x63, 0x60, 0x23, 0x68, 0x93, 0x43, 0x23, 0x60,
-    0x23, 0x68, 0x07, 0x32, 0x93, 0x43, 0x23, 0x60, 0xFF, 0xF7, 0xD2, 0xFE, 0xFF, 0xF7, 0x5A, 0xFF,
-    0x00, 0x23, 0x2B, 0x60, 0x08, 0x22, 0xA3, 0x69, 0x13, 0x42, 0x28, 0xD0, 0xFF, 0x20, 0xA3, 0x69,
-    0x37, 0x49, 0x5B, 0x0C, 0x09, 0x78, 0x5B, 0x00, 0x03, 0x40, 0x99, 0x42, 0x3B, 0xD1, 0x35, 0x4D,
-    0x2B, 0x88, 0x00, 0x2B, 0x0A, 0xD0, 0xFF, 0xF7, 0x5D, 0xFF, 0x29, 0x88, 0x32, 0x48, 0x89, 0xB2,
-    0xFE, 0xF7, 0x44, 0xFF, 0x00, 0x23, 0x2B, 0x80, 0xFF, 0xF7, 0x3C, 0xFF, 0x80, 0x22, 0xA3, 0x69,
-    0x52, 0x02, 0x13, 0x42, 0x1B, 0xD1, 0x08, 0x23, 0xE2, 0x69, 0x13, 0x43, 0xE3, 0x61, 0x04, 0x23,
-    0x22, 0x68, 0x13, 0x43, 0x01, 0x22, 0x23, 0x60, 0x28, 0x4B, 0x1A, 0x60, 0x70, 0xBD, 0x10, 0x23,
-    0xA2, 0x69, 0x1A, 0x42, 0x1B, 0xD1, 0xA3, 0x69, 0x9B, 0x07, 0x1C, 0xD4, 0xA3, 0x69, 0x5B, 0x07,
-    0x1C, 0xD4, 0x20, 0x23, 0xA2, 0x69, 0x1A, 0x42, 0x1B, 0xD1, 0xA3, 0x69, 0xEE, 0xE7, 0xA1, 0x69,
-    0x08, 0x23, 0x11, 0x42, 0x0B, 0xD0, 0xE2, 0x69, 0x13, 0x43, 0xE3, 0x61, 0x02, 0x23, 0x22, 0x68,
-    0x13, 0x43, 0x23, 0x60, 0xE2, 0xE7, 0xE3, 0x69, 0x1A, 0x43, 0xE2, 0x61, 0xDE, 0xE7, 0xE2, 0x69,
-    0x13, 0x43, 0xE3, 0x61, 0xDA, 0xE7, 0xFF, 0xF7, 0x69, 0xFF, 0xD7, 0xE7, 0xFF, 0xF7, 0x4C, 0xFF,
-    0xD4, 0xE7, 0xE2, 0x69, 0x13, 0x43, 0xE3, 0x61, 0x01, 0x23, 0xA2, 0x69, 0x1A, 0x42, 0x00, 0xD1,
-    0xA3, 0x61, 0x00, 0x24, 0xFF, 0xF7, 0x0E, 0xFF, 0x0A, 0x4D, 0x0B, 0x48, 0x29, 0x88, 0x89, 0xB2,
-    0xFE, 0xF7, 0xF4, 0xFE, 0x2C, 0x80, 0xFF, 0xF7, 0xED, 0xFE, 0x08, 0x4B, 0x1C, 0x60, 0x08, 0x4B,
-    0x1C, 0x60, 0xBB, 0xE7, 0x98, 0x02, 0x00, 0x20, 0x00, 0x54, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xA0, 0x02, 0x00, 0x20, 0xA2, 0x02, 0x00, 0x20, 0xFC, 0x04, 0x00, 0x20, 0x94, 0x02, 0x00, 0x20,
-    0x90, 0x02, 0x00, 0x20, 0x01, 0x21, 0x0A, 0x4B, 0x82, 0xB0, 0x9A, 0x69, 0x0A, 0x43, 0x9A, 0x61,
-    0x9A, 0x69, 0x0A, 0x40, 0x80, 0x21, 0x00, 0x92, 0x00, 0x9A, 0xDA, 0x69, 0x49, 0x05, 0x0A, 0x43,
-    0xDA, 0x61, 0xDB, 0x69, 0x0B, 0x40, 0x01, 0x93, 0x01, 0x9B, 0x02, 0xB0, 0x70, 0x47, 0xC0, 0x46,
-    0x00, 0x10, 0x02, 0x40, 0x10, 0xB5, 0x00, 0xF0, 0x2F, 0xFC, 0xFC, 0xE7, 0x10, 0xB5, 0x00, 0xF0,
-    0x2B, 0xFC, 0xFC, 0xE7, 0x70, 0x47, 0x70, 0x47, 0x10, 0xB5, 0x00, 0xF0, 0x81, 0xF9, 0x10, 0xBD,
-    0x0B, 0x49, 0x0C, 0x4A, 0x03, 0x00, 0x52, 0x1A, 0x0B, 0x49, 0x10, 0xB5, 0x08, 0x68, 0x00, 0x28,
-    0x01, 0xD1, 0x0A, 0x48, 0x08, 0x60, 0x08, 0x68, 0xC3, 0x18, 0x93, 0x42, 0x06, 0xD9, 0x01, 0xF0,
-    0xAF, 0xF8, 0x0C, 0x23, 0x03, 0x60, 0x01, 0x20, 0x40, 0x42, 0x10, 0xBD, 0x0B, 0x60, 0xFC, 0xE7,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x54, 0x07, 0x00, 0x20, 0x60, 0x09, 0x00, 0x20,
-    0x70, 0x47, 0x00, 0x00, 0x09, 0x48, 0x0A, 0x4B, 0x10, 0xB5, 0x03, 0x60, 0x2F, 0x23, 0x43, 0x60,
-    0x00, 0x23, 0x08, 0x4A, 0x83, 0x60, 0xC2, 0x60, 0x03, 0x61, 0x43, 0x61, 0x83, 0x61, 0x00, 0xF0,
-    0x8F, 0xFE, 0x00, 0x28, 0x01, 0xD0, 0xFF, 0xF7, 0x19, 0xFA, 0x10, 0xBD, 0xA0, 0x07, 0x00, 0x20,
-    0x00, 0x44, 0x01, 0x40, 0xFF, 0xFF, 0x00, 0x00, 0x09, 0x48, 0x0A, 0x4B, 0x10, 0xB5, 0x03, 0x60,
-    0x2F, 0x23, 0x43, 0x60, 0x00, 0x23, 0x08, 0x4A, 0x83, 0x60, 0xC2, 0x60, 0x03, 0x61, 0x43, 0x61,
-    0x83, 0x61, 0x00, 0xF0, 0x75, 0xFE, 0x00, 0x28, 0x01, 0xD0, 0xFF, 0xF7, 0xFF, 0xF9, 0x10, 0xBD,
-    0x58, 0x07, 0x00, 0x20, 0x00, 0x48, 0x01, 0x40, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x68, 0x0F, 0x4A,
-    0x82, 0xB0, 0x93, 0x42, 0x0B, 0xD1, 0x80, 0x21, 0x0D, 0x4B, 0x89, 0x02, 0x9A, 0x69, 0x0A, 0x43,
-    0x9A, 0x61, 0x9B, 0x69, 0x0B, 0x40, 0x00, 0x93, 0x00, 0x9B, 0x02, 0xB0, 0x70, 0x47, 0x09, 0x4A,
-    0x93, 0x42, 0xFA, 0xD1, 0x80, 0x21, 0x06, 0x4B, 0xC9, 0x02, 0x9A, 0x69, 0x0A, 0x43, 0x9A, 0x61,
-    0x9B, 0x69, 0x0B, 0x40, 0x01, 0x93, 0x01, 0x9B, 0xEF, 0xE7, 0xC0, 0x46, 0x00, 0x44, 0x01, 0x40,
-    0x00, 0x10, 0x02, 0x40, 0x00, 0x48, 0x01, 0x40, 0x03, 0x68, 0x08, 0x4A, 0x93, 0x42, 0x05, 0xD1,
-    0x07, 0x4A, 0x08, 0x49, 0x93, 0x69, 0x0B, 0x40, 0x93, 0x61, 0x70, 0x47, 0x06, 0x4A, 0x93, 0x42,
-    0xFB, 0xD1, 0x03, 0x4A, 0x05, 0x49, 0x93, 0x69, 0xF5, 0xE7, 0xC0, 0x46, 0x00, 0x44, 0x01, 0x40,
-    0x00, 0x10, 0x02, 0x40, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x48, 0x01, 0x40, 0xFF, 0xFF, 0xFB, 0xFF,
-    0x71, 0x23, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0x01, 0x3B, 0xDB, 0xB2, 0x00, 0x2B, 0xE3, 0xD1, 0x70, 0x47, 0x10, 0xB5, 0x04, 0x21,
-    0x04, 0x00, 0x00, 0xF0, 0x01, 0xFF, 0x02, 0x4B, 0x18, 0x60, 0x02, 0x4B, 0x1C, 0x70, 0x10, 0xBD,
-    0xE8, 0x07, 0x00, 0x20, 0xEC, 0x07, 0x00, 0x20, 0x0B, 0x00, 0x07, 0x4A, 0x10, 0xB5, 0x09, 0x0A,
-    0x14, 0x68, 0x1A, 0x0E, 0x12, 0x02, 0xC9, 0xB2, 0x11, 0x43, 0xFF, 0x22, 0x12, 0x04, 0x13, 0x40,
-    0x80, 0x00, 0x19, 0x43, 0x01, 0x51, 0x10, 0xBD, 0xE8, 0x07, 0x00, 0x20, 0x90, 0x21, 0x30, 0xB5,
-    0x17, 0x23, 0x01, 0x25, 0x2E, 0x4A, 0xC9, 0x05, 0x2C, 0x00, 0x9C, 0x40, 0x20, 0x42, 0x32, 0xD0,
-    0x14, 0x88, 0xA4, 0xB2, 0x8C, 0x61, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0x14, 0x88,
-    0xA4, 0xB2, 0x8C, 0x62, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0x01, 0x3B, 0xC9, 0xD2, 0x30, 0xBD, 0x14, 0x88, 0xA4, 0xB2, 0x8C, 0x61, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0x14, 0x88, 0xA4, 0xB2, 0x8C, 0x62, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46,
-    0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xC0, 0x46, 0xD1, 0xE7,
-    0xDC, 0x01, 0x00, 0x20, 0x10, 0xB5, 0x72, 0xB6, 0x05, 0x4B, 0x06, 0x4A, 0x1B, 0x78, 0x12, 0x68,
-    0x9B, 0x00, 0x98, 0x58, 0xFF, 0xF7, 0x92, 0xFF, 0x62, 0xB6, 0xFF, 0xF7, 0x51, 0xFF, 0x10, 0xBD,
-    0xDA, 0x01, 0x00, 0x20, 0xE8, 0x07, 0x00, 0x20, 0x70, 0xB5, 0x05, 0x00, 0xFA, 0x20, 0x0D, 0x4B,
-    0x80, 0x00, 0x19, 0x78, 0xFE, 0xF7, 0x9E, 0xFA, 0x0B, 0x4C, 0x01, 0x00, 0x20, 0x68, 0xFE, 0xF7,
-    0x99, 0xFA, 0x00, 0xF0, 0xD7, 0xFA, 0x04, 0x00, 0x01, 0x20, 0x00, 0x2C, 0x09, 0xD1, 0x03, 0x2D,
-    0x07, 0xD8, 0x02, 0x38, 0x22, 0x00, 0x29, 0x00, 0x00, 0xF0, 0x94, 0xFA, 0x20, 0x00, 0x03, 0x4B,
-    0x1D, 0x60, 0x70, 0xBD, 0x14, 0x01, 0x00, 0x20, 0x10, 0x01, 0x00, 0x20, 0x18, 0x01, 0x00, 0x20,
-    0x10, 0x23, 0x06, 0x4A, 0x10, 0xB5, 0x11, 0x68, 0x03, 0x20, 0x0B, 0x43, 0x13, 0x60, 0xFF, 0xF7,
-    0xD3, 0xFF, 0xFF, 0xF7, 0x5F, 0xFE, 0x00, 0x20, 0x10, 0xBD, 0xC0, 0x46, 0x00, 0x20, 0x02, 0x40,
-    0x03, 0x4A, 0x04, 0x4B, 0x11, 0x68, 0x1B, 0x78, 0x5B, 0x18, 0x13, 0x60, 0x70, 0x47, 0xC0, 0x46,
-    0xF0, 0x07, 0x00, 0x20, 0x14, 0x01, 0x00, 0x20, 0x01, 0x4B, 0x18, 0x68, 0x70, 0x47, 0xC0, 0x46,
-    0xF0, 0x07, 0x00, 0x20, 0x70, 0xB5, 0x04, 0x00, 0xFF, 0xF7, 0xF6, 0xFF, 0x05, 0x00, 0x63, 0x1C,
-    0x02, 0xD0, 0x04, 0x4B, 0x1B, 0x78, 0xE4, 0x18, 0xFF, 0xF7, 0xEE, 0xFF, 0x40, 0x1B, 0xA0, 0x42,
-    0xFA, 0xD3, 0x70, 0xBD, 0x14, 0x01, 0x00, 0x20, 0x00, 0x23, 0x73, 0xB5, 0x03, 0x21, 0x01, 0x93,
-    0x03, 0x68, 0x04, 0x00, 0x9A, 0x68, 0x0A, 0x40, 0x01, 0x2A, 0x07, 0xD1, 0x19, 0x68, 0x11, 0x42,
-    0x01, 0xD0, 0x00, 0x20, 0x76, 0xBD, 0xDA, 0x68, 0x12, 0x04, 0xFA, 0xD4, 0x99, 0x68, 0x1B, 0x4A,
-    0x11, 0x42, 0x09, 0xD0, 0x10, 0x23, 0xA2, 0x6B, 0x13, 0x43, 0xA3, 0x63, 0x01, 0x23, 0xE2, 0x6B,
-    0x13, 0x43, 0x01, 0x20, 0xE3, 0x63, 0xED, 0xE7, 0x01, 0x22, 0x99, 0x68, 0x0A, 0x43, 0x9A, 0x60,
-    0x13, 0x4B, 0x14, 0x49, 0x18, 0x68, 0xFE, 0xF7, 0x25, 0xFA, 0x01, 0x90, 0x01, 0x9B, 0x00, 0x2B,
-    0x17, 0xD1, 0xFF, 0xF7, 0xB9, 0xFF, 0x01, 0x25, 0x06, 0x00, 0x23, 0x68, 0x1B, 0x68, 0x2B, 0x42,
-    0xD7, 0xD1, 0xFF, 0xF7, 0xB1, 0xFF, 0x80, 0x1B, 0x02, 0x28, 0xF6, 0xD9, 0x23, 0x68, 0x1B, 0x68,
-    0x2B, 0x42, 0xF2, 0xD1, 0x10, 0x23, 0xA2, 0x6B, 0x13, 0x43, 0xA3, 0x63, 0xE3, 0x6B, 0x2B, 0x43,
-    0xD7, 0xE7, 0x01, 0x9B, 0x01, 0x3B, 0x01, 0x93, 0xE0, 0xE7, 0xC0, 0x46, 0x17, 0x00, 0x00, 0x80,
-    0x10, 0x01, 0x00, 0x20, 0x40, 0x42, 0x0F, 0x00, 0x70, 0xB5, 0x04, 0x1E, 0x00, 0xD1, 0x90, 0xE0,
-    0x83, 0x6B, 0x00, 0x2B, 0x05, 0xD1, 0x02, 0x00, 0x34, 0x32, 0xC3, 0x63, 0x13, 0x70, 0xFF, 0xF7,
-    0x37, 0xFB, 0xA3, 0x6B, 0xDB, 0x06, 0x00, 0xD5, 0x85, 0xE0, 0x22, 0x68, 0x93, 0x68, 0x5B, 0x07,
-    0x00, 0xD5, 0x80, 0xE0, 0xA1, 0x6B, 0x42, 0x4B, 0x19, 0x40, 0x06, 0x33, 0xFF, 0x33, 0x0B, 0x43,
-    0x03, 0x21, 0xA3, 0x63, 0x93, 0x68, 0x0B, 0x40, 0x01, 0x2B, 0x05, 0xD1, 0x11, 0x68, 0x19, 0x42,
-    0x0E, 0xD1, 0xD3, 0x68, 0x1B, 0x04, 0x0B, 0xD4, 0x18, 0x21, 0xD3, 0x68, 0x8B, 0x43, 0xA1, 0x68,
-    0x0B, 0x43, 0xD3, 0x60, 0x13, 0x69, 0x61, 0x68, 0x9B, 0x00, 0x9B, 0x08, 0x0B, 0x43, 0x13, 0x61,
-    0xD3, 0x68, 0x34, 0x49, 0x0B, 0x40, 0xD3, 0x60, 0x23, 0x7E, 0x60, 0x7E, 0x9B, 0x03, 0xC0, 0x03,
-    0x03, 0x43, 0xA1, 0x7E, 0xE0, 0x68, 0x03, 0x43, 0x48, 0x03, 0x03, 0x43, 0x60, 0x1D, 0xC0, 0x7F,
-    0x40, 0x00, 0x03, 0x43, 0xA0, 0x6A, 0x01, 0x38, 0x45, 0x1E, 0xA8, 0x41, 0x00, 0x03, 0x03, 0x43,
-    0x20, 0x69, 0x02, 0x38, 0x45, 0x42, 0x68, 0x41, 0x80, 0x00, 0x03, 0x43, 0xE0, 0x7E, 0x01, 0x28,
-    0x04, 0xD1, 0x00, 0x29, 0x2B, 0xD1, 0x80, 0x21, 0x49, 0x02, 0x0B, 0x43, 0xC2, 0x20, 0xE1, 0x69,
-    0xFF, 0x30, 0x81, 0x42, 0x02, 0xD0, 0x20, 0x6A, 0x01, 0x43, 0x0B, 0x43, 0x80, 0x20, 0xD1, 0x68,
-    0x40, 0x05, 0x19, 0x43, 0xD1, 0x60, 0xE1, 0x6A, 0x81, 0x42, 0x02, 0xD0, 0x48, 0x1E, 0x06, 0x28,
-    0x07, 0xD8, 0x07, 0x25, 0x50, 0x69, 0x29, 0x40, 0xA8, 0x43, 0x50, 0x61, 0x50, 0x69, 0x01, 0x43,
-    0x51, 0x61, 0xD2, 0x68, 0x14, 0x49, 0x0A, 0x40, 0x9A, 0x42, 0x10, 0xD1, 0x00, 0x20, 0x03, 0x23,
-    0xE0, 0x63, 0xA2, 0x6B, 0x9A, 0x43, 0x02, 0x3B, 0x13, 0x43, 0xA3, 0x63, 0x70, 0xBD, 0x20, 0x21,
-    0xA5, 0x6B, 0x29, 0x43, 0xA1, 0x63, 0xE1, 0x6B, 0x08, 0x43, 0xE0, 0x63, 0xCE, 0xE7, 0x12, 0x23,
-    0xA2, 0x6B, 0x9A, 0x43, 0x02, 0x3B, 0x13, 0x43, 0xA3, 0x63, 0x01, 0x23, 0xE2, 0x6B, 0x13, 0x43,
-    0xE3, 0x63, 0x01, 0x20, 0xEA, 0xE7, 0x10, 0x23, 0xA2, 0x6B, 0x13, 0x43, 0xA3, 0x63, 0xF8, 0xE7,
-    0xFD, 0xFE, 0xFF, 0xFF, 0x19, 0x02, 0xFE, 0xFF, 0xE7, 0xFF, 0x3F, 0x83, 0x03, 0x68, 0x70, 0xB5,
-    0x9B, 0x68, 0x04, 0x00, 0x02, 0x20, 0x5B, 0x07, 0x1A, 0xD4, 0x25, 0x00, 0x34, 0x35, 0x2B, 0x78,
-    0x01, 0x2B, 0x15, 0xD0, 0x01, 0x23, 0x2B, 0x70, 0x63, 0x7E, 0x01, 0x2B, 0x11, 0xD1, 0xA2, 0x6B,
-    0x0B, 0x4B, 0x00, 0x20, 0x1A, 0x40, 0x80, 0x23, 0x5B, 0x00, 0x13, 0x43, 0x1C, 0x22, 0xA3, 0x63,
-    0xE0, 0x63, 0x28, 0x70, 0x23, 0x68, 0x1A, 0x60, 0x99, 0x68, 0x18, 0x3A, 0x0A, 0x43, 0x9A, 0x60,
-    0x70, 0xBD, 0x20, 0x00, 0xFF, 0xF7, 0xE8, 0xFE, 0x00, 0x28, 0xE8, 0xD0, 0xF8, 0xE7, 0xC0, 0x46,
-    0xFE, 0xF0, 0xFF, 0xFF, 0xF8, 0xB5, 0x45, 0x69, 0x04, 0x00, 0x0E, 0x00, 0x08, 0x2D, 0x0D, 0xD0,
-    0x03, 0x68, 0x01, 0x20, 0xDB, 0x68, 0x0C, 0x25, 0x03, 0x42, 0x07, 0xD0, 0x20, 0x23, 0xA2, 0x6B,
-    0x34, 0x34, 0x13, 0x43, 0x63, 0x60, 0x00, 0x23, 0x23, 0x70, 0xF8, 0xBD, 0xFF, 0xF7, 0xB4, 0xFE,
-    0x07, 0x00, 0x23, 0x68, 0x1A, 0x68, 0x15, 0x42, 0x22, 0xD0, 0x80, 0x22, 0xA1, 0x6B, 0x92, 0x00,
-    0x0A, 0x43, 0xA2, 0x63, 0xC0, 0x22, 0xD9, 0x68, 0x12, 0x01, 0x11, 0x42, 0x13, 0xD1, 0xA2, 0x7E,
-    0x00, 0x2A, 0x10, 0xD1, 0x1A, 0x68, 0x12, 0x07, 0x0D, 0xD5, 0x9A, 0x68, 0x52, 0x07, 0x27, 0xD4,
-    0x0C, 0x21, 0x5A, 0x68, 0x8A, 0x43, 0x5A, 0x60, 0xA1, 0x6B, 0x17, 0x4A, 0x11, 0x40, 0x04, 0x32,
-    0xFF, 0x32, 0x0A, 0x43, 0xA2, 0x63, 0x22, 0x7E, 0x00, 0x2A, 0x22, 0xD0, 0x00, 0x20, 0xD4, 0xE7,
-    0x72, 0x1C, 0xD7, 0xD0, 0x00, 0x2E, 0x0D, 0xD1, 0x2A, 0x00, 0x23, 0x68, 0x1B, 0x68, 0x1A, 0x40,
-    0x1D, 0x42, 0xCE, 0xD1, 0x04, 0x23, 0xA1, 0x6B, 0x34, 0x34, 0x0B, 0x43, 0x63, 0x60, 0x03, 0x20,
-    0x22, 0x70, 0xC2, 0xE7, 0xFF, 0xF7, 0x78, 0xFE, 0xC0, 0x1B, 0xB0, 0x42, 0xEC, 0xD8, 0xC0, 0xE7,
-    0x20, 0x22, 0xA1, 0x6B, 0x0A, 0x43, 0xA2, 0x63, 0x01, 0x22, 0xE1, 0x6B, 0x0A, 0x43, 0xE2, 0x63,
-    0xD9, 0xE7, 0x0C, 0x22, 0x1A, 0x60, 0xD9, 0xE7, 0xFE, 0xFE, 0xFF, 0xFF, 0x03, 0x68, 0x18, 0x6C,
-    0x70, 0x47, 0x00, 0x00, 0xF7, 0xB5, 0x00, 0x22, 0x04, 0x00, 0x01, 0x92, 0x34, 0x34, 0x22, 0x78,
-    0x03, 0x00, 0xC6, 0x6A, 0x02, 0x20, 0x01, 0x2A, 0x2C, 0xD0, 0x01, 0x38, 0x20, 0x70, 0x1D, 0x68,
-    0xAA, 0x68, 0x52, 0x07, 0x54, 0xD4, 0x0A, 0x68, 0x4F, 0x68, 0x13, 0x00, 0xBC, 0x46, 0x2B, 0x4F,
-    0x90, 0x40, 0x10, 0x3B, 0xBC, 0x45, 0x3C, 0xD0, 0xAF, 0x6A, 0x38, 0x43, 0xA8, 0x62, 0x07, 0x2E,
-    0x0F, 0xD8, 0x00, 0x2E, 0x11, 0xD1, 0x07, 0x20, 0x6E, 0x69, 0x89, 0x68, 0x06, 0x40, 0xB1, 0x42,
-    0x0B, 0xD0, 0x6E, 0x69, 0x01, 0x40, 0x86, 0x43, 0x6E, 0x61, 0x6E, 0x69, 0x31, 0x43, 0x69, 0x61,
-    0x03, 0xE0, 0x80, 0x20, 0x40, 0x05, 0x86, 0x42, 0xED, 0xD1, 0x01, 0x2B, 0x03, 0xD9, 0x00, 0x20,
-    0x00, 0x23, 0x23, 0x70, 0xFE, 0xBD, 0x13, 0x00, 0x10, 0x3B, 0x5D, 0x1E, 0xAB, 0x41, 0x80, 0x25,
-    0x17, 0x49, 0x5B, 0x42, 0x9B, 0x0D, 0x08, 0x68, 0x9B, 0x05, 0x2D, 0x04, 0x5B, 0x19, 0x03, 0x43,
-    0x0B, 0x60, 0x10, 0x2A, 0xEB, 0xD1, 0x13, 0x4B, 0x13, 0x49, 0x18, 0x68, 0xFE, 0xF7, 0x7A, 0xF8,
-    0x0A, 0x23, 0x43, 0x43, 0x01, 0x93, 0x01, 0x9B, 0x00, 0x2B, 0xE0, 0xD0, 0x01, 0x9B, 0x01, 0x3B,
-    0xF8, 0xE7, 0xAA, 0x6A, 0x82, 0x43, 0xAA, 0x62, 0x01, 0x2B, 0xD8, 0xD8, 0x58, 0x1E, 0x83, 0x41,
-    0x07, 0x4A, 0x0A, 0x48, 0x11, 0x68, 0x9B, 0x05, 0x1B, 0x18, 0x0B, 0x40, 0x13, 0x60, 0xCE, 0xE7,
-    0x20, 0x22, 0x99, 0x6B, 0x0A, 0x43, 0x9A, 0x63, 0xCA, 0xE7, 0xC0, 0x46, 0x01, 0x10, 0x00, 0x00,
-    0x08, 0x27, 0x01, 0x40, 0x10, 0x01, 0x00, 0x20, 0x40, 0x42, 0x0F, 0x00, 0xFF, 0xFF, 0x7F, 0xFF,
-    0x80, 0x6B, 0x70, 0x47, 0xF8, 0xB5, 0x06, 0x00, 0x34, 0x36, 0x33, 0x78, 0x04, 0x00, 0x02, 0x20,
-    0x01, 0x2B, 0x45, 0xD0, 0x01, 0x23, 0x03, 0x21, 0x33, 0x70, 0x23, 0x68, 0x9A, 0x68, 0x0A, 0x40,
-    0x01, 0x2A, 0x05, 0xD1, 0x19, 0x68, 0x11, 0x42, 0x3B, 0xD1, 0xDA, 0x68, 0x12, 0x04, 0x38, 0xD4,
-    0xA1, 0x6B, 0x1F, 0x4A, 0x11, 0x40, 0x06, 0x32, 0xFF, 0x32, 0x0A, 0x43, 0x03, 0x21, 0xA2, 0x63,
-    0xDD, 0x68, 0xDA, 0x68, 0x8A, 0x43, 0xDA, 0x60, 0x80, 0x22, 0x99, 0x68, 0x12, 0x06, 0x0A, 0x43,
-    0x9A, 0x60, 0xFF, 0xF7, 0xC1, 0xFD, 0x07, 0x00, 0x23, 0x68, 0x9A, 0x68, 0x00, 0x2A, 0x0D, 0xDB,
-    0x03, 0x21, 0xDA, 0x68, 0x0D, 0x40, 0x15, 0x43, 0xDD, 0x60, 0x01, 0x23, 0x00, 0x20, 0xA2, 0x6B,
-    0x8A, 0x43, 0x13, 0x43, 0xA3, 0x63, 0x00, 0x23, 0x33, 0x70, 0x11, 0xE0, 0xFF, 0xF7, 0xAC, 0xFD,
-    0xC0, 0x1B, 0x02, 0x28, 0xE8, 0xD9, 0x23, 0x68, 0x9B, 0x68, 0x00, 0x2B, 0xE4, 0xDA, 0x12, 0x23,
-    0xA2, 0x6B, 0x01, 0x20, 0x9A, 0x43, 0x02, 0x3B, 0x13, 0x43, 0xA3, 0x63, 0x00, 0x23, 0x33, 0x70,
-    0xF8, 0xBD, 0x20, 0x23, 0xA2, 0x6B, 0x01, 0x20, 0x13, 0x43, 0xA3, 0x63, 0xE3, 0xE7, 0xC0, 0x46,
-    0xFD, 0xFE, 0xFF, 0xFF, 0x10, 0xB5, 0xFF, 0x24, 0x03, 0x22, 0x0B, 0x00, 0x21, 0x00, 0x02, 0x40,
-    0xD2, 0x00, 0x91, 0x40, 0x9B, 0x01, 0x23, 0x40, 0xC9, 0x43, 0x93, 0x40, 0x00, 0x28, 0x0A, 0xDB,
-    0xC0, 0x24, 0x0B, 0x4A, 0x80, 0x08, 0x80, 0x00, 0x80, 0x18, 0xA4, 0x00, 0x02, 0x59, 0x0A, 0x40,
-    0x13, 0x43, 0x03, 0x51, 0x10, 0xBD, 0x0F, 0x22, 0x10, 0x40, 0x08, 0x38, 0x05, 0x4A, 0x80, 0x08,
-    0x80, 0x00, 0x80, 0x18, 0xC2, 0x69, 0x11, 0x40, 0x19, 0x43, 0xC1, 0x61, 0xF2, 0xE7, 0xC0, 0x46,
-    0x00, 0xE1, 0x00, 0xE0, 0x00, 0xED, 0x00, 0xE0, 0xBF, 0xF3, 0x4F, 0x8F, 0x03, 0x4B, 0x04, 0x4A,
-    0xDA, 0x60, 0xBF, 0xF3, 0x4F, 0x8F, 0xC0, 0x46, 0xFD, 0xE7, 0xC0, 0x46, 0x00, 0xED, 0x00, 0xE0,
-    0x04, 0x00, 0xFA, 0x05, 0x80, 0x22, 0x43, 0x1E, 0x52, 0x04, 0x01, 0x20, 0x93, 0x42, 0x0D, 0xD2,
-    0xC0, 0x21, 0x07, 0x4A, 0x07, 0x48, 0x53, 0x60, 0x03, 0x6A, 0x09, 0x06, 0x1B, 0x02, 0x1B, 0x0A,
-    0x0B, 0x43, 0x03, 0x62, 0x00, 0x20, 0x07, 0x23, 0x90, 0x60, 0x13, 0x60, 0x70, 0x47, 0xC0, 0x46,
-    0x10, 0xE0, 0x00, 0xE0, 0x00, 0xED, 0x00, 0xE0, 0x0C, 0x4A, 0x10, 0x21, 0xD0, 0x68, 0x30, 0xB5,
-    0x03, 0x00, 0x0B, 0x40, 0x08, 0x42, 0x05, 0xD0, 0x02, 0x23, 0x09, 0x48, 0xC4, 0x69, 0x23, 0x43,
-    0xC3, 0x61, 0x0B, 0x00, 0x04, 0x20, 0xD1, 0x68, 0x01, 0x42, 0x05, 0xD0, 0x01, 0x21, 0x04, 0x4C,
-    0x03, 0x43, 0xE5, 0x69, 0x29, 0x43, 0xE1, 0x61, 0xD3, 0x60, 0x30, 0xBD, 0x00, 0x20, 0x02, 0x40,
-    0xF8, 0x07, 0x00, 0x20, 0x06, 0x4B, 0x00, 0x20, 0x1A, 0x69, 0x12, 0x06, 0x06, 0xD5, 0x05, 0x4A,
-    0x5A, 0x60, 0x05, 0x4A, 0x5A, 0x60, 0x18, 0x69, 0x00, 0x06, 0xC0, 0x0F, 0x70, 0x47, 0xC0, 0x46,
-    0x00, 0x20, 0x02, 0x40, 0x23, 0x01, 0x67, 0x45, 0xAB, 0x89, 0xEF, 0xCD, 0x80, 0x23, 0x03, 0x4A,
-    0x00, 0x20, 0x11, 0x69, 0x0B, 0x43, 0x13, 0x61, 0x70, 0x47, 0xC0, 0x46, 0x00, 0x20, 0x02, 0x40,
-    0x70, 0xB5, 0x04, 0x00, 0xFF, 0xF7, 0x00, 0xFD, 0x01, 0x26, 0x05, 0x00, 0x10, 0x4B, 0xDA, 0x68,
-    0x32, 0x42, 0x11, 0xD1, 0x20, 0x22, 0xD9, 0x68, 0x11, 0x42, 0x00, 0xD0, 0xDA, 0x60, 0xD9, 0x68,
-    0x10, 0x22, 0x08, 0x00, 0x10, 0x40, 0x11, 0x42, 0x02, 0xD1, 0xDB, 0x68, 0x5B, 0x07, 0x08, 0xD5,
-    0xFF, 0xF7, 0xAA, 0xFF, 0x01, 0x20, 0x04, 0xE0, 0x62, 0x1C, 0xE8, 0xD0, 0x00, 0x2C, 0x01, 0xD1,
-    0x03, 0x20, 0x70, 0xBD, 0xFF, 0xF7, 0xE0, 0xFC, 0x40, 0x1B, 0xA0, 0x42, 0xDE, 0xD9, 0xF7, 0xE7,
-    0x00, 0x20, 0x02, 0x40, 0xF0, 0xB5, 0x85, 0xB0, 0x03, 0x93, 0x1E, 0x4B, 0x00, 0x91, 0x02, 0x92,
-    0x1A, 0x7E, 0x04, 0x00, 0x02, 0x20, 0x01, 0x2A, 0x31, 0xD0, 0x01, 0x22, 0x1A, 0x48, 0x1A, 0x76,
-    0xFF, 0xF7, 0xC6, 0xFF, 0x00, 0x28, 0x27, 0xD1, 0x26, 0x00, 0x01, 0x2C, 0x03, 0xD0, 0x04, 0x26,
-    0x02, 0x2C, 0x00, 0xD1, 0x26, 0x00, 0x00, 0x24, 0x12, 0x4B, 0x01, 0x93, 0x02, 0x98, 0x03, 0x99,
-    0x22, 0x01, 0xFE, 0xF7, 0x95, 0xF8, 0x00, 0x22, 0x01, 0x27, 0x01, 0x9B, 0x0F, 0x4D, 0xDA, 0x61,
-    0x2B, 0x69, 0x00, 0x9A, 0x3B, 0x43, 0x2B, 0x61, 0x63, 0x00, 0x9B, 0x18, 0x80, 0xB2, 0x18, 0x80,
-    0x09, 0x48, 0xFF, 0xF7, 0xA5, 0xFF, 0x2B, 0x69, 0xBB, 0x43, 0x2B, 0x61, 0x00, 0x28, 0x03, 0xD1,
-    0xE4, 0x19, 0xE3, 0xB2, 0x9E, 0x42, 0xE1, 0xD8, 0x00, 0x22, 0x02, 0x4B, 0x1A, 0x76, 0x05, 0xB0,
-    0xF0, 0xBD, 0xC0, 0x46, 0xF8, 0x07, 0x00, 0x20, 0x50, 0xC3, 0x00, 0x00, 0x00, 0x20, 0x02, 0x40,
-    0x00, 0x22, 0x06, 0x4B, 0xDA, 0x61, 0x06, 0x4B, 0x04, 0x32, 0x19, 0x69, 0x0A, 0x43, 0x1A, 0x61,
-    0x40, 0x22, 0x19, 0x69, 0x0A, 0x43, 0x1A, 0x61, 0x70, 0x47, 0xC0, 0x46, 0xF8, 0x07, 0x00, 0x20,
-    0x00, 0x20, 0x02, 0x40, 0x00, 0x22, 0x06, 0x4B, 0xDA, 0x61, 0x06, 0x4B, 0x02, 0x32, 0x19, 0x69,
-    0x0A, 0x43, 0x1A, 0x61, 0x40, 0x22, 0x58, 0x61, 0x19, 0x69, 0x0A, 0x43, 0x1A, 0x61, 0x70, 0x47,
-    0xF8, 0x07, 0x00, 0x20, 0x00, 0x20, 0x02, 0x40, 0xF8, 0xB5, 0x21, 0x4F, 0x04, 0x00, 0x3B, 0x7E,
-    0x0E, 0x00, 0x02, 0x20, 0x01, 0x2B, 0x0C, 0xD0, 0x01, 0x23, 0x3B, 0x76, 0x23, 0x68, 0x1D, 0x48,
-    0x01, 0x2B, 0x12, 0xD1, 0xFF, 0xF7, 0x5C, 0xFF, 0x00, 0x28, 0x03, 0xD0, 0x01, 0x20, 0x00, 0x23,
-    0x3B, 0x76, 0xF8, 0xBD, 0xFF, 0xF7, 0xC4, 0xFF, 0x16, 0x48, 0xFF, 0xF7, 0x51, 0xFF, 0x04, 0x21,
-    0x15, 0x4A, 0x13, 0x69, 0x8B, 0x43, 0x13, 0x61, 0xF1, 0xE7, 0xFF, 0xF7, 0x49, 0xFF, 0x00, 0x28,
-    0xEC, 0xD1, 0x01, 0x23, 0x5B, 0x42, 0x33, 0x60, 0x65, 0x68, 0x01, 0x30, 0xA3, 0x68, 0x62, 0x68,
-    0x9B, 0x02, 0x9B, 0x18, 0xAB, 0x42, 0xE2, 0xD9, 0x28, 0x00, 0xFF, 0xF7, 0xBB, 0xFF, 0x09, 0x48,
-    0xFF, 0xF7, 0x36, 0xFF, 0x02, 0x21, 0x08, 0x4A, 0x13, 0x69, 0x8B, 0x43, 0x13, 0x61, 0x00, 0x28,
-    0x01, 0xD0, 0x35, 0x60, 0xD3, 0xE7, 0x80, 0x23, 0xDB, 0x00, 0xED, 0x18, 0xE6, 0xE7, 0xC0, 0x46,
-    0xF8, 0x07, 0x00, 0x20, 0x50, 0xC3, 0x00, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x23, 0xF0, 0xB5,
-    0x87, 0xB0, 0x0A, 0x68, 0x14, 0x00, 0xDC, 0x40, 0x01, 0xD1, 0x07, 0xB0, 0xF0, 0xBD, 0x01, 0x25,
-    0x14, 0x00, 0x9D, 0x40, 0x2C, 0x40, 0x00, 0x94, 0x2A, 0x42, 0x00, 0xD1, 0x98, 0xE0, 0x4A, 0x68,
-    0x5F, 0x00, 0x94, 0x46, 0x03, 0x22, 0x64, 0x46, 0x22, 0x40, 0x03, 0x24, 0xBC, 0x40, 0xE4, 0x43,
-    0x01, 0x94, 0x54, 0x1E, 0x01, 0x2C, 0x2E, 0xD8, 0x86, 0x68, 0x01, 0x9C, 0x26, 0x40, 0xCC, 0x68,
-    0xBC, 0x40, 0x34, 0x43, 0x84, 0x60, 0x44, 0x68, 0x01, 0x26, 0xAC, 0x43, 0x25, 0x00, 0x64, 0x46,
-    0x24, 0x09, 0x34, 0x40, 0x9C, 0x40, 0x2C, 0x43, 0x44, 0x60, 0xC5, 0x68, 0x01, 0x9C, 0x25, 0x40,
-    0x8C, 0x68, 0xBC, 0x40, 0x2C, 0x43, 0xC4, 0x60, 0x02, 0x2A, 0x16, 0xD1, 0x07, 0x25, 0x0F, 0x26,
-    0x1D, 0x40, 0xAD, 0x00, 0xAE, 0x40, 0xDC, 0x08, 0xA4, 0x00, 0x04, 0x19, 0x02, 0x94, 0x24, 0x6A,
-    0x03, 0x96, 0x26, 0x00, 0x03, 0x9C, 0xA6, 0x43, 0x34, 0x00, 0x0E, 0x69, 0xAE, 0x40, 0x26, 0x43,
-    0x02, 0x9C, 0x26, 0x62, 0x01, 0xE0, 0x03, 0x2A, 0xDF, 0xD1, 0xBA, 0x40, 0x04, 0x68, 0x01, 0x9D,
-    0x25, 0x40, 0x2A, 0x43, 0xC0, 0x24, 0x02, 0x60, 0x62, 0x46, 0xA4, 0x02, 0x22, 0x42, 0x4F, 0xD0,
-    0x01, 0x25, 0x28, 0x4A, 0x90, 0x27, 0x94, 0x69, 0xFF, 0x05, 0x2C, 0x43, 0x94, 0x61, 0x92, 0x69,
-    0x9C, 0x08, 0x2A, 0x40, 0x05, 0x92, 0x05, 0x9A, 0x23, 0x4A, 0xA4, 0x00, 0xA4, 0x18, 0x0F, 0x22,
-    0x02, 0x35, 0x1D, 0x40, 0xAD, 0x00, 0xAA, 0x40, 0xA6, 0x68, 0x96, 0x43, 0x00, 0x22, 0xB8, 0x42,
-    0x0C, 0xD0, 0x1E, 0x4F, 0x01, 0x32, 0xB8, 0x42, 0x08, 0xD0, 0x1D, 0x4F, 0x01, 0x32, 0xB8, 0x42,
-    0x04, 0xD0, 0x1C, 0x4F, 0x03, 0x32, 0xB8, 0x42, 0x00, 0xD1, 0x02, 0x3A, 0xAA, 0x40, 0x67, 0x46,
-    0x32, 0x43, 0xA2, 0x60, 0x18, 0x4A, 0x00, 0x9C, 0x96, 0x68, 0x00, 0x9D, 0xE4, 0x43, 0x35, 0x43,
-    0xFF, 0x02, 0x01, 0xD4, 0x35, 0x00, 0x25, 0x40, 0x67, 0x46, 0x95, 0x60, 0xD6, 0x68, 0x00, 0x9D,
-    0x35, 0x43, 0xBF, 0x02, 0x01, 0xD4, 0x35, 0x00, 0x25, 0x40, 0x67, 0x46, 0xD5, 0x60, 0x56, 0x68,
-    0x00, 0x9D, 0x35, 0x43, 0xBF, 0x03, 0x01, 0xD4, 0x35, 0x00, 0x25, 0x40, 0x67, 0x46, 0x55, 0x60,
-    0x15, 0x68, 0x00, 0x9E, 0x2E, 0x43, 0xFF, 0x03, 0x01, 0xD4, 0x25, 0x40, 0x2E, 0x00, 0x16, 0x60,
-    0x01, 0x33, 0x56, 0xE7, 0x00, 0x10, 0x02, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x48,
-    0x00, 0x08, 0x00, 0x48, 0x00, 0x0C, 0x00, 0x48, 0x00, 0x04, 0x01, 0x40, 0x00, 0x69, 0x08, 0x40,
-    0x43, 0x1E, 0x98, 0x41, 0xC0, 0xB2, 0x70, 0x47, 0x00, 0x2A, 0x01, 0xD0, 0x81, 0x61, 0x70, 0x47,
-    0x81, 0x62, 0xFC, 0xE7, 0x70, 0xB5, 0x05, 0x00, 0x02, 0x23, 0x3D, 0x35, 0x2B, 0x70, 0x03, 0x68,
-    0x10, 0x4A, 0x19, 0x6A, 0x04, 0x00, 0x11, 0x42, 0x07, 0xD1, 0x19, 0x6A, 0x0E, 0x4A, 0x11, 0x42,
-    0x03, 0xD1, 0x01, 0x21, 0x1A, 0x68, 0x8A, 0x43, 0x1A, 0x60, 0x20, 0x00, 0xFF, 0xF7, 0x3C, 0xFA,
-    0x23, 0x00, 0x00, 0x20, 0x46, 0x33, 0x18, 0x70, 0x3C, 0x34, 0x08, 0x3B, 0x18, 0x70, 0x58, 0x70,
-    0x98, 0x70, 0xD8, 0x70, 0x18, 0x71, 0x58, 0x71, 0x98, 0x71, 0xD8, 0x71, 0x28, 0x70, 0x20, 0x70,
-    0x70, 0xBD, 0xC0, 0x46, 0x11, 0x11, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
-    0x01, 0x20, 0x10, 0xB5, 0x3D, 0x31, 0x0C, 0x78, 0xE2, 0xB2, 0x84, 0x42, 0x15, 0xD1, 0x00, 0x18,
-    0x08, 0x70, 0x1B, 0x68, 0xD9, 0x68, 0x11, 0x43, 0xD9, 0x60, 0x09, 0x49, 0x8B, 0x42, 0x02, 0xD0,
-    0x08, 0x49, 0x8B, 0x42, 0x0A, 0xD1, 0x07, 0x21, 0x9A, 0x68, 0x0A, 0x40, 0x06, 0x2A, 0x03, 0xD0,
-    0x01, 0x22, 0x19, 0x68, 0x0A, 0x43, 0x1A, 0x60, 0x00, 0x20, 0x10, 0xBD, 0x19, 0x68, 0xF9, 0xE7,
-    0x00, 0x2C, 0x01, 0x40, 0x00, 0x04, 0x00, 0x40, 0x10, 0xB5, 0x1B, 0x4C, 0x03, 0x68, 0xA0, 0x42,
-    0x0A, 0xD0, 0x1A, 0x4A, 0x90, 0x42, 0x07, 0xD0, 0x19, 0x4A, 0x90, 0x42, 0x09, 0xD1, 0x19, 0x4A,
-    0x1A, 0x40, 0xCB, 0x68, 0x13, 0x43, 0x0A, 0xE0, 0x70, 0x22, 0x93, 0x43, 0x4A, 0x68, 0x13, 0x43,
-    0xF5, 0xE7, 0x15, 0x4A, 0x90, 0x42, 0xF2, 0xD0, 0x14, 0x4A, 0x90, 0x42, 0xEF, 0xD0, 0x80, 0x22,
-    0x93, 0x43, 0x4A, 0x69, 0x13, 0x43, 0x03, 0x60, 0x8B, 0x68, 0xC3, 0x62, 0x0B, 0x68, 0x83, 0x62,
-    0xA0, 0x42, 0x05, 0xD0, 0x0C, 0x4B, 0x98, 0x42, 0x02, 0xD0, 0x0C, 0x4B, 0x98, 0x42, 0x01, 0xD1,
-    0x0B, 0x69, 0x03, 0x63, 0x01, 0x22, 0x42, 0x61, 0x03, 0x69, 0x13, 0x42, 0x02, 0xD0, 0x03, 0x69,
-    0x93, 0x43, 0x03, 0x61, 0x10, 0xBD, 0xC0, 0x46, 0x00, 0x2C, 0x01, 0x40, 0x00, 0x04, 0x00, 0x40,
-    0x00, 0x20, 0x00, 0x40, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x44, 0x01, 0x40, 0x00, 0x48, 0x01, 0x40,
-    0x70, 0xB5, 0x04, 0x00, 0x01, 0x20, 0x00, 0x2C, 0x21, 0xD0, 0x25, 0x00, 0x3D, 0x35, 0x2B, 0x78,
-    0xDA, 0xB2, 0x00, 0x2B, 0x05, 0xD1, 0x23, 0x00, 0x3C, 0x33, 0x20, 0x00, 0x1A, 0x70, 0xFF, 0xF7,
-    0x85, 0xF9, 0x02, 0x23, 0x2B, 0x70, 0x20, 0x68, 0x21, 0x1D, 0xFF, 0xF7, 0xA5, 0xFF, 0x22, 0x00,
-    0x01, 0x23, 0x00, 0x20, 0x46, 0x32, 0x13, 0x70, 0x45, 0x34, 0x08, 0x3A, 0x13, 0x70, 0x53, 0x70,
-    0x93, 0x70, 0xD3, 0x70, 0x13, 0x71, 0x53, 0x71, 0x93, 0x71, 0x23, 0x70, 0x2B, 0x70, 0x70, 0xBD,
-    0xF7, 0xB5, 0x03, 0x00, 0x00, 0x22, 0x0C, 0x68, 0x00, 0x92, 0x20, 0x00, 0x00, 0x9A, 0xD0, 0x40,
-    0x00, 0xD1, 0xFE, 0xBD, 0x01, 0x20, 0x00, 0x9A, 0x90, 0x40, 0x22, 0x00, 0x02, 0x40, 0x04, 0x42,
-    0x31, 0xD0, 0x48, 0x68, 0x03, 0x25, 0x01, 0x90, 0x10, 0x00, 0x50, 0x43, 0x45, 0x43, 0x01, 0x9E,
-    0xED, 0x43, 0x77, 0x1E, 0x01, 0x2F, 0x0B, 0xD8, 0x8F, 0x68, 0x9E, 0x68, 0x47, 0x43, 0x2E, 0x40,
-    0x37, 0x43, 0x9F, 0x60, 0x5F, 0x68, 0xCE, 0x68, 0xA7, 0x43, 0x74, 0x43, 0x27, 0x43, 0x5F, 0x60,
-    0x0C, 0x69, 0xDF, 0x68, 0x44, 0x43, 0x2F, 0x40, 0x3C, 0x43, 0xDC, 0x60, 0x01, 0x9C, 0x02, 0x2C,
-    0x0B, 0xD1, 0x4F, 0x69, 0xFF, 0x2A, 0x11, 0xD8, 0x04, 0x00, 0x0F, 0x26, 0x44, 0x43, 0x66, 0x43,
-    0x7C, 0x43, 0x1A, 0x6A, 0xB2, 0x43, 0x22, 0x43, 0x1A, 0x62, 0x01, 0x9C, 0x1A, 0x68, 0x60, 0x43,
-    0x2A, 0x40, 0x02, 0x43, 0x1A, 0x60, 0x00, 0x9A, 0x01, 0x32, 0xBC, 0xE7, 0x0F, 0x26, 0x12, 0x0A,
-    0x52, 0x43, 0x52, 0x43, 0x56, 0x43, 0x57, 0x43, 0x5C, 0x6A, 0xB4, 0x43, 0x3C, 0x43, 0x5C, 0x62,
-    0xEB, 0xE7, 0x00, 0x00, 0x08, 0x4A, 0x01, 0x23, 0x90, 0x42, 0x0A, 0xD1, 0x80, 0x22, 0x07, 0x4B,
-    0x92, 0x03, 0x19, 0x69, 0x0A, 0x43, 0x1A, 0x61, 0x1A, 0x69, 0x05, 0x49, 0x0A, 0x40, 0x1A, 0x61,
-    0x00, 0x23, 0x18, 0x00, 0x70, 0x47, 0xC0, 0x46, 0x00, 0x54, 0x00, 0x40, 0x00, 0x10, 0x02, 0x40,
-    0xFF, 0xFF, 0xDF, 0xFF, 0x01, 0x22, 0x03, 0x68, 0x30, 0xB5, 0x93, 0x43, 0x03, 0x60, 0xCB, 0x68,
-    0x8D, 0x68, 0x1B, 0x02, 0x04, 0x68, 0x2B, 0x43, 0x14, 0x4D, 0x2C, 0x40, 0x23, 0x43, 0x03, 0x60,
-    0x4B, 0x68, 0x0D, 0x69, 0x03, 0x61, 0x03, 0x68, 0x1A, 0x43, 0x02, 0x60, 0x83, 0x68, 0x10, 0x4A,
-    0x13, 0x40, 0x83, 0x60, 0x84, 0x68, 0x8B, 0x69, 0xE4, 0x0A, 0x2B, 0x43, 0xE4, 0x02, 0x23, 0x43,
-    0x83, 0x60, 0x00, 0x2D, 0x04, 0xD0, 0x80, 0x23, 0x84, 0x68, 0x1B, 0x02, 0x23, 0x43, 0x83, 0x60,
-    0x03, 0x68, 0x08, 0x4C, 0x23, 0x40, 0x0C, 0x68, 0x23, 0x43, 0x03, 0x60, 0x43, 0x68, 0x13, 0x40,
-    0x4A, 0x69, 0x13, 0x43, 0x43, 0x60, 0x00, 0x20, 0x30, 0xBD, 0xC0, 0x46, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x01, 0x4B, 0x18, 0x60, 0x70, 0x47, 0xC0, 0x46,
-    0x10, 0x01, 0x00, 0x20, 0x0D, 0x48, 0x85, 0x46, 0xFF, 0xF7, 0x8A, 0xF8, 0x0C, 0x48, 0x0D, 0x49,
-    0x0D, 0x4A, 0x00, 0x23, 0x02, 0xE0, 0xD4, 0x58, 0xC4, 0x50, 0x04, 0x33, 0xC4, 0x18, 0x8C, 0x42,
-    0xF9, 0xD3, 0x0A, 0x4A, 0x0A, 0x4C, 0x00, 0x23, 0x01, 0xE0, 0x13, 0x60, 0x04, 0x32, 0xA2, 0x42,
-    0xFB, 0xD3, 0x00, 0xF0, 0x1B, 0xF9, 0xFE, 0xF7, 0x3F, 0xFB, 0xFE, 0xE7, 0x00, 0x10, 0x00, 0x20,
-    0xC0, 0x00, 0x00, 0x20, 0x6C, 0x01, 0x00, 0x20, 0xFC, 0x3A, 0x00, 0x08, 0x70, 0x01, 0x00, 0x20,
-    0x60, 0x09, 0x00, 0x20, 0xFE, 0xE7, 0x00, 0x00, 0x10, 0xB5, 0x03, 0x4B, 0x0A, 0x00, 0x01, 0x00,
-    0x18, 0x68, 0x00, 0xF0, 0x03, 0xF8, 0x10, 0xBD, 0x1C, 0x01, 0x00, 0x20, 0x70, 0xB5, 0x0B, 0x0C,
-    0x15, 0x0C, 0x00, 0x2B, 0x1E, 0xD1, 0x00, 0x2D, 0x0C, 0xD1, 0x89, 0xB2, 0x94, 0xB2, 0x4C, 0x43,
-    0x21, 0x00, 0x00, 0xF0, 0x43, 0xF8, 0x05, 0x1E, 0x1B, 0xD0, 0x22, 0x00, 0x00, 0x21, 0x00, 0xF0,
-    0xCD, 0xF8, 0x16, 0xE0, 0x2B, 0x1C, 0x0C, 0x1C, 0x89, 0xB2, 0x92, 0xB2, 0x4A, 0x43, 0x9B, 0xB2,
-    0xA1, 0xB2, 0x59, 0x43, 0x14, 0x0C, 0x0C, 0x19, 0x23, 0x0C, 0x07, 0xD1, 0x24, 0x04, 0x92, 0xB2,
-    0x14, 0x43, 0xE5, 0xE7, 0x00, 0x2D, 0x01, 0xD1, 0x14, 0x1C, 0xED, 0xE7, 0x0C, 0x23, 0x00, 0x25,
-    0x03, 0x60, 0x28, 0x00, 0x70, 0xBD, 0x00, 0x00, 0x70, 0xB5, 0x0F, 0x4E, 0x0D, 0x00, 0x31, 0x68,
-    0x04, 0x00, 0x00, 0x29, 0x02, 0xD1, 0x00, 0xF0, 0xB1, 0xF8, 0x30, 0x60, 0x29, 0x00, 0x20, 0x00,
-    0x00, 0xF0, 0xAC, 0xF8, 0x43, 0x1C, 0x03, 0xD1, 0x01, 0x25, 0x6D, 0x42, 0x28, 0x00, 0x70, 0xBD,
-    0x03, 0x23, 0xC5, 0x1C, 0x9D, 0x43, 0xA8, 0x42, 0xF8, 0xD0, 0x29, 0x1A, 0x20, 0x00, 0x00, 0xF0,
-    0x9D, 0xF8, 0x01, 0x30, 0xF2, 0xD1, 0xEF, 0xE7, 0x18, 0x08, 0x00, 0x20, 0xF7, 0xB5, 0x03, 0x22,
-    0xCB, 0x1C, 0x93, 0x43, 0x08, 0x33, 0x05, 0x00, 0x1F, 0x00, 0x0C, 0x2B, 0x34, 0xD2, 0x0C, 0x27,
-    0xB9, 0x42, 0x33, 0xD8, 0x28, 0x00, 0x00, 0xF0, 0x71, 0xF8, 0x37, 0x4E, 0x33, 0x68, 0x1C, 0x00,
-    0x00, 0x2C, 0x2F, 0xD1, 0x39, 0x00, 0x28, 0x00, 0xFF, 0xF7, 0xC6, 0xFF, 0x04, 0x00, 0x43, 0x1C,
-    0x5F, 0xD1, 0x34, 0x68, 0x00, 0x94, 0x00, 0x9B, 0x00, 0x2B, 0x4A, 0xD1, 0x00, 0x2C, 0x52, 0xD0,
-    0x23, 0x68, 0x28, 0x00, 0xE3, 0x18, 0x00, 0x99, 0x01, 0x93, 0x00, 0xF0, 0x6F, 0xF8, 0x01, 0x9B,
-    0x83, 0x42, 0x48, 0xD1, 0x23, 0x68, 0x28, 0x00, 0xFF, 0x1A, 0x39, 0x00, 0xFF, 0xF7, 0xAC, 0xFF,
-    0x01, 0x30, 0x40, 0xD0, 0x23, 0x68, 0xDB, 0x19, 0x23, 0x60, 0x33, 0x68, 0x5A, 0x68, 0x00, 0x2A,
-    0x33, 0xD1, 0x00, 0x9B, 0x33, 0x60, 0x19, 0xE0, 0x00, 0x2B, 0xC9, 0xDA, 0x0C, 0x23, 0x2B, 0x60,
-    0x00, 0x20, 0xFE, 0xBD, 0x21, 0x68, 0xC9, 0x1B, 0x20, 0xD4, 0x0B, 0x29, 0x0A, 0xD9, 0xE2, 0x19,
-    0x27, 0x60, 0xA3, 0x42, 0x04, 0xD1, 0x32, 0x60, 0x63, 0x68, 0x11, 0x60, 0x53, 0x60, 0x05, 0xE0,
-    0x5A, 0x60, 0xF9, 0xE7, 0x62, 0x68, 0xA3, 0x42, 0x0E, 0xD1, 0x32, 0x60, 0x28, 0x00, 0x00, 0xF0,
-    0x2D, 0xF8, 0x20, 0x00, 0x07, 0x22, 0x0B, 0x30, 0x23, 0x1D, 0x90, 0x43, 0xC2, 0x1A, 0x98, 0x42,
-    0xDF, 0xD0, 0x1B, 0x1A, 0xA3, 0x50, 0xDC, 0xE7, 0x5A, 0x60, 0xEF, 0xE7, 0x23, 0x00, 0x64, 0x68,
-    0xA6, 0xE7, 0x00, 0x9C, 0x63, 0x68, 0x00, 0x93, 0xAD, 0xE7, 0x1A, 0x00, 0x5B, 0x68, 0xA3, 0x42,
-    0xFB, 0xD1, 0x00, 0x23, 0xDA, 0xE7, 0x0C, 0x23, 0x28, 0x00, 0x2B, 0x60, 0x00, 0xF0, 0x0E, 0xF8,
-    0xC6, 0xE7, 0x07, 0x60, 0xDA, 0xE7, 0xC0, 0x46, 0x1C, 0x08, 0x00, 0x20, 0x10, 0xB5, 0x02, 0x48,
-    0x00, 0xF0, 0x50, 0xF8, 0x10, 0xBD, 0xC0, 0x46, 0x58, 0x09, 0x00, 0x20, 0x10, 0xB5, 0x02, 0x48,
-    0x00, 0xF0, 0x49, 0xF8, 0x10, 0xBD, 0xC0, 0x46, 0x58, 0x09, 0x00, 0x20, 0x03, 0x00, 0x82, 0x18,
-    0x93, 0x42, 0x00, 0xD1, 0x70, 0x47, 0x19, 0x70, 0x01, 0x33, 0xF9, 0xE7, 0x00, 0x23, 0x70, 0xB5,
-    0x06, 0x4D, 0x04, 0x00, 0x08, 0x00, 0x2B, 0x60, 0xFE, 0xF7, 0x4A, 0xFF, 0x43, 0x1C, 0x03, 0xD1,
-    0x2B, 0x68, 0x00, 0x2B, 0x00, 0xD0, 0x23, 0x60, 0x70, 0xBD, 0xC0, 0x46, 0x5C, 0x09, 0x00, 0x20,
-    0x01, 0x4B, 0x18, 0x68, 0x70, 0x47, 0xC0, 0x46, 0x1C, 0x01, 0x00, 0x20, 0x70, 0xB5, 0x00, 0x26,
-    0x0C, 0x4C, 0x0D, 0x4D, 0x64, 0x1B, 0xA4, 0x10, 0xA6, 0x42, 0x09, 0xD1, 0x00, 0x26, 0x00, 0xF0,
-    0x25, 0xF8, 0x0A, 0x4C, 0x0A, 0x4D, 0x64, 0x1B, 0xA4, 0x10, 0xA6, 0x42, 0x05, 0xD1, 0x70, 0xBD,
-    0xB3, 0x00, 0xEB, 0x58, 0x98, 0x47, 0x01, 0x36, 0xEE, 0xE7, 0xB3, 0x00, 0xEB, 0x58, 0x98, 0x47,
-    0x01, 0x36, 0xF2, 0xE7, 0xF4, 0x3A, 0x00, 0x08, 0xF4, 0x3A, 0x00, 0x08, 0xF8, 0x3A, 0x00, 0x08,
-    0xF4, 0x3A, 0x00, 0x08, 0x70, 0x47, 0x70, 0x47, 0x00, 0x23, 0x10, 0xB5, 0x9A, 0x42, 0x00, 0xD1,
-    0x10, 0xBD, 0xCC, 0x5C, 0xC4, 0x54, 0x01, 0x33, 0xF8, 0xE7, 0x00, 0x00, 0xF8, 0xB5, 0xC0, 0x46,
-    0xF8, 0xBC, 0x08, 0xBC, 0x9E, 0x46, 0x70, 0x47, 0xF8, 0xB5, 0xC0, 0x46, 0xF8, 0xBC, 0x08, 0xBC,
-    0x9E, 0x46, 0x70, 0x47, 0x4D, 0x14, 0x00, 0x08, 0x21, 0x14, 0x00, 0x08, 0x01, 0x00, 0xF4, 0x01,
-    0xE8, 0x03, 0xD0, 0x07, 0xA0, 0x0F, 0x40, 0x1F, 0x28, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x48,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x7A, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x08, 0x00, 0x20, 0x88, 0x08, 0x00, 0x20, 0xF0, 0x08, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x85, 0x78, 0xAC
-};
-
-const uint32_t extio2_custom_firmware_len = sizeof(extio2_custom_firmware);
-
-#endif // FIRMWARE_CUSTOM_H
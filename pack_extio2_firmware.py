@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+Pack EXTIO2 firmware images into the extfw data partition
+
+Each image is compressed with heatshrink-style LZSS (window 2^10, lookahead
+2^4) and listed in a manifest with its name, version and CRC-32, as read by
+FirmwareStore on the Dial.
+
+Usage:
+    python3 pack_extio2_firmware.py [-o extio2/extfw.bin] [name:version:file.bin ...]
+
+Without images, packs the two in extio2/. `pio run -t upload` runs this
+through extio2_partition.py and writes the result; by hand:
+    esptool.py --chip esp32s3 write_flash 0x3D0000 extio2/extfw.bin
+"""
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = b'EXFW'
+FORMAT = 1
+WINDOW_BITS = 10
+LOOKAHEAD_BITS = 4
+MAX_IMAGES = 4
+NAME_LEN = 16
+PARTITION_SIZE = 0x20000     # extfw in partitions.csv
+HEADER = '<4sBBBBI'          # magic, format, count, window bits, lookahead bits, entries CRC
+ENTRY = '<16sB3xIIII'        # name, version, offset, compressed size, size, CRC-32
+
+DEFAULT_IMAGES = [
+    'custom:5:extio2/firmware_custom.bin',
+    'original:3:extio2/firmware_original.bin',
+]
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.bits = 0
+
+    def write(self, value, count):
+        for i in range(count - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.bits += 1
+            if self.bits == 8:
+                self.out.append(self.acc)
+                self.acc = 0
+                self.bits = 0
+
+    def finish(self):
+        if self.bits:
+            self.out.append(self.acc << (8 - self.bits))
+        return bytes(self.out)
+
+
+def compress(data):
+    """Greedy LZSS: tag 1 + byte, or tag 0 + (distance - 1) + (length - 1)"""
+    window = 1 << WINDOW_BITS
+    max_len = 1 << LOOKAHEAD_BITS
+    chains = {}  # 2-byte prefix -> positions, newest last
+    writer = BitWriter()
+    pos = 0
+    while pos < len(data):
+        best_len, best_dist = 0, 0
+        if pos + 1 < len(data):
+            for cand in reversed(chains.get(data[pos:pos + 2], [])):
+                dist = pos - cand
+                if dist > window:
+                    break
+                length = 0
+                while (length < max_len and pos + length < len(data)
+                       and data[cand + length] == data[pos + length]):
+                    length += 1
+                if length > best_len:
+                    best_len, best_dist = length, dist
+                    if length == max_len:
+                        break
+
+        # A back-reference (15 bits) pays off from 2 bytes (18 bits as literals)
+        step = best_len if best_len >= 2 else 1
+        if step > 1:
+            writer.write(0, 1)
+            writer.write(best_dist - 1, WINDOW_BITS)
+            writer.write(best_len - 1, LOOKAHEAD_BITS)
+        else:
+            writer.write(1, 1)
+            writer.write(data[pos], 8)
+        for p in range(pos, pos + step):
+            chains.setdefault(data[p:p + 2], []).append(p)
+        pos += step
+    return writer.finish()
+
+
+def decompress(packed, size):
+    """Reference decoder, used to check every image before writing"""
+    out = bytearray()
+    bit = 0
+
+    def read(count):
+        nonlocal bit
+        value = 0
+        for _ in range(count):
+            value = (value << 1) | ((packed[bit >> 3] >> (7 - (bit & 7))) & 1)
+            bit += 1
+        return value
+
+    while len(out) < size:
+        if read(1):
+            out.append(read(8))
+        else:
+            dist = read(WINDOW_BITS) + 1
+            length = read(LOOKAHEAD_BITS) + 1
+            for _ in range(length):
+                out.append(out[-dist])
+    return bytes(out[:size])
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack EXTIO2 firmware images into the extfw partition')
+    parser.add_argument('-o', '--output', default='extio2/extfw.bin')
+    parser.add_argument('images', nargs='*', default=DEFAULT_IMAGES, help='name:version:file.bin')
+    args = parser.parse_args()
+
+    if len(args.images) > MAX_IMAGES:
+        sys.exit(f'At most {MAX_IMAGES} images')
+
+    entries = []
+    blobs = []
+    offset = struct.calcsize(HEADER) + MAX_IMAGES * struct.calcsize(ENTRY)
+    for spec in args.images:
+        name, version, path = spec.split(':', 2)
+        if len(name) >= NAME_LEN:
+            sys.exit(f'Image name too long: {name}')
+        data = open(path, 'rb').read()
+        packed = compress(data)
+        if decompress(packed, len(data)) != data:
+            sys.exit(f'Round trip failed for {path}')
+        crc = zlib.crc32(data)
+        entries.append(struct.pack(ENTRY, name.encode(), int(version), offset, len(packed), len(data), crc))
+        blobs.append(packed)
+        print(f'{name}: v{version}, {len(data)} -> {len(packed)} bytes '
+              f'({100 * len(packed) / len(data):.0f}%), CRC {crc:08X}')
+        offset += len(packed)
+
+    table = b''.join(entries).ljust(MAX_IMAGES * struct.calcsize(ENTRY), b'\xff')
+    header = struct.pack(HEADER, MAGIC, FORMAT, len(entries), WINDOW_BITS, LOOKAHEAD_BITS, zlib.crc32(table))
+    image = header + table + b''.join(blobs)
+    if len(image) > PARTITION_SIZE:
+        sys.exit(f'{len(image)} bytes does not fit the {PARTITION_SIZE} byte partition')
+
+    with open(args.output, 'wb') as f:
+        f.write(image)
+    print(f'Wrote {args.output} ({len(image)} bytes)')
+
+
+if __name__ == '__main__':
+    main()
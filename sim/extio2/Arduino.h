@@ -0,0 +1,54 @@
+// Host stand-in for the Arduino core used by the EXTIO2 emulator
+// (sim/extio2_bench.cpp). Only what the EXTIO2-facing sources need.
+//
+// Time is virtual: millis()/micros() advance only through delay(),
+// delayMicroseconds() and bus traffic (Wire.h charges each transaction its
+// wire time), so runs are deterministic and "timed" means bus + sleep time as
+// the firmware would spend it, not host CPU time.
+
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define OUTPUT_OPEN_DRAIN 0x13
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Virtual clock (microseconds since start)
+uint64_t hostMicros();
+void hostAdvanceMicros(uint64_t us);
+
+// GPIO: only the I2C pins are modelled (bus clear in I2CBus::recover())
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+
+class HardwareSerial {
+public:
+    void begin(unsigned long) {}
+    void print(const char* text);
+    void println(const char* text = "");
+    int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    bool quiet = false;  // Suppress firmware chatter during benchmarks
+};
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,19 @@
+// Host stand-in for the ESP32 EEPROM emulation: erased (0xFF), as on a
+// fresh unit, so SettingsManager starts from its defaults.
+
+#ifndef SIM_EEPROM_H
+#define SIM_EEPROM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class EEPROMClass {
+public:
+    bool begin(size_t) { return true; }
+    void end() {}
+    uint8_t read(int) { return 0xFF; }
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
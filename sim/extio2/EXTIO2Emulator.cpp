@@ -0,0 +1,336 @@
+#include "EXTIO2Emulator.h"
+#include "Crc32.h"
+#include <Arduino.h>
+
+const EXTIO2Profile EXTIO2_STOCK = {"stock", 3, true, false, false};
+const EXTIO2Profile EXTIO2_CUSTOM = {"custom", 5, true, true, false};
+const EXTIO2Profile EXTIO2_CUSTOM_TIMER = {"custom-timer", 6, true, true, true};
+
+static constexpr uint8_t MODE_DIGITAL_OUTPUT = 1;
+static constexpr uint8_t MODE_PWM = 5;
+static constexpr uint8_t MODE_FAN_RPM = 6;
+static constexpr uint8_t PWM_FREQ_25KHZ = 5;
+static constexpr uint8_t FAN_START_DUTY = 10;  // Below this a 4-pin fan stops
+
+static constexpr uint8_t IAP_CMD_WRITE = 0x06;
+static constexpr uint8_t IAP_CMD_CRC = 0x08;
+static constexpr size_t IAP_CRC_REQUEST = 7;  // cmd, addr[4], len[2]
+static constexpr uint8_t IAP_CMD_JUMP = 0x77;
+static constexpr size_t IAP_HEADER = 8;  // cmd, addr[4], len[2], reserved
+
+// MAX31865
+
+static constexpr uint8_t MAX_CONFIG_BIAS = 0x80;
+static constexpr uint8_t MAX_CONFIG_1SHOT = 0x20;
+static constexpr uint8_t MAX_CONFIG_FAULT_CLEAR = 0x02;
+
+void MAX31865Model::pins(bool cs, bool clk, bool sdi) {
+    if (cs != _cs) {
+        _cs = cs;
+        if (!cs) {
+            // Transaction start: first byte is the address
+            _bitsIn = 0;
+            _byteIndex = 0;
+            _shiftIn = 0;
+            _sdoByte = 0;
+            _sdoBit = 0;
+        }
+    }
+
+    if (clk != _clk) {
+        _clk = clk;
+        if (_cs) return;
+        if (clk) {
+            // Rising edge: SDO keeps presenting the bit being sampled
+            _sdoByte = _byteIndex;
+            _sdoBit = _bitsIn;
+            _shiftIn = (_shiftIn << 1) | (sdi ? 1 : 0);
+            if (++_bitsIn == 8) {
+                byteComplete(_shiftIn);
+                _bitsIn = 0;
+                _shiftIn = 0;
+                _byteIndex++;
+            }
+        } else {
+            // Falling edge: shift the next bit out
+            _sdoByte = _byteIndex;
+            _sdoBit = _bitsIn;
+        }
+    }
+}
+
+bool MAX31865Model::sdo() const {
+    if (_cs || _writing || _sdoByte == 0) return true;  // High-Z (pulled up)
+    uint8_t value = const_cast<MAX31865Model*>(this)->readRegister((_address + _sdoByte - 1) & 0x07);
+    return (value >> (7 - _sdoBit)) & 0x01;
+}
+
+void MAX31865Model::byteComplete(uint8_t value) {
+    if (_byteIndex == 0) {
+        _address = value & 0x7F;
+        _writing = (value & 0x80) != 0;
+        return;
+    }
+    if (_writing) {
+        writeRegister((_address + _byteIndex - 1) & 0x07, value);
+    }
+}
+
+void MAX31865Model::writeRegister(uint8_t reg, uint8_t value) {
+    if (reg == 0x00) {
+        if (value & MAX_CONFIG_FAULT_CLEAR) {
+            _regs[0x07] = 0;
+            value &= ~MAX_CONFIG_FAULT_CLEAR;  // Self-clearing
+        }
+        _regs[0x00] = value;
+        if ((value & MAX_CONFIG_1SHOT) && (value & MAX_CONFIG_BIAS)) {
+            _converting = true;
+            _conversionDone = hostMicros() + CONVERSION_US;
+        }
+    } else if (reg >= 0x03 && reg <= 0x06) {
+        _regs[reg] = value;  // Fault thresholds; RTD and status are read-only
+    }
+}
+
+uint8_t MAX31865Model::readRegister(uint8_t reg) {
+    finishConversion();
+    return _regs[reg];
+}
+
+void MAX31865Model::finishConversion() {
+    if (!_converting || hostMicros() < _conversionDone) return;
+    _converting = false;
+    _regs[0x00] &= ~MAX_CONFIG_1SHOT;
+    _conversions++;
+
+    // Callendar-Van Dusen (C term below 0 °C)
+    const double a = 3.9083e-3, b = -5.775e-7, c = -4.183e-12;
+    double t = _temperature;
+    double r = R0 * (1.0 + a * t + b * t * t + (t < 0.0 ? c * (t - 100.0) * t * t * t : 0.0));
+    uint32_t code = static_cast<uint32_t>(r / RREF * 32768.0 + 0.5);
+    if (code > 0x7FFF) code = 0x7FFF;
+
+    _regs[0x07] |= _injectedFault;
+    if (_injectedFault & 0x80) code = 0x7FFF;  // Open RTD reads full scale
+    uint16_t reg = static_cast<uint16_t>(code << 1) | (_regs[0x07] ? 1 : 0);
+    _regs[0x01] = reg >> 8;
+    _regs[0x02] = reg & 0xFF;
+}
+
+// EXTIO2
+
+EXTIO2Emulator::EXTIO2Emulator(const EXTIO2Profile& profile) : _profile(&profile) {
+    memset(_flash, 0xFF, sizeof(_flash));
+}
+
+bool EXTIO2Emulator::busy() const {
+    return hostMicros() < _busyUntil;
+}
+
+bool EXTIO2Emulator::acknowledges(uint8_t addr) {
+    if (busy()) return false;
+    if (_mode == MODE_BOOTLOADER) return addr == BOOTLOADER_ADDR;
+    if (addr != APP_ADDR) return false;
+
+    // Software 25 kHz PWM (no timer) leaves the I2C interrupt starved
+    if (!_profile->timerPwm && _regs[REG_PWM_FREQ] == PWM_FREQ_25KHZ) {
+        for (int pin = 0; pin < 8; pin++) {
+            if (getPinMode(pin) == MODE_PWM) return ++_starveCount % 3 != 0;
+        }
+    }
+    return true;
+}
+
+bool EXTIO2Emulator::receive(uint8_t addr, const uint8_t* data, size_t len) {
+    if (len == 0) return true;
+    if (addr == BOOTLOADER_ADDR) {
+        bootloaderWrite(data, len);
+    } else {
+        appWrite(data, len);
+    }
+    return true;
+}
+
+void EXTIO2Emulator::transmit(uint8_t addr, uint8_t* out, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (addr == APP_ADDR) {
+            out[i] = appRead(_pointer++);
+        } else {
+            out[i] = i < _replyLength ? _reply[i] : 0xFF;
+        }
+    }
+}
+
+bool EXTIO2Emulator::supported(uint8_t reg, uint8_t value) const {
+    if (reg < REG_MODE + 8) {
+        if (value <= 4) return true;
+        if (value == MODE_PWM) return _profile->pwmMode;
+        if (value == MODE_FAN_RPM) return _profile->fanRpmMode;
+        return false;
+    }
+    if (reg >= REG_PWM_DUTY && reg < REG_PWM_DUTY + 8) return _profile->pwmMode && value <= 100;
+    if (reg == REG_PWM_FREQ) {
+        return _profile->pwmMode && (value < PWM_FREQ_25KHZ || (value == PWM_FREQ_25KHZ && _profile->fanRpmMode));
+    }
+    if (reg >= REG_INPUT && reg < REG_INPUT + 8) return false;  // Read-only
+    if (reg >= REG_FAN_RPM && reg < REG_FAN_RPM + 16) return false;
+    if (reg == REG_VERSION) return false;
+    return true;
+}
+
+void EXTIO2Emulator::appWrite(const uint8_t* data, size_t len) {
+    _pointer = data[0];
+    bool pinsChanged = false;
+    for (size_t i = 1; i < len; i++) {
+        uint8_t reg = _pointer++;
+        if (reg == REG_IAP) {
+            if (data[i] == 0x01) {
+                // Reset into the bootloader
+                _mode = MODE_BOOTLOADER;
+                _busyUntil = hostMicros() + RESET_US;
+                return;
+            }
+            continue;
+        }
+        if (!supported(reg, data[i])) continue;
+        _regs[reg] = data[i];
+        if (reg < REG_OUTPUT + 8) pinsChanged = true;
+    }
+    if (pinsChanged) outputsChanged();
+}
+
+uint8_t EXTIO2Emulator::appRead(uint8_t reg) const {
+    if (reg >= REG_INPUT && reg < REG_INPUT + 8) {
+        uint8_t pin = reg - REG_INPUT;
+        if (_sensor && pin == _sensorSdo) return _sensor->sdo() ? 1 : 0;
+        if (getPinMode(pin) == MODE_DIGITAL_OUTPUT) return getOutput(pin) ? 1 : 0;
+        return _inputLevel[pin] ? 1 : 0;
+    }
+    if (reg >= REG_FAN_RPM && reg < REG_FAN_RPM + 16) {
+        uint8_t pin = (reg - REG_FAN_RPM) / 2;
+        if (!_profile->fanRpmMode || getPinMode(pin) != MODE_FAN_RPM) return 0;
+        uint16_t rpm = getFanRPM(pin);
+        return ((reg - REG_FAN_RPM) & 1) ? rpm >> 8 : rpm & 0xFF;
+    }
+    if (reg == REG_VERSION) return _profile->version;
+    if ((reg >= REG_PWM_DUTY && reg < REG_PWM_DUTY + 8) || reg == REG_PWM_FREQ) {
+        return _profile->pwmMode ? _regs[reg] : 0;
+    }
+    return _regs[reg];
+}
+
+void EXTIO2Emulator::outputsChanged() {
+    if (!_sensor) return;
+    // Pins not driven as outputs float high (pull-ups on the breakout)
+    auto level = [this](uint8_t pin) {
+        return getPinMode(pin) == MODE_DIGITAL_OUTPUT ? getOutput(pin) : true;
+    };
+    _sensor->pins(level(_sensorCs), level(_sensorClk), level(_sensorSdi));
+}
+
+void EXTIO2Emulator::bootloaderWrite(const uint8_t* data, size_t len) {
+    if (data[0] == IAP_CMD_JUMP) {
+        jumpToApp();
+        return;
+    }
+    _replyLength = 0;
+    if (data[0] == IAP_CMD_CRC) _crcRequests++;
+    if (len < IAP_CRC_REQUEST) return;
+
+    uint32_t address = (static_cast<uint32_t>(data[1]) << 24) | (static_cast<uint32_t>(data[2]) << 16) |
+                       (static_cast<uint32_t>(data[3]) << 8) | data[4];
+    uint32_t rangeLen = (static_cast<uint32_t>(data[5]) << 8) | data[6];
+    if (address < FLASH_BASE || address + rangeLen > FLASH_BASE + FLASH_SIZE) return;
+
+    if (data[0] == IAP_CMD_CRC && _bootloaderCrc && len == IAP_CRC_REQUEST) {
+        uint32_t crc = crc32(_flash + (address - FLASH_BASE), rangeLen);
+        _reply[0] = IAP_CMD_CRC;
+        _reply[1] = crc >> 24;
+        _reply[2] = crc >> 16;
+        _reply[3] = crc >> 8;
+        _reply[4] = crc;
+        _reply[5] = ~IAP_CMD_CRC;
+        _replyLength = sizeof(_reply);
+        _busyUntil = hostMicros() + CRC_US;
+        return;
+    }
+
+    if (data[0] != IAP_CMD_WRITE || rangeLen != PAGE_SIZE || len != IAP_HEADER + rangeLen) return;
+    if ((address - FLASH_BASE) % PAGE_SIZE != 0) return;
+
+    uint8_t* page = _flash + (address - FLASH_BASE);
+    memcpy(page, data + IAP_HEADER, PAGE_SIZE);
+    if (_corruptWrites > 0) {
+        _corruptWrites--;
+        page[PAGE_SIZE / 2] ^= 0x10;
+    }
+    _pageWrites++;
+    _busyUntil = hostMicros() + _pageWriteUs;
+}
+
+void EXTIO2Emulator::jumpToApp() {
+    for (const Image& image : _images) {
+        if (memcmp(_flash, image.data.data(), image.data.size()) == 0) {
+            _profile = image.profile;
+            powerCycle();
+            _busyUntil = hostMicros() + RESET_US;
+            return;
+        }
+    }
+    // Unrecognised image: the bootloader refuses to start it
+}
+
+void EXTIO2Emulator::powerCycle() {
+    memset(_regs, 0, sizeof(_regs));
+    _pointer = 0;
+    _mode = MODE_APP;
+    _busyUntil = 0;
+    outputsChanged();
+}
+
+void EXTIO2Emulator::attachMAX31865(MAX31865Model* sensor, uint8_t clk, uint8_t sdo, uint8_t sdi, uint8_t cs) {
+    _sensor = sensor;
+    _sensorClk = clk;
+    _sensorSdo = sdo;
+    _sensorSdi = sdi;
+    _sensorCs = cs;
+    outputsChanged();
+}
+
+void EXTIO2Emulator::attachFan(uint8_t tachPin, uint8_t pwmPin, uint16_t maxRpm) {
+    Fan fan = {tachPin, pwmPin, maxRpm, false};
+    _fans.push_back(fan);
+}
+
+void EXTIO2Emulator::setFanStalled(uint8_t tachPin, bool stalled) {
+    for (Fan& fan : _fans) {
+        if (fan.tachPin == tachPin) fan.stalled = stalled;
+    }
+}
+
+uint16_t EXTIO2Emulator::getFanRPM(uint8_t tachPin) const {
+    for (const Fan& fan : _fans) {
+        if (fan.tachPin != tachPin) continue;
+        if (fan.stalled) return 0;
+        // A 4-pin fan with its PWM input floating runs flat out
+        if (getPinMode(fan.pwmPin) != MODE_PWM) return fan.maxRpm;
+        uint8_t duty = getPWMDuty(fan.pwmPin);
+        if (duty < FAN_START_DUTY) return 0;
+        return static_cast<uint16_t>(fan.maxRpm * duty / 100);
+    }
+    return 0;
+}
+
+void EXTIO2Emulator::registerImage(const uint8_t* image, size_t len, const EXTIO2Profile& profile) {
+    Image entry;
+    entry.data.assign(image, image + len);
+    entry.profile = &profile;
+    _images.push_back(entry);
+}
+
+void EXTIO2Emulator::loadImage(const uint8_t* image, size_t len) {
+    memset(_flash, 0xFF, sizeof(_flash));
+    memcpy(_flash, image, min(len, static_cast<size_t>(FLASH_SIZE)));
+    jumpToApp();
+    _busyUntil = 0;
+}
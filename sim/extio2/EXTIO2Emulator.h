@@ -0,0 +1,191 @@
+// Register-level model of the M5Stack EXTIO2 (STM32F030) as the firmware
+// sees it over I2C, plus the hardware hanging off its pins in Stonecold.
+//
+// Application (0x45), per the M5Unit-EXTIO2 register map and our custom
+// firmware extensions:
+//   0x00+pin  mode            0x10+pin  digital output   0x20+pin  digital input
+//   0x50+pin  servo angle     0x90+pin  PWM duty (%)      0xA0      PWM frequency
+//   0xB0+2*pin  tach RPM (u16 LE, FAN_RPM pins)           0xFD      IAP (0x01 = bootloader)
+//   0xFE      firmware version
+// A write sets the register pointer and stores data with auto-increment; a
+// read continues from the pointer. Registers a profile doesn't implement
+// ignore writes and read 0.
+//
+// Bootloader (0x54), the IAP protocol EXTIO2Flasher speaks:
+//   0x06 addr[4 BE] len[2 BE] 0x00 data[len]   erase + program one 1 KB page
+//   0x08 addr[4 BE] len[2 BE]                  CRC-32 of a range (optional);
+//                                              read back 0x08 crc[4 BE] 0xF7
+//   0x77                                      jump to the application
+// The stock bootloader has no 0x08 and reads back 0xFF. The device is silent
+// (NACKs both addresses) while resetting into the bootloader, programming a
+// page, computing a CRC and booting the application.
+// Jumping boots whichever registered image the flash matches; an
+// unrecognised image leaves it in the bootloader.
+//
+// Custom v5 firmware generates PWM in software; at 25 kHz it NACKs every
+// third address phase, as its I2C interrupt is starved.
+//
+// Attached hardware: a MAX31865 on four pins (software SPI, as
+// TemperatureSensor drives it) and fans whose tach follows a PWM pin's duty.
+
+#ifndef EXTIO2_EMULATOR_H
+#define EXTIO2_EMULATOR_H
+
+#include <Wire.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// Firmware builds the application can run
+struct EXTIO2Profile {
+    const char* name;
+    uint8_t version;
+    bool pwmMode;     // Mode 5, duty/frequency registers (stock v3+)
+    bool fanRpmMode;  // Mode 6, tach registers (custom v5+)
+    bool timerPwm;    // Frequency mode 5 = 25 kHz from a timer (custom v6+)
+};
+
+extern const EXTIO2Profile EXTIO2_STOCK;        // M5Stack firmware (v3)
+extern const EXTIO2Profile EXTIO2_CUSTOM;       // Stonecold firmware (v5, software PWM)
+extern const EXTIO2Profile EXTIO2_CUSTOM_TIMER; // Stonecold firmware (v6, timer PWM)
+
+// MAX31865 RTD-to-digital converter, bit-level SPI (modes 1/3: SDI sampled
+// on the rising edge, SDO shifted on the falling edge)
+class MAX31865Model {
+public:
+    void setTemperature(float celsius) { _temperature = celsius; }
+    void setFault(uint8_t status) { _injectedFault = status; }  // e.g. 0x80 RTD open
+
+    // Pin levels as driven through the EXTIO2
+    void pins(bool cs, bool clk, bool sdi);
+    bool sdo() const;
+
+    uint32_t getConversions() const { return _conversions; }
+
+    static constexpr float RREF = 430.0f;
+    static constexpr float R0 = 100.0f;
+    static constexpr uint32_t CONVERSION_US = 52000;  // 1-shot, 60 Hz filter
+
+private:
+    void byteComplete(uint8_t value);
+    void writeRegister(uint8_t reg, uint8_t value);
+    uint8_t readRegister(uint8_t reg);
+    void finishConversion();
+
+    float _temperature = 25.0f;
+    uint8_t _injectedFault = 0;
+
+    uint8_t _regs[8] = {0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00};
+    bool _converting = false;
+    uint64_t _conversionDone = 0;
+    uint32_t _conversions = 0;
+
+    bool _cs = true;
+    bool _clk = false;
+    uint8_t _shiftIn = 0;
+    uint8_t _bitsIn = 0;
+    uint8_t _byteIndex = 0;
+    uint8_t _address = 0;
+    bool _writing = false;
+    uint8_t _sdoByte = 0;  // Position presented on SDO
+    uint8_t _sdoBit = 0;
+};
+
+class EXTIO2Emulator : public I2CTarget {
+public:
+    explicit EXTIO2Emulator(const EXTIO2Profile& profile = EXTIO2_CUSTOM);
+
+    // I2CTarget
+    bool acknowledges(uint8_t addr) override;
+    bool receive(uint8_t addr, const uint8_t* data, size_t len) override;
+    void transmit(uint8_t addr, uint8_t* out, size_t len) override;
+
+    // Wiring
+    void attachMAX31865(MAX31865Model* sensor, uint8_t clk, uint8_t sdo, uint8_t sdi, uint8_t cs);
+    void attachFan(uint8_t tachPin, uint8_t pwmPin, uint16_t maxRpm);
+    void setFanStalled(uint8_t tachPin, bool stalled);
+    void setInput(uint8_t pin, bool level) { _inputLevel[pin & 7] = level; }
+
+    // Device state
+    void powerCycle();  // Registers back to reset defaults, application running
+    bool inBootloader() const { return _mode == MODE_BOOTLOADER; }
+    const EXTIO2Profile& getProfile() const { return *_profile; }
+    uint8_t getPinMode(uint8_t pin) const { return _regs[REG_MODE + (pin & 7)]; }
+    bool getOutput(uint8_t pin) const { return _regs[REG_OUTPUT + (pin & 7)] != 0; }
+    uint8_t getPWMDuty(uint8_t pin) const { return _regs[REG_PWM_DUTY + (pin & 7)]; }
+    uint8_t getPWMFrequency() const { return _regs[REG_PWM_FREQ]; }
+    uint16_t getFanRPM(uint8_t tachPin) const;
+
+    // Flash (application area 0x08001000..+0x2C00)
+    void registerImage(const uint8_t* image, size_t len, const EXTIO2Profile& profile);
+    void loadImage(const uint8_t* image, size_t len);  // Factory-programmed contents
+    const uint8_t* getFlash() const { return _flash; }
+    void setPageWriteMicros(uint32_t us) { _pageWriteUs = us; }
+    void setBootloaderCrc(bool supported) { _bootloaderCrc = supported; }
+    void corruptPageWrites(int count) { _corruptWrites = count; }  // Flip a bit in the next writes
+    uint32_t getPageWrites() const { return _pageWrites; }
+    uint32_t getCrcRequests() const { return _crcRequests; }  // Supported or not
+
+    static constexpr uint8_t APP_ADDR = 0x45;
+    static constexpr uint8_t BOOTLOADER_ADDR = 0x54;
+    static constexpr uint32_t FLASH_BASE = 0x08001000;
+    static constexpr uint32_t FLASH_SIZE = 0x2C00;
+    static constexpr uint32_t PAGE_SIZE = 1024;
+
+private:
+    enum Mode { MODE_APP, MODE_BOOTLOADER };
+
+    bool busy() const;
+    void appWrite(const uint8_t* data, size_t len);
+    uint8_t appRead(uint8_t reg) const;
+    bool supported(uint8_t reg, uint8_t value) const;
+    void bootloaderWrite(const uint8_t* data, size_t len);
+    void jumpToApp();
+    void outputsChanged();
+
+    const EXTIO2Profile* _profile;
+    Mode _mode = MODE_APP;
+    uint64_t _busyUntil = 0;
+    uint8_t _regs[256] = {};
+    uint8_t _pointer = 0;
+    bool _inputLevel[8] = {};
+    uint32_t _starveCount = 0;
+
+    MAX31865Model* _sensor = nullptr;
+    uint8_t _sensorClk = 0, _sensorSdo = 0, _sensorSdi = 0, _sensorCs = 0;
+
+    struct Fan {
+        uint8_t tachPin;
+        uint8_t pwmPin;
+        uint16_t maxRpm;
+        bool stalled;
+    };
+    std::vector<Fan> _fans;
+
+    struct Image {
+        std::vector<uint8_t> data;
+        const EXTIO2Profile* profile;
+    };
+    std::vector<Image> _images;
+    uint8_t _flash[FLASH_SIZE];
+    uint32_t _pageWriteUs = 25000;  // STM32F0 page erase (~20 ms) + 512 half-word writes
+    uint32_t _pageWrites = 0;
+    uint32_t _crcRequests = 0;
+    bool _bootloaderCrc = false;
+    int _corruptWrites = 0;
+    uint8_t _reply[6];
+    uint8_t _replyLength = 0;
+
+    static constexpr uint8_t REG_MODE = 0x00;
+    static constexpr uint8_t REG_OUTPUT = 0x10;
+    static constexpr uint8_t REG_INPUT = 0x20;
+    static constexpr uint8_t REG_PWM_DUTY = 0x90;
+    static constexpr uint8_t REG_PWM_FREQ = 0xA0;
+    static constexpr uint8_t REG_FAN_RPM = 0xB0;
+    static constexpr uint8_t REG_IAP = 0xFD;
+    static constexpr uint8_t REG_VERSION = 0xFE;
+    static constexpr uint32_t RESET_US = 20000;  // Reset into the bootloader / boot the app
+    static constexpr uint32_t CRC_US = 1000;     // 1 KB through the STM32 CRC unit
+};
+
+#endif
@@ -0,0 +1,295 @@
+// Host implementations behind the stand-in headers in sim/extio2/: virtual
+// clock, Serial, the I2C pins, Wire routed to emulated targets, the
+// M5_EXTIO2 library subset and file-backed partitions.
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <M5_EXTIO2.h>
+#include <EEPROM.h>
+#include <esp_partition.h>
+#include <stdarg.h>
+#include <vector>
+
+// Clock
+
+static uint64_t g_micros = 0;
+
+uint64_t hostMicros() { return g_micros; }
+void hostAdvanceMicros(uint64_t us) { g_micros += us; }
+
+unsigned long millis() { return static_cast<unsigned long>(g_micros / 1000); }
+unsigned long micros() { return static_cast<unsigned long>(g_micros); }
+void delay(unsigned long ms) { g_micros += static_cast<uint64_t>(ms) * 1000; }
+void delayMicroseconds(unsigned int us) { g_micros += us; }
+
+// Serial
+
+HardwareSerial Serial;
+
+void HardwareSerial::print(const char* text) {
+    if (!quiet) fputs(text, stdout);
+}
+
+void HardwareSerial::println(const char* text) {
+    if (!quiet) printf("%s\n", text);
+}
+
+int HardwareSerial::printf(const char* format, ...) {
+    if (quiet) return 0;
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n;
+}
+
+// GPIO: SCL pulses and SDA level reach the emulated bus
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+    if (pin == Wire.sclPin()) Wire.sclWritten(level);
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin == Wire.sdaPin()) return Wire.sdaLevel() ? HIGH : LOW;
+    return HIGH;
+}
+
+EEPROMClass EEPROM;
+
+// Wire
+
+TwoWire Wire;
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+    if (_started) return true;  // Like Arduino-ESP32: a running bus keeps its settings
+    _sda = sda;
+    _scl = scl;
+    _clock = frequency ? frequency : 100000;
+    _started = true;
+    return true;
+}
+
+bool TwoWire::end() {
+    _started = false;
+    return true;
+}
+
+bool TwoWire::setClock(uint32_t frequency) {
+    _clock = frequency;
+    return true;
+}
+
+void TwoWire::beginTransmission(uint8_t addr) {
+    _txAddr = addr;
+    _txLength = 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (_txLength >= I2C_BUFFER_LENGTH) return 0;
+    _txBuffer[_txLength++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t len) {
+    size_t n = 0;
+    while (n < len && write(data[n])) n++;
+    return n;
+}
+
+void TwoWire::setErrorRate(uint32_t minClock, double probability) {
+    _errorMinClock = minClock;
+    _errorProbability = probability;
+}
+
+void TwoWire::holdSdaLow(int releaseAfterPulses) {
+    _sdaStuckPulses = releaseAfterPulses;
+}
+
+void TwoWire::sclWritten(uint8_t level) {
+    if (level && !_sclLevel && _sdaStuckPulses > 0) _sdaStuckPulses--;
+    _sclLevel = level;
+}
+
+I2CTarget* TwoWire::targetFor(uint8_t addr) {
+    if (_detached) return nullptr;
+    for (I2CTarget* target : _targets) {
+        if (target->acknowledges(addr)) return target;
+    }
+    return nullptr;
+}
+
+bool TwoWire::injectError() {
+    if (_errorProbability <= 0.0 || _clock < _errorMinClock) return false;
+    _random = _random * 1103515245u + 12345u;
+    return ((_random >> 8) & 0xFFFF) < _errorProbability * 65536.0;
+}
+
+void TwoWire::charge(size_t bytes) {
+    // Start + address/data bytes at 9 bits each + stop
+    uint64_t bits = 2 + bytes * 9;
+    uint64_t us = _overheadUs + (bits * 1000000 + _clock - 1) / _clock;
+    hostAdvanceMicros(us);
+    _stats.bytes += bytes;
+    _stats.busMicros += us;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+    // Arduino-ESP32 (IDF 4.4) defers a write without STOP and sends it as the
+    // first half of the following requestFrom()
+    if (!sendStop) return 0;
+
+    _stats.transactions++;
+    charge(1 + _txLength);
+    uint8_t result = 0;
+    I2CTarget* target = nullptr;
+    if (!_started || _sdaStuckPulses > 0) {
+        result = 4;
+    } else if ((target = targetFor(_txAddr)) == nullptr) {
+        result = 2;
+    } else if (injectError()) {
+        result = 3;
+    } else if (!target->receive(_txAddr, _txBuffer, _txLength)) {
+        result = 3;
+    }
+    if (result) _stats.errors++;
+    _txLength = 0;
+    return result;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t addr, uint8_t len, bool) {
+    len = static_cast<uint8_t>(min<size_t>(len, I2C_BUFFER_LENGTH));
+    bool combined = _txLength > 0 && _txAddr == addr;
+
+    _stats.transactions++;
+    charge((combined ? 1 + _txLength : 0) + 1 + len);
+    _rxLength = 0;
+    _rxIndex = 0;
+
+    I2CTarget* target = nullptr;
+    bool ok = _started && _sdaStuckPulses == 0 && (target = targetFor(addr)) != nullptr && !injectError();
+    if (ok && combined) ok = target->receive(addr, _txBuffer, _txLength);
+    _txLength = 0;
+    if (!ok) {
+        _stats.errors++;
+        return 0;
+    }
+
+    target->transmit(addr, _rxBuffer, len);
+    _rxLength = len;
+    return len;
+}
+
+int TwoWire::read() {
+    if (_rxIndex >= _rxLength) return -1;
+    return _rxBuffer[_rxIndex++];
+}
+
+// M5_EXTIO2 (register map from the M5Unit-EXTIO2 library)
+
+static constexpr uint8_t EXTIO2_MODE_REG = 0x00;
+static constexpr uint8_t EXTIO2_OUTPUT_REG = 0x10;
+static constexpr uint8_t EXTIO2_INPUT_REG = 0x20;
+static constexpr uint8_t EXTIO2_SERVO_ANGLE_REG = 0x50;
+
+bool M5_EXTIO2::begin(TwoWire* wire, uint8_t sda, uint8_t scl, uint8_t addr, uint32_t speed) {
+    _wire = wire;
+    _addr = addr;
+    _wire->begin(sda, scl, speed);
+    _wire->beginTransmission(_addr);
+    return _wire->endTransmission() == 0;
+}
+
+bool M5_EXTIO2::writeBytes(uint8_t reg, const uint8_t* data, uint8_t len) {
+    _wire->beginTransmission(_addr);
+    _wire->write(reg);
+    _wire->write(data, len);
+    return _wire->endTransmission() == 0;
+}
+
+bool M5_EXTIO2::readBytes(uint8_t reg, uint8_t* data, uint8_t len) {
+    _wire->beginTransmission(_addr);
+    _wire->write(reg);
+    _wire->endTransmission(false);
+    if (_wire->requestFrom(_addr, len) != len) return false;
+    for (uint8_t i = 0; i < len; i++) data[i] = _wire->read();
+    return true;
+}
+
+bool M5_EXTIO2::setPinMode(uint8_t pin, extio_io_mode_t mode) {
+    uint8_t value = mode;
+    return writeBytes(EXTIO2_MODE_REG + pin, &value, 1);
+}
+
+bool M5_EXTIO2::setAllPinMode(extio_io_mode_t mode) {
+    uint8_t values[8];
+    memset(values, mode, sizeof(values));
+    return writeBytes(EXTIO2_MODE_REG, values, sizeof(values));
+}
+
+bool M5_EXTIO2::setDigitalOutput(uint8_t pin, bool state) {
+    uint8_t value = state ? 1 : 0;
+    return writeBytes(EXTIO2_OUTPUT_REG + pin, &value, 1);
+}
+
+bool M5_EXTIO2::getDigitalInput(uint8_t pin) {
+    uint8_t value = 0;
+    readBytes(EXTIO2_INPUT_REG + pin, &value, 1);
+    return value != 0;
+}
+
+bool M5_EXTIO2::setServoAngle(uint8_t pin, uint8_t angle) {
+    return writeBytes(EXTIO2_SERVO_ANGLE_REG + pin, &angle, 1);
+}
+
+// Partitions
+
+struct HostPartition {
+    esp_partition_t info;
+    std::vector<uint8_t> data;
+};
+static std::vector<HostPartition*> g_partitions;
+
+bool hostLoadPartition(uint8_t type, uint8_t subtype, const char* label, uint32_t size, const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+    HostPartition* partition = new HostPartition();
+    partition->info.type = static_cast<esp_partition_type_t>(type);
+    partition->info.subtype = static_cast<esp_partition_subtype_t>(subtype);
+    partition->info.address = 0;
+    partition->info.size = size;
+    snprintf(partition->info.label, sizeof(partition->info.label), "%s", label);
+    partition->info.encrypted = false;
+    partition->data.assign(size, 0xFF);
+    size_t n = fread(partition->data.data(), 1, size, file);
+    fclose(file);
+    if (n == 0) {
+        delete partition;
+        return false;
+    }
+    g_partitions.push_back(partition);
+    return true;
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label) {
+    for (HostPartition* partition : g_partitions) {
+        if (partition->info.type != type) continue;
+        if (subtype != ESP_PARTITION_SUBTYPE_ANY && partition->info.subtype != subtype) continue;
+        if (label && strcmp(partition->info.label, label) != 0) continue;
+        return &partition->info;
+    }
+    return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size) {
+    for (HostPartition* entry : g_partitions) {
+        if (&entry->info != partition) continue;
+        if (src_offset + size > entry->data.size()) return ESP_FAIL;
+        memcpy(dst, entry->data.data() + src_offset, size);
+        hostAdvanceMicros(size / 40 + 1);  // ~40 MB/s SPI flash read
+        return ESP_OK;
+    }
+    return ESP_FAIL;
+}
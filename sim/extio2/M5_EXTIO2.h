@@ -0,0 +1,34 @@
+// Host stand-in for the M5Unit-EXTIO2 library: the subset PCA9554 uses, over
+// the emulated Wire with the library's register map.
+
+#ifndef SIM_M5_EXTIO2_H
+#define SIM_M5_EXTIO2_H
+
+#include <Wire.h>
+
+typedef enum {
+    DIGITAL_INPUT_MODE = 0,
+    DIGITAL_OUTPUT_MODE,
+    ADC_INPUT_MODE,
+    SERVO_CTL_MODE,
+    RGB_LED_MODE
+} extio_io_mode_t;
+
+class M5_EXTIO2 {
+public:
+    bool begin(TwoWire* wire, uint8_t sda, uint8_t scl, uint8_t addr, uint32_t speed = 100000L);
+    bool setPinMode(uint8_t pin, extio_io_mode_t mode);
+    bool setAllPinMode(extio_io_mode_t mode);
+    bool setDigitalOutput(uint8_t pin, bool state);
+    bool getDigitalInput(uint8_t pin);
+    bool setServoAngle(uint8_t pin, uint8_t angle);
+
+private:
+    bool writeBytes(uint8_t reg, const uint8_t* data, uint8_t len);
+    bool readBytes(uint8_t reg, uint8_t* data, uint8_t len);
+
+    TwoWire* _wire = nullptr;
+    uint8_t _addr = 0x45;
+};
+
+#endif
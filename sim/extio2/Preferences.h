@@ -0,0 +1,39 @@
+// Host stand-in for the ESP32 Preferences (NVS) API: in-memory, so
+// SettingsManager runs with its defaults in the EXTIO2 emulator.
+
+#ifndef SIM_PREFERENCES_H
+#define SIM_PREFERENCES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Preferences {
+public:
+    bool begin(const char*, bool = false) { return true; }
+    void end() {}
+
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        _store[key].assign(bytes, bytes + len);
+        return len;
+    }
+    size_t getBytesLength(const char* key) {
+        auto it = _store.find(key);
+        return it == _store.end() ? 0 : it->second.size();
+    }
+    size_t getBytes(const char* key, void* buf, size_t maxLen) {
+        auto it = _store.find(key);
+        if (it == _store.end() || it->second.size() > maxLen) return 0;
+        memcpy(buf, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+
+private:
+    std::map<std::string, std::vector<uint8_t>> _store;
+};
+
+#endif
@@ -0,0 +1,107 @@
+// Host stand-in for the Arduino-ESP32 TwoWire, routing transactions to
+// emulated I2C targets (EXTIO2Emulator) instead of a peripheral.
+//
+// Each transaction advances the virtual clock by its wire time: start, the
+// address byte and every data byte at 9 bits (8 + ACK), stop, all at the
+// current SCL frequency, plus a fixed driver overhead per transaction. That
+// makes the relative cost of clock speeds, burst reads and fixed sleeps
+// visible in benchmarks.
+//
+// Fault injection: a transaction error probability for clocks at or above a
+// threshold (poor cable at Fm+), a detached bus (everything NACKs) and SDA
+// held low by a target until it has seen enough SCL pulses (bus clear).
+
+#ifndef SIM_WIRE_H
+#define SIM_WIRE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#ifndef I2C_BUFFER_LENGTH
+#define I2C_BUFFER_LENGTH 128  // Arduino-ESP32 default; platformio.ini raises it
+#endif
+
+// One emulated device (may answer several addresses)
+class I2CTarget {
+public:
+    virtual ~I2CTarget() {}
+
+    virtual bool acknowledges(uint8_t addr) = 0;
+    // Write phase (register pointer + data). false = data NACK.
+    virtual bool receive(uint8_t addr, const uint8_t* data, size_t len) = 0;
+    // Read phase: fill out[0..len)
+    virtual void transmit(uint8_t addr, uint8_t* out, size_t len) = 0;
+};
+
+class TwoWire {
+public:
+    bool begin(int sda, int scl, uint32_t frequency = 0);
+    bool end();
+    bool setClock(uint32_t frequency);
+    uint32_t getClock() const { return _clock; }
+    void setTimeOut(uint16_t timeOutMillis) { _timeoutMs = timeOutMillis; }
+
+    void beginTransmission(uint8_t addr);
+    size_t write(uint8_t data);
+    size_t write(const uint8_t* data, size_t len);
+    uint8_t endTransmission(bool sendStop = true);  // 0 ok, 2 addr NACK, 3 data NACK, 4 other
+    uint8_t requestFrom(uint8_t addr, uint8_t len, bool sendStop = true);
+    int available() const { return static_cast<int>(_rxLength - _rxIndex); }
+    int read();
+
+    // Emulation
+    void attach(I2CTarget* target) { _targets.push_back(target); }
+    void setDetached(bool detached) { _detached = detached; }
+    void setErrorRate(uint32_t minClock, double probability);  // Per transaction at >= minClock
+    void holdSdaLow(int releaseAfterPulses);                   // Stuck target (bus clear needed)
+    void sclWritten(uint8_t level);                            // From digitalWrite() on SCL
+    bool sdaLevel() const { return _sdaStuckPulses == 0; }
+    int sdaPin() const { return _sda; }
+    int sclPin() const { return _scl; }
+
+    void setDriverOverheadMicros(uint32_t us) { _overheadUs = us; }
+
+    // Totals since resetStats()
+    struct Stats {
+        uint32_t transactions;
+        uint32_t errors;
+        uint64_t bytes;
+        uint64_t busMicros;
+    };
+    const Stats& getStats() const { return _stats; }
+    void resetStats() { _stats = Stats(); }
+
+private:
+    I2CTarget* targetFor(uint8_t addr);
+    bool injectError();
+    void charge(size_t bytes);
+
+    int _sda = -1;
+    int _scl = -1;
+    bool _started = false;
+    uint32_t _clock = 100000;
+    uint16_t _timeoutMs = 50;
+    uint32_t _overheadUs = 30;  // ESP-IDF command link setup + ISR per transaction
+
+    uint8_t _txAddr = 0;
+    uint8_t _txBuffer[I2C_BUFFER_LENGTH];
+    size_t _txLength = 0;
+    uint8_t _rxBuffer[I2C_BUFFER_LENGTH];
+    size_t _rxLength = 0;
+    size_t _rxIndex = 0;
+
+    std::vector<I2CTarget*> _targets;
+    bool _detached = false;
+    uint32_t _errorMinClock = 0;
+    double _errorProbability = 0.0;
+    uint32_t _random = 12345;
+    int _sdaStuckPulses = 0;
+    uint8_t _sclLevel = 1;
+
+    Stats _stats = Stats();
+};
+
+extern TwoWire Wire;
+
+#endif
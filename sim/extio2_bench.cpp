@@ -0,0 +1,354 @@
+// Host exerciser and benchmark for the EXTIO2-facing drivers (I2CBus, PCA9554,
+// TemperatureSensor, FanController, FirmwareStore, EXTIO2Flasher) running
+// unmodified against the register-level EXTIO2 emulator in sim/extio2/. Not
+// part of the firmware build.
+//
+//   python3 pack_extio2_firmware.py
+//   g++ -std=gnu++11 -O2 -DI2C_BUFFER_LENGTH=1040 -Isim/extio2 -Iinclude
+//       sim/extio2_bench.cpp sim/extio2/*.cpp src/I2CBus.cpp src/PCA9554.cpp
+//       src/TemperatureSensor.cpp src/FanController.cpp src/SettingsManager.cpp
+//       src/FirmwareStore.cpp src/EXTIO2Flasher.cpp -o extio2_bench
+//   ./extio2_bench [-v]   # -v: show the drivers' own log output
+//
+// Run from the repository root: it reads extio2/*.bin.
+//
+// Times are virtual (see sim/extio2/Arduino.h): bus time at the configured
+// SCL plus every delay() the drivers make, i.e. what loop() would spend.
+
+#include "EXTIO2Emulator.h"
+#include "I2CBus.h"
+#include "PCA9554.h"
+#include "TemperatureSensor.h"
+#include "FanController.h"
+#include "SettingsManager.h"
+#include "FirmwareStore.h"
+#include "EXTIO2Flasher.h"
+#include <Arduino.h>
+#include <Wire.h>
+#include <esp_partition.h>
+#include <stdarg.h>
+#include <functional>
+#include <vector>
+
+static bool g_verbose = false;
+
+void logPrintf(const char* format, ...) {
+    if (!g_verbose) return;
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+}
+
+static EXTIO2Emulator emu;
+static MAX31865Model rtd;
+static int g_failures = 0;
+
+static void check(bool ok, const char* what) {
+    printf("  [%s] %s\n", ok ? " ok " : "FAIL", what);
+    if (!ok) g_failures++;
+}
+
+// Virtual time and bus totals over a section
+struct Section {
+    uint64_t start;
+    TwoWire::Stats bus;
+
+    Section() : start(hostMicros()) { Wire.resetStats(); }
+    double ms() const { return (hostMicros() - start) / 1000.0; }
+    void report(const char* label) const {
+        const TwoWire::Stats& s = Wire.getStats();
+        printf("  %-28s %9.2f ms  %6u tx  %5u err  %8.2f ms on the bus\n", label, ms(),
+               s.transactions, s.errors, s.busMicros / 1000.0);
+    }
+};
+
+// The EXTIO2 part of loop(), in main.cpp's order
+static float loopOnce() {
+    FanController::getInstance().update();
+    I2CBus::getInstance().update();
+    PCA9554::getInstance().update();
+    auto& sensor = TemperatureSensor::getInstance();
+    if (sensor.hasError()) sensor.tryReconnect();
+    return sensor.readTemperature();
+}
+
+static void boot() {
+    printf("\nBoot (custom firmware v%d)\n", emu.getProfile().version);
+    Section section;
+    I2CBus::getInstance().begin(13, 15);
+    SettingsManager::getInstance().begin();
+    PCA9554::getInstance().begin();
+    delay(100);
+    TemperatureSensor::getInstance().begin();
+    FanController::getInstance().begin();
+    delay(500);
+    section.report("setup()");
+
+    printf("  negotiated %lu kHz\n", (unsigned long)(I2CBus::getInstance().getClock() / 1000));
+    check(PCA9554::getInstance().isOnline(), "EXTIO2 online");
+    check(emu.getPinMode(5) == 6 && emu.getPinMode(6) == 6, "tach pins in FAN_RPM mode");
+    check(emu.getPinMode(7) == 5 && emu.getPWMDuty(7) == 100, "fan PWM at 100%");
+}
+
+static void temperature() {
+    printf("\nTemperature read (MAX31865 over software SPI)\n");
+    static const uint32_t clocks[] = {100000, 400000, 1000000};
+    uint32_t negotiated = I2CBus::getInstance().getClock();
+    for (uint32_t clock : clocks) {
+        Wire.setClock(clock);
+        rtd.setTemperature(3.5f);
+        Section section;
+        float t = TemperatureSensor::getInstance().readTemperature();
+        char label[32];
+        snprintf(label, sizeof(label), "readTemperature @%lukHz", (unsigned long)(clock / 1000));
+        section.report(label);
+        char what[64];
+        snprintf(what, sizeof(what), "reads %.2f C (model 3.50 C)", t);
+        check(fabsf(t - 3.5f) < 0.05f, what);
+    }
+    Wire.setClock(negotiated);
+}
+
+static void fans() {
+    printf("\nFan tach (2 fans, 3000 rpm max, shared PWM)\n");
+    auto& fans = FanController::getInstance();
+    fans.setSpeed(60);
+    Section section;
+    for (int i = 0; i < 60; i++) {
+        fans.update();
+        delay(50);
+    }
+    section.report("3 s of update()");
+    printf("  fan1 %u rpm, fan2 %u rpm (model %u)\n", fans.getFan1RPM(), fans.getFan2RPM(), emu.getFanRPM(5));
+    check(abs(fans.getFan1RPM() - emu.getFanRPM(5)) < 20, "fan 1 filtered RPM tracks the tach");
+
+    emu.setFanStalled(6, true);
+    for (int i = 0; i < 120; i++) {
+        fans.update();
+        delay(50);
+    }
+    check(fans.getFan2Health() == FAN_HEALTH_STALLED, "stalled fan 2 detected");
+    emu.setFanStalled(6, false);
+}
+
+static void noisyCable() {
+    printf("\nNoisy cable: 5%% transaction errors at 1 MHz\n");
+    auto& bus = I2CBus::getInstance();
+    Wire.setErrorRate(1000000, 0.05);
+    Section section;
+    for (int i = 0; i < 100; i++) loopOnce();
+    section.report("100 loop iterations");
+    printf("  clock now %lu kHz\n", (unsigned long)(bus.getClock() / 1000));
+    for (int level = 0; level < I2CBus::CLOCK_COUNT; level++) {
+        I2CBus::ClockStats stats = bus.getStats(level);
+        if (stats.activeMs == 0) continue;
+        printf("  %4lu kHz: %6u tx, %4u err, %7lu ms\n", (unsigned long)(I2CBus::clockHz(level) / 1000),
+               stats.transactions, stats.errors, stats.activeMs);
+    }
+    check(bus.getClock() < 1000000, "stepped down from 1 MHz");
+    check(PCA9554::getInstance().isOnline(), "EXTIO2 stayed online");
+    Wire.setErrorRate(0, 0.0);
+}
+
+static void disconnect() {
+    printf("\nCable pulled for 10 s, unit power-cycled, SDA stuck on reconnect\n");
+    auto& io = PCA9554::getInstance();
+    Wire.setDetached(true);
+    Section section;
+    uint64_t worst = 0;
+    while (section.ms() < 10000.0) {
+        // The iteration that hits the error limit still pays for its failed
+        // read; after that nothing may block
+        bool offline = !io.isOnline();
+        uint64_t start = hostMicros();
+        loopOnce();
+        delay(10);  // Rest of loop()
+        uint64_t took = hostMicros() - start;
+        if (offline && took > worst) worst = took;
+    }
+    section.report("10 s offline");
+    printf("  worst loop iteration while offline %.2f ms\n", worst / 1000.0);
+    check(!io.isOnline(), "offline while detached");
+    check(worst < 20000, "loop never blocked while offline");
+
+    emu.powerCycle();
+    Wire.holdSdaLow(5);
+    Wire.setDetached(false);
+    Section recovery;
+    float t = NAN;
+    while (recovery.ms() < 60000.0 && (!io.isOnline() || isnan(t))) {
+        t = loopOnce();
+        delay(10);
+    }
+    recovery.report("reconnect + restore");
+    check(io.isOnline() && !isnan(t), "back online with a valid temperature");
+    check(emu.getPinMode(0) == 1 && emu.getPinMode(3) == 1 && emu.getOutput(3), "SPI pins restored (CS idle high)");
+    check(emu.getPinMode(5) == 6 && emu.getPinMode(7) == 5 && emu.getPWMDuty(7) == 60, "fan pins and duty restored");
+}
+
+static std::vector<uint8_t> loadFile(const char* path) {
+    std::vector<uint8_t> data;
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        printf("cannot open %s (run from the repository root)\n", path);
+        exit(2);
+    }
+    uint8_t buffer[1024];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) data.insert(data.end(), buffer, buffer + n);
+    fclose(file);
+    return data;
+}
+
+static void flash(const std::vector<uint8_t>& expected, const char* name, const char* label) {
+    auto& flasher = EXTIO2Flasher::getInstance();
+    const FirmwareStore::Image* image = FirmwareStore::getInstance().find(name);
+    check(image != nullptr, "image listed in the manifest");
+    if (!image) return;
+
+    Section section;
+    uint32_t pagesBefore = emu.getPageWrites();
+    bool ok = flasher.flashFirmware(*image, nullptr);
+    char text[48];
+    snprintf(text, sizeof(text), "flash %s", label);
+    section.report(text);
+    printf("  %u pages written\n", emu.getPageWrites() - pagesBefore);
+    check(ok, "flashFirmware() succeeded");
+    check(memcmp(emu.getFlash(), expected.data(), expected.size()) == 0, "flash contents match the image");
+    check(flasher.readVersion() == image->version, "application reports the manifest version");
+}
+
+static void firmwareStore() {
+    printf("\nFirmware partition\n");
+    auto& store = FirmwareStore::getInstance();
+    Section section;
+    bool ok = store.begin();
+    const FirmwareStore::Image* custom = store.find("custom");
+    bool verified = custom && store.verify(*custom);
+    section.report("manifest + verify custom");
+    check(ok, "manifest loaded");
+    check(verified, "custom image decompresses to its CRC");
+}
+
+// What EXTIO2FlashJob does around the flash task, minus the task: park
+// PCA9554, flash (cancelled once mid-way), resume and let the restore run
+static void parkedFlash() {
+    printf("\nParked flash with cancel, then resume\n");
+    auto& io = PCA9554::getInstance();
+    auto& flasher = EXTIO2Flasher::getInstance();
+    const FirmwareStore::Image* image = FirmwareStore::getInstance().find("original");
+    if (!image) return;
+
+    io.suspend();
+    bool ok = flasher.flashFirmware(*image, [&flasher](int current, int) {
+        if (current == 4) flasher.cancel();
+    });
+    check(!ok && strcmp(flasher.getLastError(), "Cancelled") == 0, "cancel stops the flash");
+    check(emu.inBootloader(), "EXTIO2 left in its bootloader");
+
+    Section section;
+    ok = flasher.flashFirmware(*image, nullptr);
+    io.resume();
+    float t = NAN;
+    while (section.ms() < 10000.0 && (!io.isOnline() || isnan(t))) {
+        t = loopOnce();
+        delay(10);
+    }
+    section.report("reflash + resume");
+    check(ok, "reflash from the bootloader succeeded");
+    check(io.isOnline() && io.getFirmwareVersion() == image->version, "PCA9554 back online with the new version");
+    check(emu.getPinMode(3) == 1 && emu.getOutput(3), "SPI pins re-initialised");
+    check(!isnan(t), "temperature valid again");
+}
+
+// Parked reflash between software-PWM, timer-PWM and stock builds: the fan
+// PWM mode follows the firmware on each reconnect, in both directions
+static void reflashPwmMode(const std::vector<uint8_t>& timer) {
+    printf("\nFan PWM mode across reflashes\n");
+    auto& io = PCA9554::getInstance();
+    auto& fans = FanController::getInstance();
+    auto& flasher = EXTIO2Flasher::getInstance();
+
+    // What EXTIO2FlashJob does: park, flash, resume, then loop until both
+    // PCA9554 and FanController are back
+    auto parked = [&](std::function<bool()> flashIt) {
+        io.suspend();
+        bool ok = flashIt();
+        io.resume();
+        for (int i = 0; i < 200 && !(io.isOnline() && fans.isOnline()); i++) {
+            loopOnce();
+            delay(10);
+        }
+        loopOnce();
+        return ok;
+    };
+
+    bool ok = parked([&] { return flasher.flashFirmware(timer.data(), timer.size(), nullptr); });
+    check(ok && io.getFirmwareVersion() == EXTIO2_CUSTOM_TIMER.version, "timer-PWM build flashed");
+    check(fans.isHighFrequencyPWM() && emu.getPWMFrequency() == PCA9554::PWM_FREQ_25KHZ,
+          "25 kHz enabled without a reboot");
+
+    const FirmwareStore::Image* image = FirmwareStore::getInstance().find("original");
+    if (!image) return;
+    ok = parked([&] { return flasher.flashFirmware(*image, nullptr); });
+    check(ok && io.getFirmwareVersion() == EXTIO2_STOCK.version, "stock build restored");
+    check(!fans.isHighFrequencyPWM() && emu.getPWMFrequency() == PCA9554::PWM_FREQ_1KHZ,
+          "back at 1 kHz, 25 kHz never restored to it");
+}
+
+int main(int argc, char** argv) {
+    g_verbose = argc > 1 && strcmp(argv[1], "-v") == 0;
+    Serial.quiet = !g_verbose;
+
+    std::vector<uint8_t> custom = loadFile("extio2/firmware_custom.bin");
+    std::vector<uint8_t> original = loadFile("extio2/firmware_original.bin");
+    if (!hostLoadPartition(0x40, 0x00, "extfw", 0x20000, "extio2/extfw.bin")) {
+        printf("cannot open extio2/extfw.bin (run pack_extio2_firmware.py first)\n");
+        return 2;
+    }
+
+    emu.registerImage(custom.data(), custom.size(), EXTIO2_CUSTOM);
+    emu.registerImage(original.data(), original.size(), EXTIO2_STOCK);
+
+    // Stand-in for a timer-PWM (v6) build: any image the emulator tells apart
+    std::vector<uint8_t> timer = custom;
+    timer[timer.size() - 1] ^= 0xFF;
+    emu.registerImage(timer.data(), timer.size(), EXTIO2_CUSTOM_TIMER);
+    emu.loadImage(custom.data(), custom.size());
+    emu.attachMAX31865(&rtd, 0, 1, 2, 3);
+    emu.attachFan(5, 7, 3000);
+    emu.attachFan(6, 7, 3000);
+    Wire.attach(&emu);
+
+    boot();
+    temperature();
+    fans();
+    noisyCable();
+    disconnect();
+
+    firmwareStore();
+
+    printf("\nFlashing, stock bootloader (no CRC command)\n");
+    flash(original, "original", "stock");
+    flash(custom, "custom", "custom");
+    check(emu.getCrcRequests() == 0, "stock bootloader never sent the CRC command");
+
+    printf("\nFlashing, bootloader with CRC command\n");
+    emu.setBootloaderCrc(true);
+    EXTIO2Flasher::getInstance().setBootloaderCrc(true);
+    uint32_t pages = emu.getPageWrites();
+    flash(custom, "custom", "custom again");
+    check(emu.getPageWrites() == pages, "unchanged image writes no pages");
+    flash(original, "original", "stock");
+    emu.corruptPageWrites(1);
+    pages = emu.getPageWrites();
+    flash(custom, "custom", "custom, 1 bad write");
+    printf("  %u page writes including the retry\n", emu.getPageWrites() - pages);
+
+    parkedFlash();
+    reflashPwmMode(timer);
+
+    printf("\n%s (%d failed)\n", g_failures ? "FAILED" : "all checks passed", g_failures);
+    return g_failures ? 1 : 0;
+}
@@ -0,0 +1,133 @@
+// Host simulation comparing the smart fan policies (include/FanPolicy.h) on a
+// lumped thermal model of the cooler. Not part of the firmware build.
+//
+//   g++ -std=gnu++11 -O2 -Iinclude sim/fan_policy_sim.cpp src/FanPolicy.cpp -o fan_policy_sim
+//   ./fan_policy_sim
+//
+// Model: chamber (cold side) and heatsink (hot side) thermal masses, TEC1-12710
+// from its datasheet maxima, heatsink resistance falling with airflow, fan
+// power ~ speed^3, and a PI loop on TEC duty standing in for PIDController.
+// Scenario: pull-down from ambient to setpoint, hold, a heat-load step, then
+// a setpoint change.
+
+#include "FanPolicy.h"
+#include <stdio.h>
+#include <math.h>
+
+struct Plant {
+    // TEC1-12710 (same derivation as EnergyMeter)
+    double seebeck = 15.4 / 300.15;
+    double resistance = (300.15 - 68.0) * 15.4 / (10.5 * 300.15);
+    double conductance = (300.15 - 68.0) * 15.4 * 10.5 / (2.0 * 300.15 * 68.0);
+    double supplyVolts = 12.0;
+
+    double ambient = 25.0;
+    double chamberHeatCapacity = 2500.0;  // J/K
+    double chamberLeak = 0.6;             // W/K to ambient
+    double sinkHeatCapacity = 400.0;      // J/K
+    double fanRatedWatts = 3.6;
+
+    double chamber = 25.0;
+    double sink = 25.0;
+    double load = 0.0;                    // W into the chamber
+
+    double tecWatts = 0.0;
+    double fanWatts = 0.0;
+
+    // Heatsink-to-air resistance; natural convection floor when stopped
+    double sinkResistance(double fanFraction) const {
+        if (fanFraction < 0.05) return 1.5;
+        return 0.12 + 0.2 / pow(fanFraction, 0.8);
+    }
+
+    void step(double duty, double fanPercent, double dt) {
+        double tc = chamber + 273.15;
+        double th = sink + 273.15;
+        double current = (supplyVolts - seebeck * (th - tc)) / resistance;
+        if (current < 0.0) current = 0.0;
+
+        double qc = duty * (seebeck * current * tc - 0.5 * current * current * resistance)
+                    - conductance * (th - tc);
+        tecWatts = duty * supplyVolts * current;
+        double qh = qc + tecWatts;
+
+        double fan = fanPercent / 100.0;
+        fanWatts = fanRatedWatts * fan * fan * fan;
+
+        chamber += dt * (chamberLeak * (ambient - chamber) + load - qc) / chamberHeatCapacity;
+        sink += dt * (qh - (sink - ambient) / sinkResistance(fan)) / sinkHeatCapacity;
+    }
+};
+
+struct Result {
+    double energyWh;
+    double pullDownS;
+    double holdRmsC;
+    double meanFan;
+};
+
+static Result run(FanPolicyType type) {
+    Plant plant;
+    FanPolicy& policy = FanPolicy::forType(type);
+    policy.reset();
+
+    const double dt = 0.1;
+    const double endS = 4.0 * 3600.0;
+    double setpoint = 5.0;
+    double integral = 0.0;
+    double duty = 0.0;
+    double fanPercent = 100.0;
+
+    Result r = {0.0, -1.0, 0.0, 0.0};
+    double errSq = 0.0;
+    long holdSamples = 0;
+    long samples = 0;
+
+    for (double t = 0.0; t < endS; t += dt) {
+        if (t >= 2.0 * 3600.0) plant.load = 8.0;      // Door opened / warm contents
+        if (t >= 3.0 * 3600.0) setpoint = 2.0;        // User lowers the setpoint
+
+        // PI on TEC duty, anti-windup by clamping
+        double error = plant.chamber - setpoint;
+        integral += 0.0008 * error * dt;
+        if (integral > 1.0) integral = 1.0;
+        if (integral < 0.0) integral = 0.0;
+        duty = 0.15 * error + integral;
+        if (duty > 1.0) duty = 1.0;
+        if (duty < 0.0) duty = 0.0;
+
+        FanPolicyInput in;
+        in.nowMs = static_cast<unsigned long>(t * 1000.0);
+        in.temperature = static_cast<float>(plant.chamber);
+        in.setpoint = static_cast<float>(setpoint);
+        in.tecPower = static_cast<float>(duty);
+        in.smartPercent = 50.0f;
+        in.maxPercent = 100.0f;
+        fanPercent = policy.update(in).percent;
+
+        plant.step(duty, fanPercent, dt);
+
+        r.energyWh += (plant.tecWatts + plant.fanWatts) * dt / 3600.0;
+        r.meanFan += fanPercent;
+        samples++;
+        if (r.pullDownS < 0.0 && plant.chamber <= setpoint) r.pullDownS = t;
+        if (r.pullDownS >= 0.0) {
+            errSq += (plant.chamber - setpoint) * (plant.chamber - setpoint);
+            holdSamples++;
+        }
+    }
+
+    r.meanFan /= samples;
+    r.holdRmsC = holdSamples > 0 ? sqrt(errSq / holdSamples) : NAN;
+    return r;
+}
+
+int main() {
+    printf("%-6s %10s %12s %10s %9s\n", "Policy", "Energy Wh", "Pull-down s", "Hold RMS C", "Mean fan");
+    for (int type = 0; type < FAN_POLICY_COUNT; type++) {
+        Result r = run(static_cast<FanPolicyType>(type));
+        printf("%-6s %10.1f %12.0f %10.3f %8.1f%%\n", FanPolicy::forType(static_cast<FanPolicyType>(type)).name(),
+               r.energyWh, r.pullDownS, r.holdRmsC, r.meanFan);
+    }
+    return 0;
+}
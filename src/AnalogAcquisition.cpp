@@ -0,0 +1,160 @@
+#include "AnalogAcquisition.h"
+#include <Arduino.h>
+#include <driver/adc.h>
+
+AnalogAcquisition& AnalogAcquisition::getInstance() {
+    static AnalogAcquisition instance;
+    return instance;
+}
+
+void AnalogAcquisition::begin() {
+    static_assert(RESULT_BYTES == SOC_ADC_DIGI_RESULT_BYTES, "ADC result size mismatch");
+
+    for (int i = 0; i < ANALOG_CHANNEL_COUNT; i++) {
+        _channels[i].window = {0.0f, 0.0f, 0.0f, 0.0f, 0};
+    }
+    restartWindows();
+
+    adc_digi_init_config_t init = {};
+    init.max_store_buf_size = DMA_BUFFER_BYTES;
+    init.conv_num_each_intr = DMA_FRAME_BYTES;
+    init.adc2_chan_mask = 0;
+
+    adc_digi_pattern_config_t pattern[ANALOG_CHANNEL_COUNT] = {};
+    for (int i = 0; i < ANALOG_CHANNEL_COUNT; i++) {
+        init.adc1_chan_mask |= BIT(ANALOG_INPUTS[i].adcChannel);
+        pattern[i].atten = ADC_ATTEN_DB_11;
+        pattern[i].channel = ANALOG_INPUTS[i].adcChannel;
+        pattern[i].unit = 0;  // ADC1
+        pattern[i].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    }
+
+    if (adc_digi_initialize(&init) != ESP_OK) {
+        Serial.println("Analog: ADC continuous init failed");
+        return;
+    }
+
+    // The pattern round-robins, so each channel gets 1/N of the conversions
+    adc_digi_configuration_t config = {};
+    config.conv_limit_en = false;
+    config.pattern_num = ANALOG_CHANNEL_COUNT;
+    config.adc_pattern = pattern;
+    config.sample_freq_hz = SAMPLE_HZ_PER_CHANNEL * ANALOG_CHANNEL_COUNT;
+    config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+
+    if (adc_digi_controller_configure(&config) != ESP_OK || adc_digi_start() != ESP_OK) {
+        Serial.println("Analog: ADC continuous start failed");
+        adc_digi_deinitialize();
+        return;
+    }
+
+    _running = true;
+    _lastUpdateUs = micros();
+    Serial.printf("Analog: %d channel(s) at %lu Hz each\n", ANALOG_CHANNEL_COUNT,
+                  static_cast<unsigned long>(SAMPLE_HZ_PER_CHANNEL));
+}
+
+void AnalogAcquisition::update() {
+    if (!_running) return;
+
+    // After a loop stall longer than the driver buffer, or when the driver
+    // reports it overflowed, conversions are missing somewhere in what is
+    // buffered. Drain and drop all of it and restart the windows, so no
+    // window spans the gap.
+    unsigned long now = micros();
+    bool overflow = now - _lastUpdateUs > MAX_UPDATE_GAP_US;
+    _lastUpdateUs = now;
+
+    // Drain whatever the DMA collected since the last call
+    uint8_t buf[DMA_FRAME_BYTES];
+    uint32_t length = 0;
+    esp_err_t err;
+    while (((err = adc_digi_read_bytes(buf, sizeof(buf), &length, 0)) == ESP_OK ||
+            err == ESP_ERR_INVALID_STATE) && length > 0) {
+        if (err == ESP_ERR_INVALID_STATE) overflow = true;
+        if (overflow) continue;
+
+        for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+            const adc_digi_output_data_t* sample = reinterpret_cast<const adc_digi_output_data_t*>(&buf[i]);
+            if (sample->type2.unit != 0) continue;
+
+            for (int ch = 0; ch < ANALOG_CHANNEL_COUNT; ch++) {
+                if (ANALOG_INPUTS[ch].adcChannel == sample->type2.channel) {
+                    addSample(ch, sample->type2.data);
+                    break;
+                }
+            }
+        }
+    }
+
+    if (overflow) restartWindows();
+}
+
+void AnalogAcquisition::restartWindows() {
+    // Drop the raw samples and the partial window; published windows stay
+    for (int i = 0; i < ANALOG_CHANNEL_COUNT; i++) {
+        Channel& ch = _channels[i];
+        ch.head = 0;
+        ch.count = 0;
+        ch.sum = 0;
+        ch.sumSquares = 0;
+        ch.min = 0xFFFF;
+        ch.max = 0;
+        ch.samples = 0;
+    }
+}
+
+void AnalogAcquisition::addSample(int channel, uint16_t raw) {
+    Channel& ch = _channels[channel];
+
+    ch.ring[ch.head] = raw;
+    ch.head = (ch.head + 1) % RING_SIZE;
+    if (ch.count < RING_SIZE) ch.count++;
+
+    ch.sum += raw;
+    ch.sumSquares += static_cast<uint32_t>(raw) * raw;
+    if (raw < ch.min) ch.min = raw;
+    if (raw > ch.max) ch.max = raw;
+    if (++ch.samples < ANALOG_INPUTS[channel].windowSamples) return;
+
+    float n = ch.samples;
+    ch.window.mean = toVolts(ch.sum / n);
+    ch.window.rms = toVolts(sqrtf(ch.sumSquares / n));
+    ch.window.min = toVolts(ch.min);
+    ch.window.max = toVolts(ch.max);
+    ch.window.sequence++;
+    ch.history[ch.window.sequence % WINDOW_HISTORY] = ch.window;
+
+    ch.sum = 0;
+    ch.sumSquares = 0;
+    ch.min = 0xFFFF;
+    ch.max = 0;
+    ch.samples = 0;
+}
+
+size_t AnalogAcquisition::readSamples(AnalogChannel channel, float* dest, size_t maxCount) const {
+    const Channel& ch = _channels[channel];
+    size_t count = (ch.count < maxCount) ? ch.count : maxCount;
+
+    size_t start = (ch.head + RING_SIZE - count) % RING_SIZE;
+    for (size_t i = 0; i < count; i++) {
+        dest[i] = toVolts(ch.ring[(start + i) % RING_SIZE]);
+    }
+    return count;
+}
+
+size_t AnalogAcquisition::readWindows(AnalogChannel channel, uint32_t afterSequence,
+                                      AnalogWindow* dest, size_t maxCount) const {
+    const Channel& ch = _channels[channel];
+    uint32_t newest = ch.window.sequence;
+    uint32_t available = newest - afterSequence;
+    if (afterSequence > newest) available = 0;  // Caller is ahead (e.g. after begin())
+    if (available > WINDOW_HISTORY) available = WINDOW_HISTORY;
+    if (available > maxCount) available = maxCount;
+
+    for (uint32_t i = 0; i < available; i++) {
+        dest[i] = ch.history[(newest - available + 1 + i) % WINDOW_HISTORY];
+    }
+    return available;
+}
@@ -1,5 +1,6 @@
 #include "DisplayManager.h"
 #include "FanController.h"
+#include "PIDController.h"
 #include <M5Dial.h>
 #include "settings_img.h"
 
@@ -167,49 +168,60 @@ void DisplayManager::createSettingsScreen() {
     // Title
     _settingsTitle = lv_label_create(_settingsScreen);
     lv_label_set_text(_settingsTitle, "Settings");
-    lv_obj_align(_settingsTitle, LV_ALIGN_TOP_MID, 0, 20);
+    lv_obj_align(_settingsTitle, LV_ALIGN_TOP_MID, 0, 12);
     lv_obj_set_style_text_color(_settingsTitle, lv_color_hex(0xffffff), 0);
     lv_obj_set_style_text_font(_settingsTitle, &lv_font_montserrat_20, 0);
 
+    // Profile item (shows the active profile name, press to cycle)
+    _settingsItems[SETTINGS_PROFILE] = lv_label_create(_settingsScreen);
+    lv_obj_align(_settingsItems[SETTINGS_PROFILE], LV_ALIGN_CENTER, 0, -70);
+    lv_obj_set_style_text_font(_settingsItems[SETTINGS_PROFILE], &lv_font_montserrat_20, 0);
+
     // Temperature unit item
     _settingsItems[SETTINGS_TEMP_UNIT] = lv_label_create(_settingsScreen);
-    lv_obj_align(_settingsItems[SETTINGS_TEMP_UNIT], LV_ALIGN_CENTER, 0, -60);
+    lv_obj_align(_settingsItems[SETTINGS_TEMP_UNIT], LV_ALIGN_CENTER, 0, -50);
     lv_obj_set_style_text_font(_settingsItems[SETTINGS_TEMP_UNIT], &lv_font_montserrat_20, 0);
 
     // PID item
     _settingsItems[SETTINGS_PID] = lv_label_create(_settingsScreen);
     lv_label_set_text(_settingsItems[SETTINGS_PID], "PID");
-    lv_obj_align(_settingsItems[SETTINGS_PID], LV_ALIGN_CENTER, 0, -36);
+    lv_obj_align(_settingsItems[SETTINGS_PID], LV_ALIGN_CENTER, 0, -30);
     lv_obj_set_style_text_font(_settingsItems[SETTINGS_PID], &lv_font_montserrat_20, 0);
 
     // Current item
     _settingsItems[SETTINGS_CURRENT] = lv_label_create(_settingsScreen);
     lv_label_set_text(_settingsItems[SETTINGS_CURRENT], "Current (A)");
-    lv_obj_align(_settingsItems[SETTINGS_CURRENT], LV_ALIGN_CENTER, 0, -12);
+    lv_obj_align(_settingsItems[SETTINGS_CURRENT], LV_ALIGN_CENTER, 0, -10);
     lv_obj_set_style_text_font(_settingsItems[SETTINGS_CURRENT], &lv_font_montserrat_20, 0);
 
     // Power item
     _settingsItems[SETTINGS_POWER] = lv_label_create(_settingsScreen);
     lv_label_set_text(_settingsItems[SETTINGS_POWER], "Power (%)");
-    lv_obj_align(_settingsItems[SETTINGS_POWER], LV_ALIGN_CENTER, 0, 12);
+    lv_obj_align(_settingsItems[SETTINGS_POWER], LV_ALIGN_CENTER, 0, 10);
     lv_obj_set_style_text_font(_settingsItems[SETTINGS_POWER], &lv_font_montserrat_20, 0);
 
+    // Energy item
+    _settingsItems[SETTINGS_ENERGY] = lv_label_create(_settingsScreen);
+    lv_label_set_text(_settingsItems[SETTINGS_ENERGY], "Energy");
+    lv_obj_align(_settingsItems[SETTINGS_ENERGY], LV_ALIGN_CENTER, 0, 30);
+    lv_obj_set_style_text_font(_settingsItems[SETTINGS_ENERGY], &lv_font_montserrat_20, 0);
+
     // Fans item
     _settingsItems[SETTINGS_FANS] = lv_label_create(_settingsScreen);
     lv_label_set_text(_settingsItems[SETTINGS_FANS], "Fans");
-    lv_obj_align(_settingsItems[SETTINGS_FANS], LV_ALIGN_CENTER, 0, 36);
+    lv_obj_align(_settingsItems[SETTINGS_FANS], LV_ALIGN_CENTER, 0, 50);
     lv_obj_set_style_text_font(_settingsItems[SETTINGS_FANS], &lv_font_montserrat_20, 0);
 
     // Firmware item
     _settingsItems[SETTINGS_FIRMWARE] = lv_label_create(_settingsScreen);
     lv_label_set_text(_settingsItems[SETTINGS_FIRMWARE], "Firmware");
-    lv_obj_align(_settingsItems[SETTINGS_FIRMWARE], LV_ALIGN_CENTER, 0, 60);
+    lv_obj_align(_settingsItems[SETTINGS_FIRMWARE], LV_ALIGN_CENTER, 0, 70);
     lv_obj_set_style_text_font(_settingsItems[SETTINGS_FIRMWARE], &lv_font_montserrat_20, 0);
 
     // Back item
     _settingsItems[SETTINGS_BACK] = lv_label_create(_settingsScreen);
     lv_label_set_text(_settingsItems[SETTINGS_BACK], "< Back");
-    lv_obj_align(_settingsItems[SETTINGS_BACK], LV_ALIGN_BOTTOM_MID, 0, -20);
+    lv_obj_align(_settingsItems[SETTINGS_BACK], LV_ALIGN_BOTTOM_MID, 0, -12);
     lv_obj_set_style_text_font(_settingsItems[SETTINGS_BACK], &lv_font_montserrat_20, 0);
 }
 
@@ -219,7 +231,7 @@ void DisplayManager::showSettingsScreen() {
     }
     lv_scr_load(_settingsScreen);
     _settingsVisible = true;
-    updateSettingsScreen(SETTINGS_TEMP_UNIT);
+    updateSettingsScreen(SETTINGS_PROFILE);
 }
 
 void DisplayManager::updateSettingsScreen(SettingsMenuItem selectedItem) {
@@ -228,6 +240,7 @@ void DisplayManager::updateSettingsScreen(SettingsMenuItem selectedItem) {
     auto& settings = SettingsManager::getInstance();
     const char* unitStr = (settings.getTempUnit() == CELSIUS) ? "°C" : "°F";
     lv_label_set_text(_settingsItems[SETTINGS_TEMP_UNIT], unitStr);
+    lv_label_set_text(_settingsItems[SETTINGS_PROFILE], settings.getProfileName(settings.getActiveProfile()));
 
     // Update colors for all items
     for (int i = 0; i < SETTINGS_ITEM_COUNT; i++) {
@@ -307,12 +320,11 @@ void DisplayManager::updatePIDScreen(PIDMenuItem selectedItem, bool editing, boo
 
     auto& settings = SettingsManager::getInstance();
 
-    // Build list of visible items (skip SAVE if no changes, skip AUTOTUNE always)
+    // Build list of visible items (skip SAVE if no changes)
     int visibleItems[PID_MENU_ITEM_COUNT];
     int visibleCount = 0;
     for (int i = 0; i < PID_MENU_ITEM_COUNT; i++) {
         if (i == PID_MENU_SAVE && !hasChanges) continue;
-        if (i == PID_MENU_AUTOTUNE) continue;  // Auto-tune disabled - doesn't work well for TEC
         visibleItems[visibleCount++] = i;
     }
 
@@ -343,7 +355,47 @@ void DisplayManager::updatePIDScreen(PIDMenuItem selectedItem, bool editing, boo
     snprintf(buf, sizeof(buf), "Mode: %s", (settings.getPIDMode() == PID_ON) ? "On" : "Off");
     lv_label_set_text(_pidItems[PID_MENU_MODE], buf);
 
+    if (!settings.getMPCEnabled()) {
+        snprintf(buf, sizeof(buf), "Ctrl: PID");
+    } else if (!PIDController::getInstance().getMPC().isConfigured()) {
+        snprintf(buf, sizeof(buf), "Ctrl: MPC (no model)");
+    } else {
+        snprintf(buf, sizeof(buf), "Ctrl: MPC");
+    }
+    lv_label_set_text(_pidItems[PID_MENU_CONTROL], buf);
+
+    if (!settings.getGainScheduleEnabled()) {
+        snprintf(buf, sizeof(buf), "Sched: Off");
+    } else {
+        snprintf(buf, sizeof(buf), "Sched: %s (%u)",
+                 (settings.getGainScheduleSource() == GS_SOURCE_MEASURED) ? "Temp" : "SP",
+                 settings.getGainSchedulePointCount());
+    }
+    lv_label_set_text(_pidItems[PID_MENU_SCHEDULE], buf);
+
+    uint32_t ffSamples = PIDController::getInstance().getFeedForwardModel().getSampleCount();
+    if (!settings.getFeedForwardEnabled()) {
+        snprintf(buf, sizeof(buf), "FF: Off");
+    } else if (!PIDController::getInstance().getFeedForwardModel().isLearned()) {
+        snprintf(buf, sizeof(buf), "FF: Learning");
+    } else {
+        snprintf(buf, sizeof(buf), "FF: On (%lu)", static_cast<unsigned long>(ffSamples));
+    }
+    lv_label_set_text(_pidItems[PID_MENU_FEEDFORWARD], buf);
+
+    const PlantEstimator& estimator = PIDController::getInstance().getPlantEstimator();
+    const char* adaptMode = settings.getAdaptiveTuningEnabled() ? "Auto" : "Mon";
+    if (PIDController::getInstance().isPlantDrifted()) {
+        snprintf(buf, sizeof(buf), "Adapt: %s (drift)", adaptMode);
+    } else if (estimator.hasEstimate() && estimator.getReference().valid) {
+        snprintf(buf, sizeof(buf), "Adapt: %s (%.0f%%)", adaptMode, estimator.getDrift() * 100.0f);
+    } else {
+        snprintf(buf, sizeof(buf), "Adapt: %s", adaptMode);
+    }
+    lv_label_set_text(_pidItems[PID_MENU_ADAPT], buf);
+
     lv_label_set_text(_pidItems[PID_MENU_AUTOTUNE], "Run Auto-tune");
+    lv_label_set_text(_pidItems[PID_MENU_IDENTIFY], "Step Identify");
 
     snprintf(buf, sizeof(buf), "Kp: %.2f", settings.getPIDKp());
     lv_label_set_text(_pidItems[PID_MENU_KP], buf);
@@ -444,7 +496,7 @@ void DisplayManager::createAutoTuneScreen() {
 
     // Progress text (cycle count)
     _autoTuneProgress = lv_label_create(_autoTuneScreen);
-    lv_label_set_text(_autoTuneProgress, "Cycle 0/5");
+    lv_label_set_text(_autoTuneProgress, "Cycle 0");
     lv_obj_align(_autoTuneProgress, LV_ALIGN_CENTER, 0, 20);
     lv_obj_set_style_text_color(_autoTuneProgress, lv_color_hex(0x888888), 0);
     lv_obj_set_style_text_font(_autoTuneProgress, &lv_font_montserrat_20, 0);
@@ -489,6 +541,15 @@ void DisplayManager::updateAutoTuneScreen(int cycle, int totalCycles, const char
     lv_refr_now(nullptr);
 }
 
+void DisplayManager::updateAutoTuneScreen(const char* progress, const char* status) {
+    if (!_autoTuneScreen) return;
+
+    lv_label_set_text(_autoTuneStatus, status);
+    lv_label_set_text(_autoTuneProgress, progress);
+
+    lv_refr_now(nullptr);
+}
+
 void DisplayManager::showAutoTuneError(const char* error) {
     if (!_autoTuneScreen) return;
 
@@ -779,6 +840,129 @@ bool DisplayManager::isPowerScreenVisible() const {
     return _powerVisible;
 }
 
+void DisplayManager::createEnergyScreen() {
+    _energyScreen = lv_obj_create(nullptr);
+    lv_obj_set_style_bg_color(_energyScreen, lv_color_hex(0x1a1a1a), 0);
+    lv_obj_clear_flag(_energyScreen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_scrollbar_mode(_energyScreen, LV_SCROLLBAR_MODE_OFF);
+
+    // Title
+    _energyTitle = lv_label_create(_energyScreen);
+    lv_label_set_text(_energyTitle, "Energy");
+    lv_obj_align(_energyTitle, LV_ALIGN_TOP_MID, 0, 20);
+    lv_obj_set_style_text_color(_energyTitle, lv_color_hex(0xffffff), 0);
+    lv_obj_set_style_text_font(_energyTitle, &lv_font_montserrat_20, 0);
+
+    // Total power (large)
+    _energyWatts = lv_label_create(_energyScreen);
+    lv_label_set_text(_energyWatts, "0.0W");
+    lv_obj_align(_energyWatts, LV_ALIGN_CENTER, 0, -30);
+    lv_obj_set_style_text_color(_energyWatts, lv_color_hex(0x00aaff), 0);
+    lv_obj_set_style_text_font(_energyWatts, &lv_font_montserrat_48, 0);
+
+    // Session and lifetime energy
+    _energyDetail = lv_label_create(_energyScreen);
+    lv_label_set_text(_energyDetail, "");
+    lv_obj_set_style_text_align(_energyDetail, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_align(_energyDetail, LV_ALIGN_CENTER, 0, 20);
+    lv_obj_set_style_text_color(_energyDetail, lv_color_hex(0x888888), 0);
+    lv_obj_set_style_text_font(_energyDetail, &lv_font_montserrat_20, 0);
+
+    // COP vs. lift
+    _energyCOP = lv_label_create(_energyScreen);
+    lv_label_set_text(_energyCOP, "");
+    lv_obj_align(_energyCOP, LV_ALIGN_CENTER, 0, 60);
+    lv_obj_set_style_text_color(_energyCOP, lv_color_hex(0x00aaff), 0);
+    lv_obj_set_style_text_font(_energyCOP, &lv_font_montserrat_20, 0);
+
+    // Back button
+    _energyBack = lv_label_create(_energyScreen);
+    lv_label_set_text(_energyBack, "< Back");
+    lv_obj_align(_energyBack, LV_ALIGN_BOTTOM_MID, 0, -20);
+    lv_obj_set_style_text_color(_energyBack, lv_color_hex(0xffff00), 0);
+    lv_obj_set_style_text_font(_energyBack, &lv_font_montserrat_20, 0);
+}
+
+void DisplayManager::showEnergyScreen() {
+    // Create and load energy screen first
+    if (!_energyScreen) {
+        createEnergyScreen();
+    }
+    lv_scr_load(_energyScreen);
+    _energyVisible = true;
+    _settingsVisible = false;
+
+    // Now safe to delete settings screen (no longer active)
+    if (_settingsScreen) {
+        lv_obj_del(_settingsScreen);
+        _settingsScreen = nullptr;
+        _settingsTitle = nullptr;
+        for (int i = 0; i < SETTINGS_ITEM_COUNT; i++) {
+            _settingsItems[i] = nullptr;
+        }
+    }
+
+    updateEnergyScreen(0.0f, 0.0f, 0.0f, NAN, 0.0f);
+}
+
+void DisplayManager::updateEnergyScreen(float watts, float sessionWh, float lifetimeWh, float cop, float lift) {
+    if (!_energyScreen || !_energyWatts) return;
+
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.1fW", watts);
+    lv_label_set_text(_energyWatts, buf);
+
+    // Lifetime in kWh once it outgrows the label
+    if (lifetimeWh >= 10000.0f) {
+        snprintf(buf, sizeof(buf), "Session %.1fWh\nTotal %.1fkWh", sessionWh, lifetimeWh / 1000.0f);
+    } else {
+        snprintf(buf, sizeof(buf), "Session %.1fWh\nTotal %.0fWh", sessionWh, lifetimeWh);
+    }
+    lv_label_set_text(_energyDetail, buf);
+
+    // Show lift in the user's unit (difference: no offset)
+    bool fahrenheit = SettingsManager::getInstance().getTempUnit() == FAHRENHEIT;
+    float displayLift = fahrenheit ? lift * 9.0f / 5.0f : lift;
+    if (isnan(cop)) {
+        snprintf(buf, sizeof(buf), "COP --");
+    } else {
+        snprintf(buf, sizeof(buf), "COP %.2f @ %.0f%s", cop, displayLift, fahrenheit ? "F" : "C");
+    }
+    lv_label_set_text(_energyCOP, buf);
+
+    lv_refr_now(nullptr);
+}
+
+void DisplayManager::closeEnergyScreen() {
+    // Clear old settings screen pointer (may have been invalidated by LVGL)
+    _settingsScreen = nullptr;
+    _settingsTitle = nullptr;
+    for (int i = 0; i < SETTINGS_ITEM_COUNT; i++) {
+        _settingsItems[i] = nullptr;
+    }
+
+    // Create and load settings screen FIRST (before deleting energy screen)
+    createSettingsScreen();
+    lv_scr_load(_settingsScreen);
+    _settingsVisible = true;
+    _energyVisible = false;
+
+    // Now safe to delete energy screen (no longer active)
+    if (_energyScreen) {
+        lv_obj_del(_energyScreen);
+        _energyScreen = nullptr;
+        _energyTitle = nullptr;
+        _energyWatts = nullptr;
+        _energyDetail = nullptr;
+        _energyCOP = nullptr;
+        _energyBack = nullptr;
+    }
+}
+
+bool DisplayManager::isEnergyScreenVisible() const {
+    return _energyVisible;
+}
+
 void DisplayManager::createFanScreen() {
     _fanScreen = lv_obj_create(nullptr);
     lv_obj_set_style_bg_color(_fanScreen, lv_color_hex(0x1a1a1a), 0);
@@ -836,8 +1020,14 @@ void DisplayManager::showFanScreen() {
 void DisplayManager::updateFanScreen(int rpm, float speedPercent, FanScreenSelection selection) {
     if (!_fanScreen) return;
 
-    // Update RPM display with "rpm" suffix
-    lv_label_set_text_fmt(_fanRPMLabel, "%drpm", rpm);
+    // Update RPM display with "rpm" suffix; flag a stalled fan in red
+    if (FanController::getInstance().isStalled()) {
+        lv_label_set_text(_fanRPMLabel, "STALL");
+        lv_obj_set_style_text_color(_fanRPMLabel, lv_color_hex(0xff0000), 0);
+    } else {
+        lv_label_set_text_fmt(_fanRPMLabel, "%drpm", rpm);
+        lv_obj_set_style_text_color(_fanRPMLabel, lv_color_hex(0xffffff), 0);
+    }
 
     // Update speed setpoint
     lv_label_set_text_fmt(_fanSpeedLabel, "%.0f%%", speedPercent);
@@ -974,19 +1164,29 @@ void DisplayManager::createSmartControlScreen() {
 
     // Smart Control toggle item
     _smartControlItems[SMART_CONTROL_TOGGLE] = lv_label_create(_smartControlScreen);
-    lv_obj_align(_smartControlItems[SMART_CONTROL_TOGGLE], LV_ALIGN_CENTER, 0, -40);
+    lv_obj_align(_smartControlItems[SMART_CONTROL_TOGGLE], LV_ALIGN_CENTER, 0, -50);
     lv_obj_set_style_text_font(_smartControlItems[SMART_CONTROL_TOGGLE], &lv_font_montserrat_20, 0);
 
+    // Policy item
+    _smartControlItems[SMART_CONTROL_POLICY] = lv_label_create(_smartControlScreen);
+    lv_obj_align(_smartControlItems[SMART_CONTROL_POLICY], LV_ALIGN_CENTER, 0, -25);
+    lv_obj_set_style_text_font(_smartControlItems[SMART_CONTROL_POLICY], &lv_font_montserrat_20, 0);
+
     // Smart Setpoint item
     _smartControlItems[SMART_CONTROL_SETPOINT] = lv_label_create(_smartControlScreen);
-    lv_obj_align(_smartControlItems[SMART_CONTROL_SETPOINT], LV_ALIGN_CENTER, 0, -10);
+    lv_obj_align(_smartControlItems[SMART_CONTROL_SETPOINT], LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_style_text_font(_smartControlItems[SMART_CONTROL_SETPOINT], &lv_font_montserrat_20, 0);
 
     // Max Fan item
     _smartControlItems[SMART_CONTROL_MAX_FAN] = lv_label_create(_smartControlScreen);
-    lv_obj_align(_smartControlItems[SMART_CONTROL_MAX_FAN], LV_ALIGN_CENTER, 0, 20);
+    lv_obj_align(_smartControlItems[SMART_CONTROL_MAX_FAN], LV_ALIGN_CENTER, 0, 25);
     lv_obj_set_style_text_font(_smartControlItems[SMART_CONTROL_MAX_FAN], &lv_font_montserrat_20, 0);
 
+    // Fan loop item (duty percent or closed-loop RPM)
+    _smartControlItems[SMART_CONTROL_LOOP] = lv_label_create(_smartControlScreen);
+    lv_obj_align(_smartControlItems[SMART_CONTROL_LOOP], LV_ALIGN_CENTER, 0, 50);
+    lv_obj_set_style_text_font(_smartControlItems[SMART_CONTROL_LOOP], &lv_font_montserrat_20, 0);
+
     // Back item
     _smartControlItems[SMART_CONTROL_BACK] = lv_label_create(_smartControlScreen);
     lv_label_set_text(_smartControlItems[SMART_CONTROL_BACK], "< Back");
@@ -1022,18 +1222,35 @@ void DisplayManager::updateSmartControlScreen(SmartControlMenuItem selectedItem,
     auto& settings = SettingsManager::getInstance();
 
     // Update toggle text
-    const char* toggleText = smartEnabled ? "Smart: On" : "Smart: Off";
+    const char* toggleText = !smartEnabled ? "Smart: Off"
+                             : settings.getFanOptimizeEnabled() ? "Smart: Opt" : "Smart: On";
     lv_label_set_text(_smartControlItems[SMART_CONTROL_TOGGLE], toggleText);
 
-    // Update setpoint text
+    // Update policy text
     char buf[32];
-    snprintf(buf, sizeof(buf), "Setpoint: %.0f%%", settings.getSmartSetpoint());
+    snprintf(buf, sizeof(buf), "Policy: %s", FanPolicy::forType(settings.getFanPolicy()).name());
+    lv_label_set_text(_smartControlItems[SMART_CONTROL_POLICY], buf);
+
+    // Update setpoint and max fan text (as RPM targets in RPM mode)
+    bool rpmMode = settings.getFanRPMMode();
+    float maxRPM = settings.getFanMaxRPM();
+    if (rpmMode) {
+        snprintf(buf, sizeof(buf), "Setpoint: %.0frpm", settings.getSmartSetpoint() * maxRPM / 100.0f);
+    } else {
+        snprintf(buf, sizeof(buf), "Setpoint: %.0f%%", settings.getSmartSetpoint());
+    }
     lv_label_set_text(_smartControlItems[SMART_CONTROL_SETPOINT], buf);
 
-    // Update max fan text
-    snprintf(buf, sizeof(buf), "Max Fan: %.0f%%", settings.getFanSpeed());
+    if (rpmMode) {
+        snprintf(buf, sizeof(buf), "Max Fan: %.0frpm", settings.getFanSpeed() * maxRPM / 100.0f);
+    } else {
+        snprintf(buf, sizeof(buf), "Max Fan: %.0f%%", settings.getFanSpeed());
+    }
     lv_label_set_text(_smartControlItems[SMART_CONTROL_MAX_FAN], buf);
 
+    // Update loop text
+    lv_label_set_text(_smartControlItems[SMART_CONTROL_LOOP], rpmMode ? "Loop: RPM" : "Loop: Duty");
+
     // Update colors based on selection and enabled state
     for (int i = 0; i < SMART_CONTROL_ITEM_COUNT; i++) {
         lv_color_t color;
@@ -1043,7 +1260,7 @@ void DisplayManager::updateSmartControlScreen(SmartControlMenuItem selectedItem,
             } else {
                 color = lv_color_hex(0xffff00);  // Yellow when selected
             }
-        } else if (i == SMART_CONTROL_SETPOINT && !smartEnabled) {
+        } else if ((i == SMART_CONTROL_SETPOINT || i == SMART_CONTROL_POLICY) && !smartEnabled) {
             color = lv_color_hex(0x444444);  // Dark gray when disabled
         } else {
             color = lv_color_hex(0x888888);  // Gray when not selected
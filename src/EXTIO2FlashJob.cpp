@@ -0,0 +1,73 @@
+#include "EXTIO2FlashJob.h"
+#include "EXTIO2Flasher.h"
+#include "PCA9554.h"
+#include "TECController.h"
+
+extern void logPrintf(const char* format, ...);
+
+EXTIO2FlashJob& EXTIO2FlashJob::getInstance() {
+    static EXTIO2FlashJob instance;
+    return instance;
+}
+
+bool EXTIO2FlashJob::start(const FirmwareStore::Image& image) {
+    if (_running) return false;
+
+    if (!_queue) {
+        _queue = xQueueCreate(QUEUE_LENGTH, sizeof(Progress));
+        if (!_queue) return false;
+    }
+    xQueueReset(_queue);
+
+    // Safe state before the EXTIO2 goes away: REN is written while the
+    // application still answers, then the bus is handed to the task
+    auto& tec = TECController::getInstance();
+    _tecWasEnabled = tec.isEnabled();
+    tec.setEnabled(false);
+    PCA9554::getInstance().suspend();
+
+    _image = &image;
+    _taskDone = false;
+    _running = true;
+    if (xTaskCreatePinnedToCore(taskMain, "extio2_flash", TASK_STACK, this, TASK_PRIORITY, nullptr, TASK_CORE) !=
+        pdPASS) {
+        logPrintf("EXTIO2FlashJob: task create failed\n");
+        _running = false;
+        PCA9554::getInstance().resume();
+        TECController::getInstance().setEnabled(_tecWasEnabled);
+        return false;
+    }
+    return true;
+}
+
+void EXTIO2FlashJob::cancel() {
+    if (_running) EXTIO2Flasher::getInstance().cancel();
+}
+
+bool EXTIO2FlashJob::poll(Progress& progress) {
+    return _queue && xQueueReceive(_queue, &progress, 0) == pdTRUE;
+}
+
+void EXTIO2FlashJob::update() {
+    if (!_running || !_taskDone) return;
+
+    _running = false;
+    PCA9554::getInstance().resume();
+    TECController::getInstance().setEnabled(_tecWasEnabled);  // Soft-starts from zero once the sensor is back
+}
+
+void EXTIO2FlashJob::taskMain(void* arg) {
+    EXTIO2FlashJob* job = static_cast<EXTIO2FlashJob*>(arg);
+    QueueHandle_t queue = job->_queue;
+
+    bool ok = EXTIO2Flasher::getInstance().flashFirmware(*job->_image, [queue](int current, int total) {
+        Progress progress = {current, total, false, false};
+        xQueueSend(queue, &progress, 0);  // A dropped page update is only cosmetic
+    });
+
+    // Off the bus from here on; the result must not be dropped
+    job->_taskDone = true;
+    Progress result = {0, 0, true, ok};
+    xQueueSend(queue, &result, portMAX_DELAY);
+    vTaskDelete(nullptr);
+}
@@ -6,12 +6,25 @@
  */
 
 #include "EXTIO2Flasher.h"
+#include "I2CBus.h"
+#include "Crc32.h"
 
 bool EXTIO2Flasher::i2cDevicePresent(uint8_t addr) {
     Wire.beginTransmission(addr);
     return Wire.endTransmission() == 0;
 }
 
+bool EXTIO2Flasher::waitForAck(uint8_t addr, uint32_t timeoutMs) {
+    uint32_t start = millis();
+    while (!i2cDevicePresent(addr)) {
+        if (millis() - start >= timeoutMs) {
+            return false;
+        }
+        delay(1);
+    }
+    return true;
+}
+
 uint8_t EXTIO2Flasher::readVersion() {
     if (!i2cDevicePresent(APP_ADDR)) {
         return 0;
@@ -53,16 +66,10 @@ bool EXTIO2Flasher::enterBootloader() {
     Wire.write(0x01);
     Wire.endTransmission();
 
-    // Wait for reset
-    delay(100);
-
-    // Check bootloader is responding
-    for (int i = 0; i < 20; i++) {
-        if (i2cDevicePresent(BOOTLOADER_ADDR)) {
-            Serial.println("EXTIO2: Bootloader ready");
-            return true;
-        }
-        delay(20);
+    // Bootloader answers once the reset is done
+    if (waitForAck(BOOTLOADER_ADDR, BOOTLOADER_TIMEOUT_MS)) {
+        Serial.println("EXTIO2: Bootloader ready");
+        return true;
     }
 
     _lastError = "Failed to enter bootloader";
@@ -102,9 +109,47 @@ bool EXTIO2Flasher::flashPage(uint32_t address, const uint8_t* data) {
         return false;
     }
 
-    // Wait for flash erase + programming
-    delay(60);
+    // Bootloader NACKs until erase + programming is done
+    if (!waitForAck(BOOTLOADER_ADDR, PAGE_WRITE_TIMEOUT_MS)) {
+        _lastError = "Page write timeout";
+        return false;
+    }
+
+    return true;
+}
 
+bool EXTIO2Flasher::readPageCrc(uint32_t address, uint32_t& crc) {
+    // Request: [cmd, addr(4), len(2)], reply: [cmd, crc(4, big-endian), ~cmd].
+    // The stock bootloader ignores the command, so the framing bytes won't match
+    Wire.beginTransmission(BOOTLOADER_ADDR);
+    Wire.write(IAP_CMD_CRC);
+    Wire.write((address >> 24) & 0xFF);
+    Wire.write((address >> 16) & 0xFF);
+    Wire.write((address >> 8) & 0xFF);
+    Wire.write(address & 0xFF);
+    Wire.write((FLASH_PAGE_SIZE >> 8) & 0xFF);
+    Wire.write(FLASH_PAGE_SIZE & 0xFF);
+    if (Wire.endTransmission() != 0) {
+        return false;
+    }
+
+    // NACKed while the CRC is computed
+    uint32_t start = millis();
+    while (Wire.requestFrom(BOOTLOADER_ADDR, (uint8_t)6) != 6) {
+        if (millis() - start >= CRC_TIMEOUT_MS) {
+            return false;
+        }
+        delay(1);
+    }
+
+    uint8_t reply[6];
+    for (int i = 0; i < 6; i++) {
+        reply[i] = Wire.read();
+    }
+    if (reply[0] != IAP_CMD_CRC || reply[5] != (uint8_t)~IAP_CMD_CRC) {
+        return false;
+    }
+    crc = ((uint32_t)reply[1] << 24) | ((uint32_t)reply[2] << 16) | ((uint32_t)reply[3] << 8) | reply[4];
     return true;
 }
 
@@ -114,12 +159,58 @@ void EXTIO2Flasher::jumpToApp() {
     Wire.beginTransmission(BOOTLOADER_ADDR);
     Wire.write(IAP_CMD_JUMP);
     Wire.endTransmission();
-
-    delay(100);
 }
 
 bool EXTIO2Flasher::flashFirmware(const uint8_t* firmware, uint32_t len,
                                    std::function<void(int, int)> progressCallback) {
+    uint32_t offset = 0;
+    PageSource source = [firmware, &offset](uint8_t* data, uint32_t n) {
+        memcpy(data, firmware + offset, n);
+        offset += n;
+        return true;
+    };
+
+    // The bootloader was never clock-negotiated: run the whole session at
+    // standard mode, then return to the application's clock
+    auto& bus = I2CBus::getInstance();
+    bus.holdStandardMode(true);
+    bool ok = flashImage(len, source, progressCallback);
+    bus.holdStandardMode(false);
+    _cancelRequested = false;
+    return ok;
+}
+
+bool EXTIO2Flasher::flashFirmware(const FirmwareStore::Image& image,
+                                   std::function<void(int, int)> progressCallback) {
+    Serial.printf("EXTIO2: Image '%s' v%d from the firmware partition\n", image.name, image.version);
+    if (!FirmwareStore::getInstance().verify(image)) {
+        _lastError = "Image corrupt";
+        _cancelRequested = false;
+        return false;
+    }
+
+    FirmwareStore::Reader reader(image);
+    PageSource source = [&reader](uint8_t* data, uint32_t n) {
+        return reader.read(data, n);
+    };
+
+    auto& bus = I2CBus::getInstance();
+    bus.holdStandardMode(true);
+    bool ok = flashImage(image.size, source, progressCallback);
+    bus.holdStandardMode(false);
+    _cancelRequested = false;
+
+    if (ok) {
+        uint8_t version = readVersion();
+        if (version != image.version) {
+            Serial.printf("EXTIO2: Warning - manifest says v%d, device reports v%d\n", image.version, version);
+        }
+    }
+    return ok;
+}
+
+bool EXTIO2Flasher::flashImage(uint32_t len, PageSource source,
+                               std::function<void(int, int)> progressCallback) {
     Serial.printf("EXTIO2: Flashing firmware (%d bytes)...\n", len);
 
     if (len > FIRMWARE_MAX_SIZE) {
@@ -128,6 +219,11 @@ bool EXTIO2Flasher::flashFirmware(const uint8_t* firmware, uint32_t len,
         return false;
     }
 
+    if (_cancelRequested) {
+        _lastError = "Cancelled";
+        return false;
+    }
+
     // Enter bootloader
     if (!enterBootloader()) {
         return false;
@@ -137,39 +233,92 @@ bool EXTIO2Flasher::flashFirmware(const uint8_t* firmware, uint32_t len,
     uint32_t offset = 0;
     uint32_t pageNum = 0;
     uint32_t totalPages = (len + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE;
+    uint32_t written = 0;
+    bool canVerify = _bootloaderCrc;  // Until the bootloader shows it has no CRC command
 
     while (offset < len) {
+        // Stop between pages; the EXTIO2 stays in its bootloader, which
+        // enterBootloader() picks up on the next attempt
+        if (_cancelRequested) {
+            _lastError = "Cancelled";
+            Serial.printf("EXTIO2: Cancelled after %d pages, still in bootloader\n", pageNum);
+            return false;
+        }
+
         uint16_t pageLen = min((uint32_t)FLASH_PAGE_SIZE, len - offset);
 
         // Pad last page with 0xFF if needed
         uint8_t pageBuffer[FLASH_PAGE_SIZE];
         memset(pageBuffer, 0xFF, FLASH_PAGE_SIZE);
-        memcpy(pageBuffer, firmware + offset, pageLen);
-
-        Serial.printf("EXTIO2: Page %d/%d\n", pageNum + 1, totalPages);
+        if (!source(pageBuffer, pageLen)) {
+            _lastError = "Image read error";
+            Serial.printf("EXTIO2: Image read failed at offset %d\n", offset);
+            return false;
+        }
+        uint32_t expected = crc32(pageBuffer, FLASH_PAGE_SIZE);
 
         // Call progress callback if provided
         if (progressCallback) {
             progressCallback(pageNum + 1, totalPages);
         }
 
-        if (!flashPage(address, pageBuffer)) {
-            Serial.printf("EXTIO2: Failed to flash page at 0x%08X\n", address);
-            return false;
+        // Skip pages that already hold the right contents
+        uint32_t current = 0;
+        if (canVerify && !readPageCrc(address, current)) {
+            if (pageNum > 0) {
+                _lastError = "CRC read failed";
+                Serial.printf("EXTIO2: CRC read failed at 0x%08X\n", address);
+                return false;
+            }
+            canVerify = false;
+            Serial.println("EXTIO2: Bootloader has no CRC command, writing all pages unverified");
+        }
+        if (canVerify && current == expected) {
+            Serial.printf("EXTIO2: Page %d/%d unchanged\n", pageNum + 1, totalPages);
+        } else {
+            Serial.printf("EXTIO2: Page %d/%d\n", pageNum + 1, totalPages);
+
+            bool done = false;
+            for (int attempt = 0; attempt < PAGE_RETRIES && !done; attempt++) {
+                unsigned long started = millis();
+                if (!flashPage(address, pageBuffer)) {
+                    continue;
+                }
+                if (!canVerify) {
+                    unsigned long elapsed = millis() - started;
+                    if (elapsed < PAGE_PROGRAM_MIN_MS) delay(PAGE_PROGRAM_MIN_MS - elapsed);
+                    done = true;
+                } else if (readPageCrc(address, current) && current == expected) {
+                    done = true;
+                } else {
+                    _lastError = "Page verify failed";
+                    Serial.printf("EXTIO2: Verify failed at 0x%08X, retrying\n", address);
+                }
+            }
+            if (!done) {
+                Serial.printf("EXTIO2: Failed to flash page at 0x%08X\n", address);
+                return false;
+            }
+            written++;
         }
 
         address += FLASH_PAGE_SIZE;
         offset += FLASH_PAGE_SIZE;
         pageNum++;
     }
+    Serial.printf("EXTIO2: %d of %d pages written%s\n", written, totalPages, canVerify ? ", all verified" : "");
 
     // Jump to application
     jumpToApp();
 
-    // Verify app is responding
-    delay(500);
-    if (i2cDevicePresent(APP_ADDR)) {
-        uint8_t version = readVersion();
+    // Done once the application answers its version: it may ACK its address
+    // before it handles commands
+    unsigned long start = millis();
+    uint8_t version = 0;
+    while ((version = readVersion()) == 0 && millis() - start < APP_BOOT_TIMEOUT_MS) {
+        delay(1);
+    }
+    if (version != 0) {
         Serial.printf("EXTIO2: Flash complete! Version: %d\n", version);
         _lastError = "";
         return true;
@@ -0,0 +1,83 @@
+#include "EnergyMeter.h"
+#include "SettingsManager.h"
+#include "TECController.h"
+#include "FanController.h"
+#include <Arduino.h>
+
+extern void logPrintf(const char* format, ...);
+
+EnergyMeter& EnergyMeter::getInstance() {
+    static EnergyMeter instance;
+    return instance;
+}
+
+void EnergyMeter::begin() {
+    float lifetime, session, previous;
+    SettingsManager::getInstance().getEnergyCounters(lifetime, session, previous);
+
+    // The session stored at the last persist belongs to the previous boot
+    if (session > 0.0f) {
+        previous = session;
+    }
+    _lifetimeBaseWh = lifetime;
+    _previousSessionWh = previous;
+    _sessionWh = 0.0;
+    SettingsManager::getInstance().setEnergyCounters(lifetime, 0.0f, previous);
+
+    _lastUpdate = millis();
+    _lastPersist = _lastUpdate;
+    _cop = NAN;
+
+    logPrintf("Energy: lifetime %.1fWh, previous session %.2fWh\n", lifetime, previous);
+}
+
+void EnergyMeter::update(float coldSideC) {
+    auto& settings = SettingsManager::getInstance();
+    auto& tec = TECController::getInstance();
+    unsigned long now = millis();
+
+    // TEC: average supply current already includes the PWM duty
+    _tecWatts = tec.isEnabled() ? settings.getSupplyVoltage() * tec.readCurrent() : 0.0f;
+
+    // Fans: affinity law from the rated power at 100%, on measured speed
+    // when the tach reports it (duty otherwise)
+    auto& fans = FanController::getInstance();
+    uint16_t rpm = fans.getAverageRPM();
+    float fanFraction = (rpm > 0) ? rpm / settings.getFanMaxRPM() : fans.getSpeed() / 100.0f;
+    _fanWatts = settings.getFanRatedPower() * fanFraction * fanFraction * fanFraction;
+
+    unsigned long elapsed = now - _lastUpdate;
+    _lastUpdate = now;
+    _sessionWh += (_tecWatts + _fanWatts) * elapsed / 3600000.0;
+
+    updateCOP(coldSideC, tec.getPower(), tec.getOnPhaseCurrent());
+
+    if (now - _lastPersist >= PERSIST_INTERVAL_MS) {
+        save();
+    }
+}
+
+void EnergyMeter::updateCOP(float coldSideC, float duty, float onCurrent) {
+    if (isnan(coldSideC) || _tecWatts < MIN_COP_INPUT_W) {
+        _cop = NAN;
+        return;
+    }
+
+    // Module parameters from the datasheet maxima
+    float seebeck = TEC_VMAX / TEC_TH_REF;
+    float resistance = (TEC_TH_REF - TEC_DTMAX) * TEC_VMAX / (TEC_IMAX * TEC_TH_REF);
+    float conductance = (TEC_TH_REF - TEC_DTMAX) * TEC_VMAX * TEC_IMAX / (2.0f * TEC_TH_REF * TEC_DTMAX);
+
+    float tc = coldSideC + 273.15f;
+    float th = SettingsManager::getInstance().getAmbientTemperature() + 273.15f;
+    _lift = th - tc;
+
+    // Joule heating follows the on-phase current, conduction is continuous
+    float qc = duty * (seebeck * onCurrent * tc - 0.5f * onCurrent * onCurrent * resistance) - conductance * _lift;
+    _cop = qc / _tecWatts;
+}
+
+void EnergyMeter::save() {
+    SettingsManager::getInstance().setEnergyCounters(getLifetimeWh(), getSessionWh(), _previousSessionWh);
+    _lastPersist = millis();
+}
@@ -1,7 +1,10 @@
 #include "FanController.h"
 #include "PCA9554.h"
+#include "SettingsManager.h"
 #include <Arduino.h>
 
+extern void logPrintf(const char* format, ...);
+
 FanController& FanController::getInstance() {
     static FanController instance;
     return instance;
@@ -13,8 +16,16 @@ void FanController::begin() {
     Serial.println("FanController::begin()");
 
     if (!io.isOnline()) {
+        // Record the pin setup; PCA9554 applies it when the EXTIO2 connects
+        // and update() resumes from there (at 1kHz: the firmware is unknown)
         Serial.println("  EXTIO2 offline!");
+        io.setFanRPMPinMode(PIN_FAN1_TACH);
+        io.setFanRPMPinMode(PIN_FAN2_TACH);
+        io.setPWMPinMode(PIN_FAN_PWM);
+        io.setPWMFrequency(PCA9554::PWM_FREQ_1KHZ);
+        _pwm25kHz = false;
         _online = false;
+        applyDuty(100);
         return;
     }
 
@@ -26,15 +37,25 @@ void FanController::begin() {
     io.setFanRPMPinMode(PIN_FAN2_TACH);
     delay(10);
 
-    Serial.println("  Setting PWM mode on pin 7, freq=1 (1kHz)");
-    // Configure PWM pin for fan speed control
-    // Using 1kHz - software PWM can't reliably do 25kHz without starving I2C
+    // Configure PWM pin for fan speed control. Firmware with timer PWM does
+    // the 4-pin fan spec's 25kHz; older software PWM can't without starving
+    // I2C, so those stay at 1kHz. Read the mode back in case it was refused.
     io.setPWMPinMode(PIN_FAN_PWM);
     delay(10);
-    io.setPWMFrequency(1);  // 1=1kHz
-    delay(10);
+    _pwm25kHz = false;
+    if (io.getFirmwareVersion() >= PCA9554::HW_PWM_FIRMWARE_VERSION) {
+        io.setPWMFrequency(PCA9554::PWM_FREQ_25KHZ);
+        delay(10);
+        _pwm25kHz = io.readPWMFrequency() == PCA9554::PWM_FREQ_25KHZ;
+    }
+    if (!_pwm25kHz) {
+        io.setPWMFrequency(PCA9554::PWM_FREQ_1KHZ);
+        delay(10);
+    }
+    Serial.printf("  PWM mode on pin 7 at %s\n", _pwm25kHz ? "25kHz (timer)" : "1kHz");
 
     _lastReadTime = millis();
+    _spinUpStart = _lastReadTime;
     _online = true;
 
     // Set fans to 100% speed initially
@@ -44,30 +65,155 @@ void FanController::begin() {
 }
 
 void FanController::update() {
-    if (!_online) return;
-
     auto& io = PCA9554::getInstance();
     if (!io.isOnline()) {
-        _online = false;
+        if (_online) {
+            _online = false;
+            for (int i = 0; i < FAN_COUNT; i++) {
+                _fans[i].health = FAN_HEALTH_UNKNOWN;
+            }
+        }
         return;
     }
+    if (!_online) {
+        // EXTIO2 back (pin modes and duty restored by PCA9554): start the
+        // tach history over and give the fans a fresh spin-up grace
+        _online = true;
+        for (int i = 0; i < FAN_COUNT; i++) {
+            _fans[i] = Fan();
+        }
+        _lastReadTime = millis();
+        _spinUpStart = _lastReadTime;
 
-    // Read RPM periodically
+        // The EXTIO2 may have been reflashed: PCA9554 already restored 1 kHz
+        // to firmware without timer PWM, and firmware with it gets 25 kHz
+        // (read back, as in begin())
+        bool hwPwm = io.getFirmwareVersion() >= PCA9554::HW_PWM_FIRMWARE_VERSION;
+        if (hwPwm != _pwm25kHz) {
+            _pwm25kHz = false;
+            if (hwPwm) {
+                io.setPWMFrequency(PCA9554::PWM_FREQ_25KHZ);
+                _pwm25kHz = io.readPWMFrequency() == PCA9554::PWM_FREQ_25KHZ;
+            }
+            if (!_pwm25kHz) io.setPWMFrequency(PCA9554::PWM_FREQ_1KHZ);
+            logPrintf("Fans: PWM at %s after reconnect (firmware %d)\n",
+                      _pwm25kHz ? "25kHz" : "1kHz", io.getFirmwareVersion());
+        }
+    }
+
+    // Read both tach registers in one I2C transaction
     unsigned long now = millis();
     if (now - _lastReadTime >= READ_INTERVAL_MS) {
-        _fan1RPM = io.readFanRPM(PIN_FAN1_TACH);
-        _fan2RPM = io.readFanRPM(PIN_FAN2_TACH);
+        uint16_t raw[FAN_COUNT];
+        if (io.readFanRPMs(PIN_FAN1_TACH, FAN_COUNT, raw)) {
+            for (int i = 0; i < FAN_COUNT; i++) {
+                addSample(i, raw[i], now);
+            }
+            if (_rpmControl) {
+                updateRPMLoop((now - _lastReadTime) / 1000.0f);
+            }
+        }
+        // On a failed read keep the last values rather than feeding zeros
         _lastReadTime = now;
     }
 }
 
-uint16_t FanController::getAverageRPM() const {
-    if (_fan1RPM > 0 && _fan2RPM > 0) {
-        return (_fan1RPM + _fan2RPM) / 2;
-    } else if (_fan1RPM > 0) {
-        return _fan1RPM;
+void FanController::addSample(int index, uint16_t raw, unsigned long now) {
+    Fan& fan = _fans[index];
+
+    fan.samples[fan.sampleIndex] = raw;
+    fan.sampleIndex = (fan.sampleIndex + 1) % MEDIAN_SIZE;
+    if (fan.sampleCount < MEDIAN_SIZE) fan.sampleCount++;
+
+    // Median rejects single outliers; EMA smooths the tach jitter. A stopped
+    // fan reads 0 straight away instead of decaying.
+    uint16_t med = median(fan);
+    if (med == 0) {
+        fan.filtered = 0.0f;
+    } else if (fan.filtered == 0.0f) {
+        fan.filtered = med;
+    } else {
+        fan.filtered += RPM_EMA_ALPHA * (med - fan.filtered);
+    }
+    fan.rpm = static_cast<uint16_t>(fan.filtered + 0.5f);
+
+    updateHealth(index, med, now);
+}
+
+uint16_t FanController::median(const Fan& fan) {
+    uint16_t sorted[MEDIAN_SIZE];
+    for (int i = 0; i < fan.sampleCount; i++) {
+        sorted[i] = fan.samples[i];
+    }
+    for (int i = 1; i < fan.sampleCount; i++) {
+        uint16_t v = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > v) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = v;
+    }
+    return sorted[fan.sampleCount / 2];
+}
+
+void FanController::updateHealth(int index, uint16_t med, unsigned long now) {
+    Fan& fan = _fans[index];
+    FanHealth previous = fan.health;
+
+    if (med > 0) {
+        fan.health = FAN_HEALTH_OK;
+        fan.zeroRun = false;
+    } else if (_speedPercent == 0) {
+        fan.health = FAN_HEALTH_STOPPED;
+        fan.zeroRun = false;
     } else {
-        return _fan2RPM;
+        // Driven but no tach: grace after spin-up, then confirm before flagging
+        if (!fan.zeroRun) {
+            fan.zeroRun = true;
+            fan.zeroSince = now;
+        }
+        if (now - _spinUpStart < SPIN_UP_GRACE_MS) {
+            fan.health = FAN_HEALTH_SPIN_UP;
+        } else if (now - fan.zeroSince >= STALL_CONFIRM_MS) {
+            fan.health = FAN_HEALTH_STALLED;
+        } else if (fan.health == FAN_HEALTH_UNKNOWN) {
+            fan.health = FAN_HEALTH_SPIN_UP;
+        }
+    }
+
+    if (fan.health != previous && (fan.health == FAN_HEALTH_STALLED || previous == FAN_HEALTH_STALLED)) {
+        logPrintf("Fan %d: %s -> %s (duty %d%%)\n", index + 1, healthName(previous), healthName(fan.health),
+                  _speedPercent);
+    }
+}
+
+uint16_t FanController::getAverageRPM() const {
+    uint32_t sum = 0;
+    int spinning = 0;
+    for (int i = 0; i < FAN_COUNT; i++) {
+        if (_fans[i].rpm > 0) {
+            sum += _fans[i].rpm;
+            spinning++;
+        }
+    }
+    return spinning > 0 ? sum / spinning : 0;
+}
+
+bool FanController::isStalled() const {
+    for (int i = 0; i < FAN_COUNT; i++) {
+        if (_fans[i].health == FAN_HEALTH_STALLED) return true;
+    }
+    return false;
+}
+
+const char* FanController::healthName(FanHealth health) {
+    switch (health) {
+        case FAN_HEALTH_OK:       return "ok";
+        case FAN_HEALTH_STOPPED:  return "stopped";
+        case FAN_HEALTH_SPIN_UP:  return "spin-up";
+        case FAN_HEALTH_STALLED:  return "STALLED";
+        default:                  return "unknown";
     }
 }
 
@@ -75,6 +221,72 @@ void FanController::setSpeed(uint8_t percent) {
     if (!_online) return;
     if (percent > 100) percent = 100;
 
+    _rpmControl = false;
+    applyDuty(percent);
+}
+
+void FanController::setTargetRPM(uint16_t rpm) {
+    if (!_online) return;
+    if (_rpmControl && rpm == _targetRPM) return;
+
+    // Entering the loop starts from pure feedforward; target changes keep the
+    // learned trim and step the duty straight away rather than at the next read
+    if (!_rpmControl) {
+        _rpmTrim = 0.0f;
+        _rpmControl = true;
+    }
+    _targetRPM = rpm;
+
+    float duty = (rpm == 0) ? 0.0f : feedForward(rpm) + _rpmTrim;
+    if (duty < 0.0f) duty = 0.0f;
+    if (duty > 100.0f) duty = 100.0f;
+    applyDuty(static_cast<uint8_t>(duty + 0.5f));
+}
+
+float FanController::feedForward(uint16_t rpm) const {
+    // Fan RPM is roughly linear in PWM duty above the start-up threshold
+    return rpm * 100.0f / SettingsManager::getInstance().getFanMaxRPM();
+}
+
+void FanController::updateRPMLoop(float dt) {
+    if (_targetRPM == 0) {
+        if (_speedPercent != 0) applyDuty(0);
+        return;
+    }
+
+    // Both fans share one PWM line, so regulate their mean. Hold the duty
+    // while no fan reports a tach (spin-up, stall) instead of winding up.
+    uint16_t feedback = getAverageRPM();
+    if (feedback == 0) return;
+
+    float ff = feedForward(_targetRPM);
+    float error = static_cast<float>(_targetRPM) - feedback;
+    float trim = _rpmTrim + RPM_KI * error * dt;
+    if (trim > RPM_TRIM_LIMIT) trim = RPM_TRIM_LIMIT;
+    if (trim < -RPM_TRIM_LIMIT) trim = -RPM_TRIM_LIMIT;
+
+    float duty = ff + RPM_KP * error + trim;
+    if (duty > 100.0f) {
+        duty = 100.0f;
+        if (error < 0.0f) _rpmTrim = trim;  // Only integrate back out of saturation
+    } else if (duty < 0.0f) {
+        duty = 0.0f;
+        if (error > 0.0f) _rpmTrim = trim;
+    } else {
+        _rpmTrim = trim;
+    }
+
+    uint8_t percent = static_cast<uint8_t>(duty + 0.5f);
+    if (percent != _speedPercent) {
+        applyDuty(percent);
+    }
+}
+
+void FanController::applyDuty(uint8_t percent) {
+    // Restart the stall grace period when the fans are started from rest
+    if (_speedPercent == 0 && percent > 0) {
+        _spinUpStart = millis();
+    }
     _speedPercent = percent;
 
     auto& io = PCA9554::getInstance();
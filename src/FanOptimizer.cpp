@@ -0,0 +1,206 @@
+#include "FanOptimizer.h"
+#include "EnergyMeter.h"
+#include "FanController.h"
+#include "TECController.h"
+#include <Arduino.h>
+
+extern void logPrintf(const char* format, ...);
+
+FanOptimizer& FanOptimizer::getInstance() {
+    static FanOptimizer instance;
+    return instance;
+}
+
+float FanOptimizer::update(float temperature, float setpoint, float startPercent, float maxPercent) {
+    unsigned long now = millis();
+
+    // Heat load proxy: TEC duty, smoothed so PID activity and our own fan
+    // probes (which shift the duty a little) don't look like a load change
+    float duty = TECController::getInstance().getPower();
+    if (!_active) {
+        _load = duty;
+    } else {
+        float alpha = (now - _lastUpdate) / (LOAD_TAU_S * 1000.0f);
+        if (alpha > 1.0f) alpha = 1.0f;
+        _load += alpha * (duty - _load);
+    }
+
+    // A maximum below the search floor leaves nothing to search: run the
+    // fixed speed (within the maximum) without a baseline
+    if (maxPercent < MIN_FAN_PERCENT) {
+        _active = false;
+        _current = startPercent > maxPercent ? maxPercent : startPercent;
+        return _current;
+    }
+
+    // Floor first, so the user's maximum always wins
+    _maxPercent = maxPercent;
+    if (startPercent < MIN_FAN_PERCENT) startPercent = MIN_FAN_PERCENT;
+    if (startPercent > maxPercent) startPercent = maxPercent;
+
+    if (!_active) {
+        // New hold period: measure the fixed smart speed as the baseline
+        _active = true;
+        _state = STATE_BASELINE;
+        _haveBaseline = false;
+        _baselineWatts = NAN;
+        _best = startPercent;
+        _step = INITIAL_STEP;
+        _direction = -1;
+        _failedDirections = 0;
+        _lastUpdate = now;
+        moveTo(startPercent, now);
+        return _current;
+    }
+
+    // Savings: measured power against the baseline speed's, integrated
+    float watts = EnergyMeter::getInstance().getTotalPower();
+    if (_haveBaseline) {
+        _savedWh += (_baselineWatts - watts) * (now - _lastUpdate) / 3600000.0;
+    }
+    _lastUpdate = now;
+
+    // A different heat load moves the optimum and invalidates the baseline:
+    // start over (from the remembered optimum for the new band, if any)
+    if (_haveBaseline && fabsf(_load - _searchLoad) > LOAD_CHANGE) {
+        _active = false;
+        return update(temperature, setpoint, startPercent, maxPercent);
+    }
+
+    // A probe that lets the temperature escape (TEC saturated, airflow too
+    // low) or stalls a fan counts as worse without waiting for the window
+    if (_state == STATE_PROBE &&
+        (temperature > setpoint + ABORT_BAND_C || FanController::getInstance().isStalled())) {
+        finishMeasurement(INFINITY, now);
+        return _current;
+    }
+
+    if (_state == STATE_CONVERGED) {
+        // Slow drift (dust, ambient): re-measure the optimum and search again
+        if (now - _convergedTime >= REPROBE_MS) {
+            _state = STATE_REMEASURE;
+            _step = INITIAL_STEP;
+            _failedDirections = 0;
+            moveTo(_best, now);
+        }
+        return _current;
+    }
+
+    // Dwell: wait for the loop to settle, then average while holding setpoint
+    if (now - _moveTime < SETTLE_MS) return _current;
+    if (fabsf(temperature - setpoint) > HOLD_BAND_C) {
+        // A probe that settles between the hold and abort bands would restart
+        // the window forever: one that never held a full window counts as worse
+        if (_state == STATE_PROBE && now - _dwellStart >= PROBE_TIMEOUT_MS) {
+            finishMeasurement(INFINITY, now);
+            return _current;
+        }
+
+        // Not holding (disturbance, door opened): restart the window
+        _wattSum = 0.0;
+        _wattSamples = 0;
+        _moveTime = now - SETTLE_MS;
+        return _current;
+    }
+
+    _wattSum += watts;
+    _wattSamples++;
+
+    if (now - _moveTime >= SETTLE_MS + MEASURE_MS) {
+        finishMeasurement(static_cast<float>(_wattSum / _wattSamples), now);
+    }
+    return _current;
+}
+
+void FanOptimizer::finishMeasurement(float watts, unsigned long now) {
+    if (_state == STATE_BASELINE) {
+        _baselineWatts = watts;
+        _haveBaseline = true;
+        _bestWatts = watts;
+        _searchLoad = _load;
+        float learned = _learned[loadBin()];
+        if (learned > 0.0f && fabsf(learned - _best) >= MIN_STEP) {
+            // Try the optimum remembered for this load first
+            _direction = (learned > _best) ? 1 : -1;
+            _step = fabsf(learned - _best);
+        }
+        startProbe(now);
+        return;
+    }
+
+    if (_state == STATE_REMEASURE) {
+        _bestWatts = watts;
+        startProbe(now);
+        return;
+    }
+
+    if (watts < _bestWatts - MIN_IMPROVEMENT_W) {
+        // Better: keep going the same way
+        _best = _current;
+        _bestWatts = watts;
+        _failedDirections = 0;
+        if (_step > INITIAL_STEP) _step = INITIAL_STEP;
+        logPrintf("FanOpt: %.0f%% -> %.1fW (baseline %.1fW)\n", _best, watts, _baselineWatts);
+        startProbe(now);
+        return;
+    }
+
+    // Not better: try the other side, then refine the step
+    _failedDirections++;
+    _direction = -_direction;
+    if (_failedDirections >= 2) {
+        _failedDirections = 0;
+        _step *= 0.5f;
+    }
+
+    if (_step < MIN_STEP) {
+        _state = STATE_CONVERGED;
+        _convergedTime = now;
+        _learned[loadBin()] = _best;
+        moveTo(_best, now);
+        logPrintf("FanOpt: converged at %.0f%%, %.1fW (saving %.1fW)\n", _best, _bestWatts, getSavingsWatts());
+        return;
+    }
+    startProbe(now);
+}
+
+void FanOptimizer::startProbe(unsigned long now) {
+    _state = STATE_PROBE;
+    float target = _best + _direction * _step;
+    float upper = _maxPercent;
+    if (target > upper) target = upper;
+    if (target < MIN_FAN_PERCENT) target = MIN_FAN_PERCENT;
+
+    if (fabsf(target - _best) < 0.5f) {
+        // Against a limit: that direction is exhausted
+        _current = _best;
+        finishMeasurement(INFINITY, now);
+        return;
+    }
+
+    moveTo(target, now);
+}
+
+void FanOptimizer::moveTo(float percent, unsigned long now) {
+    _current = percent;
+    _moveTime = now;
+    _dwellStart = now;
+    _wattSum = 0.0;
+    _wattSamples = 0;
+}
+
+void FanOptimizer::reset() {
+    _active = false;
+}
+
+float FanOptimizer::getSavingsWatts() const {
+    if (!_active || !_haveBaseline) return 0.0f;
+    return _baselineWatts - _bestWatts;
+}
+
+int FanOptimizer::loadBin() const {
+    int bin = static_cast<int>(_load * LOAD_BINS);
+    if (bin >= LOAD_BINS) bin = LOAD_BINS - 1;
+    if (bin < 0) bin = 0;
+    return bin;
+}
@@ -0,0 +1,88 @@
+#include "FanPolicy.h"
+
+FanPolicy& FanPolicy::forType(FanPolicyType type) {
+    static HysteresisFanPolicy hysteresis;
+    static TECPowerFanPolicy tecPower;
+    static TemperatureCurveFanPolicy curve;
+
+    switch (type) {
+        case FAN_POLICY_TEC_POWER:  return tecPower;
+        case FAN_POLICY_TEMP_CURVE: return curve;
+        default:                    return hysteresis;
+    }
+}
+
+void HysteresisFanPolicy::reset() {
+    _lastSetpoint = NAN;
+    _waitingForSetpoint = false;
+    _holding = false;
+    _percent = -1.0f;
+}
+
+FanPolicyOutput HysteresisFanPolicy::update(const FanPolicyInput& in) {
+    if (_percent < 0.0f) _percent = in.maxPercent;
+
+    // Setpoint change - ramp fans to max until the new setpoint is reached
+    if (!isnan(_lastSetpoint) && in.setpoint != _lastSetpoint) {
+        _waitingForSetpoint = true;
+        _holding = false;
+        _percent = in.maxPercent;
+    }
+    _lastSetpoint = in.setpoint;
+
+    if (_waitingForSetpoint) {
+        if (in.temperature <= in.setpoint) {
+            _waitingForSetpoint = false;
+            _holding = true;
+        }
+    } else if (in.temperature > in.setpoint + HYSTERESIS_C) {
+        // Too warm - run at max fan speed
+        _holding = false;
+        _percent = in.maxPercent;
+    } else if (in.temperature <= in.setpoint) {
+        // At or below setpoint - use the smart (lower) speed
+        _holding = true;
+    }
+    // Between setpoint and setpoint + hysteresis: keep the current speed
+
+    if (_holding) _percent = in.smartPercent;
+    return {_percent, _holding};
+}
+
+FanPolicyOutput TECPowerFanPolicy::update(const FanPolicyInput& in) {
+    if (!_primed) {
+        _duty = in.tecPower;
+        _primed = true;
+    } else {
+        float alpha = (in.nowMs - _lastMs) / (SMOOTHING_S * 1000.0f);
+        if (alpha > 1.0f) alpha = 1.0f;
+        _duty += alpha * (in.tecPower - _duty);
+    }
+    _lastMs = in.nowMs;
+
+    float duty = _duty;
+    if (duty < 0.0f) duty = 0.0f;
+    if (duty > 1.0f) duty = 1.0f;
+    float percent = in.smartPercent + (in.maxPercent - in.smartPercent) * duty;
+    return {percent, false};
+}
+
+FanPolicyOutput TemperatureCurveFanPolicy::update(const FanPolicyInput& in) {
+    float fraction = (in.temperature - in.setpoint) / CURVE_SPAN_C;
+    if (fraction < 0.0f) fraction = 0.0f;
+    if (fraction > 1.0f) fraction = 1.0f;
+    float target = in.smartPercent + (in.maxPercent - in.smartPercent) * fraction;
+
+    if (!_primed) {
+        _percent = target;
+        _primed = true;
+    } else {
+        float maxChange = SLEW_PERCENT_PER_S * (in.nowMs - _lastMs) / 1000.0f;
+        if (target > _percent + maxChange) target = _percent + maxChange;
+        if (target < _percent - maxChange) target = _percent - maxChange;
+        _percent = target;
+    }
+    _lastMs = in.nowMs;
+
+    return {_percent, false};
+}
@@ -0,0 +1,152 @@
+#include "FeedForward.h"
+#include "SettingsManager.h"
+#include <Arduino.h>
+
+extern void logPrintf(const char* format, ...);
+
+void FeedForward::begin() {
+    SettingsManager::getInstance().getFeedForwardModel(_coef[0], _coef[1], _coef[2], _samples, _varied);
+    _haveSpread = false;
+
+    // A stored model is trusted more than an empty one, but stays adaptable
+    float p = (_samples > 0) ? P_RESUMED : P_INITIAL;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            _P[i][j] = (i == j) ? p : 0.0f;
+        }
+    }
+    _steadyStart = 0;
+
+    seedFromModel(SettingsManager::getInstance().getThermalModel());
+}
+
+void FeedForward::seedFromModel(const FopdtModel& model) {
+    if (_samples > 0 || !model.valid || fabsf(model.gain) < 1e-4f) return;
+
+    // Static gain K (°C per %): holding a setpoint 10°C lower takes 10/|K| % more power
+    _coef[1] = 10.0f / model.gain;
+}
+
+void FeedForward::regressors(float setpoint, float fanPercent, float* x) {
+    // Scaled so all regressors are O(1) for a well-conditioned fit
+    x[0] = 1.0f;
+    x[1] = setpoint / 10.0f;
+    x[2] = fanPercent / 100.0f;
+}
+
+float FeedForward::compute(float setpoint, float fanPercent) const {
+    if (!isLearned()) return 0.0f;
+
+    float x[3];
+    regressors(setpoint, fanPercent, x);
+    return _coef[0] * x[0] + _coef[1] * x[1] + _coef[2] * x[2];
+}
+
+void FeedForward::observe(float input, float setpoint, float fanPercent, float totalOutput,
+                          float minOutput, float maxOutput) {
+    unsigned long now = millis();
+
+    // Saturated output or a tracking error means this isn't an equilibrium
+    bool steady = fabsf(input - setpoint) < STEADY_BAND_C &&
+                  totalOutput > minOutput + 1.0f && totalOutput < maxOutput - 1.0f;
+
+    if (steady && _steadyStart != 0 &&
+        (fabsf(setpoint - _steadySetpoint) > 0.05f || fabsf(fanPercent - _steadyFan) > FAN_CHANGE_PCT)) {
+        steady = false;  // Operating point moved - start a new window
+    }
+
+    if (!steady) {
+        _steadyStart = 0;
+        return;
+    }
+
+    if (_steadyStart == 0) {
+        _steadyStart = now;
+        _steadySetpoint = setpoint;
+        _steadyFan = fanPercent;
+        _outputSum = 0.0f;
+        _outputCount = 0;
+    }
+
+    _outputSum += totalOutput;
+    _outputCount++;
+
+    if (now - _steadyStart >= STEADY_TIME_MS && _outputCount > 0) {
+        learn(_steadySetpoint, _steadyFan, _outputSum / _outputCount);
+        _steadyStart = 0;  // Next point after another full window
+    }
+}
+
+void FeedForward::noteSpread(float setpoint, float fanPercent) {
+    if (!_haveSpread) {
+        _haveSpread = true;
+        _setpointMin = _setpointMax = setpoint;
+        _fanMin = _fanMax = fanPercent;
+    }
+    if (setpoint < _setpointMin) _setpointMin = setpoint;
+    if (setpoint > _setpointMax) _setpointMax = setpoint;
+    if (fanPercent < _fanMin) _fanMin = fanPercent;
+    if (fanPercent > _fanMax) _fanMax = fanPercent;
+
+    if (_setpointMax - _setpointMin >= MIN_SETPOINT_SPREAD_C) _varied |= VARIED_SETPOINT;
+    if (_fanMax - _fanMin >= MIN_FAN_SPREAD_PCT) _varied |= VARIED_FAN;
+}
+
+void FeedForward::learn(float setpoint, float fanPercent, float output) {
+    uint8_t wasVaried = _varied;
+    noteSpread(setpoint, fanPercent);
+
+    float x[3];
+    regressors(setpoint, fanPercent, x);
+
+    // Held gains: their term comes off the target and their regressor out of
+    // the fit, so neither their coefficient nor its covariance row moves
+    bool fitted[3] = {true, (_varied & VARIED_SETPOINT) != 0, (_varied & VARIED_FAN) != 0};
+    float target = output;
+    for (int i = 1; i < 3; i++) {
+        if (!fitted[i]) {
+            target -= _coef[i] * x[i];
+            x[i] = 0.0f;
+        }
+    }
+
+    // Recursive least squares with exponential forgetting
+    float Px[3];
+    for (int i = 0; i < 3; i++) {
+        Px[i] = _P[i][0] * x[0] + _P[i][1] * x[1] + _P[i][2] * x[2];
+    }
+    float denom = FORGETTING + x[0] * Px[0] + x[1] * Px[1] + x[2] * Px[2];
+    float error = target - (_coef[0] * x[0] + _coef[1] * x[1] + _coef[2] * x[2]);
+
+    float trace = 0.0f;
+    for (int i = 0; i < 3; i++) {
+        if (fitted[i]) {
+            float k = Px[i] / denom;
+            _coef[i] += k * error;
+            for (int j = 0; j < 3; j++) {
+                if (fitted[j]) _P[i][j] = (_P[i][j] - k * Px[j]) / FORGETTING;
+            }
+        }
+        trace += _P[i][i];
+    }
+
+    // Forgetting inflates P along directions that never get excited (e.g. the
+    // fan never changes); bound it so one odd point can't swing the model
+    if (trace > 3.0f * P_INITIAL) {
+        float scale = 3.0f * P_INITIAL / trace;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                _P[i][j] *= scale;
+            }
+        }
+    }
+
+    _samples++;
+    logPrintf("FF: point %lu (SP=%.1fC fan=%.0f%% out=%.1f%%) -> bias=%.2f sp=%.2f%s fan=%.2f%s\n",
+              static_cast<unsigned long>(_samples), setpoint, fanPercent, output,
+              _coef[0], _coef[1], fitted[1] ? "" : " (held)", _coef[2], fitted[2] ? "" : " (held)");
+
+    // Persist occasionally; the write-behind commit coalesces with other saves
+    bool persist = (_samples % PERSIST_EVERY == 0) || (_samples == MIN_SAMPLES) || (_varied != wasVaried);
+    SettingsManager::getInstance().setFeedForwardModel(_coef[0], _coef[1], _coef[2], _samples, _varied, persist);
+}
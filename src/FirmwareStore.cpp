@@ -0,0 +1,175 @@
+#include "FirmwareStore.h"
+#include "Crc32.h"
+#include <Arduino.h>
+
+extern void logPrintf(const char* format, ...);
+
+static constexpr esp_partition_type_t PARTITION_TYPE = static_cast<esp_partition_type_t>(0x40);
+static constexpr esp_partition_subtype_t PARTITION_SUBTYPE = static_cast<esp_partition_subtype_t>(0x00);
+static const char* PARTITION_LABEL = "extfw";
+
+static constexpr size_t HEADER_SIZE = 12;
+static constexpr size_t ENTRY_SIZE = 36;
+static constexpr uint16_t WINDOW_MASK = (1 << FirmwareStore::WINDOW_BITS) - 1;
+
+static uint32_t readLE32(const uint8_t* p) {
+    return p[0] | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
+}
+
+FirmwareStore& FirmwareStore::getInstance() {
+    static FirmwareStore instance;
+    return instance;
+}
+
+bool FirmwareStore::begin() {
+    _partition = nullptr;
+    _imageCount = 0;
+
+    const esp_partition_t* partition = esp_partition_find_first(PARTITION_TYPE, PARTITION_SUBTYPE, PARTITION_LABEL);
+    if (!partition) {
+        logPrintf("FirmwareStore: no '%s' partition\n", PARTITION_LABEL);
+        return false;
+    }
+
+    uint8_t header[HEADER_SIZE];
+    uint8_t table[MAX_IMAGES * ENTRY_SIZE];
+    if (esp_partition_read(partition, 0, header, sizeof(header)) != ESP_OK ||
+        esp_partition_read(partition, HEADER_SIZE, table, sizeof(table)) != ESP_OK) {
+        logPrintf("FirmwareStore: partition read failed\n");
+        return false;
+    }
+    if (memcmp(header, "EXFW", 4) != 0) {
+        logPrintf("FirmwareStore: partition is empty (run pack_extio2_firmware.py and flash it)\n");
+        return false;
+    }
+    if (header[4] != FORMAT || header[5] > MAX_IMAGES || header[6] != WINDOW_BITS || header[7] != LOOKAHEAD_BITS) {
+        logPrintf("FirmwareStore: unsupported format %d (w%d l%d)\n", header[4], header[6], header[7]);
+        return false;
+    }
+    if (crc32(table, sizeof(table)) != readLE32(header + 8)) {
+        logPrintf("FirmwareStore: manifest CRC mismatch\n");
+        return false;
+    }
+
+    for (int i = 0; i < header[5]; i++) {
+        const uint8_t* entry = table + i * ENTRY_SIZE;
+        Image& image = _images[_imageCount];
+        memcpy(image.name, entry, sizeof(image.name));
+        image.name[sizeof(image.name) - 1] = '\0';
+        image.version = entry[16];
+        image.offset = readLE32(entry + 20);
+        image.compressedSize = readLE32(entry + 24);
+        image.size = readLE32(entry + 28);
+        image.crc = readLE32(entry + 32);
+        if (image.offset + image.compressedSize > partition->size) {
+            logPrintf("FirmwareStore: '%s' runs past the partition, skipped\n", image.name);
+            continue;
+        }
+        logPrintf("FirmwareStore: '%s' v%d, %u bytes (%u packed)\n", image.name, image.version,
+                  (unsigned)image.size, (unsigned)image.compressedSize);
+        _imageCount++;
+    }
+
+    _partition = partition;
+    return true;
+}
+
+const FirmwareStore::Image* FirmwareStore::find(const char* name) const {
+    for (int i = 0; i < _imageCount; i++) {
+        if (strcmp(_images[i].name, name) == 0) return &_images[i];
+    }
+    return nullptr;
+}
+
+bool FirmwareStore::verify(const Image& image) const {
+    if (!_partition) return false;
+
+    Reader reader(image);
+    uint8_t chunk[256];
+    uint32_t crc = 0;
+    for (uint32_t done = 0; done < image.size; done += sizeof(chunk)) {
+        size_t n = min(static_cast<uint32_t>(sizeof(chunk)), image.size - done);
+        if (!reader.read(chunk, n)) {
+            logPrintf("FirmwareStore: '%s' is truncated or corrupt\n", image.name);
+            return false;
+        }
+        crc = crc32(chunk, n, crc);
+    }
+    if (crc != image.crc) {
+        logPrintf("FirmwareStore: '%s' CRC %08X, expected %08X\n", image.name, (unsigned)crc, (unsigned)image.crc);
+        return false;
+    }
+    return true;
+}
+
+// Reader
+
+FirmwareStore::Reader::Reader(const Image& image)
+    : _partition(FirmwareStore::getInstance()._partition),
+      _inputOffset(image.offset),
+      _inputRemaining(image.compressedSize),
+      _outputRemaining(image.size) {
+    memset(_history, 0, sizeof(_history));
+}
+
+bool FirmwareStore::Reader::readBits(int count, uint16_t& value) {
+    value = 0;
+    while (count-- > 0) {
+        if (_bitMask == 0) {
+            // Next byte, refilling the input buffer from flash when it runs out
+            if (++_inputIndex >= _inputLength) {
+                if (_inputRemaining == 0 || !_partition) return false;
+                size_t n = min(static_cast<uint32_t>(INPUT_CHUNK), _inputRemaining);
+                if (esp_partition_read(_partition, _inputOffset, _input, n) != ESP_OK) return false;
+                _inputOffset += n;
+                _inputRemaining -= n;
+                _inputLength = n;
+                _inputIndex = 0;
+            }
+            _bitMask = 0x80;
+        }
+        value = (value << 1) | ((_input[_inputIndex] & _bitMask) ? 1 : 0);
+        _bitMask >>= 1;
+    }
+    return true;
+}
+
+void FirmwareStore::Reader::emit(uint8_t value) {
+    _history[_head] = value;
+    _head = (_head + 1) & WINDOW_MASK;
+    _produced++;
+    _outputRemaining--;
+}
+
+bool FirmwareStore::Reader::read(uint8_t* out, size_t len) {
+    while (len > 0) {
+        if (_outputRemaining == 0) return false;
+
+        if (_copyRemaining > 0) {
+            uint8_t value = _history[(_head - _copyDistance) & WINDOW_MASK];
+            emit(value);
+            _copyRemaining--;
+            *out++ = value;
+            len--;
+            continue;
+        }
+
+        uint16_t tag;
+        if (!readBits(1, tag)) return false;
+        if (tag) {
+            uint16_t value;
+            if (!readBits(8, value)) return false;
+            emit(static_cast<uint8_t>(value));
+            *out++ = static_cast<uint8_t>(value);
+            len--;
+        } else {
+            uint16_t distance, length;
+            if (!readBits(WINDOW_BITS, distance) || !readBits(LOOKAHEAD_BITS, length)) return false;
+            _copyDistance = distance + 1;
+            _copyRemaining = length + 1;
+            if (_copyDistance > _produced) return false;  // Refers to before the start
+        }
+    }
+    return true;
+}
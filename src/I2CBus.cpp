@@ -0,0 +1,203 @@
+#include "I2CBus.h"
+#include <Arduino.h>
+#include <Wire.h>
+
+extern void logPrintf(const char* format, ...);
+
+static const uint32_t CLOCK_HZ[I2CBus::CLOCK_COUNT] = {1000000, 400000, 100000};
+
+I2CBus& I2CBus::getInstance() {
+    static I2CBus instance;
+    return instance;
+}
+
+uint32_t I2CBus::clockHz(int level) {
+    if (level < 0) level = 0;
+    if (level >= CLOCK_COUNT) level = CLOCK_COUNT - 1;
+    return CLOCK_HZ[level];
+}
+
+void I2CBus::begin(int sda, int scl) {
+    _sda = sda;
+    _scl = scl;
+    _level = CLOCK_COUNT - 1;
+    _fastestLevel = CLOCK_COUNT - 1;
+    Wire.begin(sda, scl, clockHz(_level));
+    _levelSince = millis();
+    _lastStatsLog = _levelSince;
+}
+
+bool I2CBus::recover() {
+    if (_sda < 0 || _scl < 0) return false;
+
+    Wire.end();
+    pinMode(_sda, INPUT_PULLUP);
+    pinMode(_scl, OUTPUT_OPEN_DRAIN);
+    digitalWrite(_scl, HIGH);
+    delayMicroseconds(5);
+
+    // A slave holding SDA low is waiting to shift out the rest of a byte:
+    // clock it through at ~100 kHz until it releases the line
+    for (int i = 0; i < BUS_CLEAR_PULSES && digitalRead(_sda) == LOW; i++) {
+        digitalWrite(_scl, LOW);
+        delayMicroseconds(5);
+        digitalWrite(_scl, HIGH);
+        delayMicroseconds(5);
+    }
+
+    // STOP: SDA low -> high while SCL is high
+    pinMode(_sda, OUTPUT_OPEN_DRAIN);
+    digitalWrite(_sda, LOW);
+    delayMicroseconds(5);
+    digitalWrite(_sda, HIGH);
+    delayMicroseconds(5);
+    pinMode(_sda, INPUT_PULLUP);
+    bool released = digitalRead(_sda) == HIGH;
+
+    Wire.begin(_sda, _scl, clockHz(_level));
+    return released;
+}
+
+// Single-register read with repeated start; false on NACK or short read
+static bool readRegister(uint8_t addr, uint8_t reg, uint8_t& value) {
+    Wire.beginTransmission(addr);
+    Wire.write(reg);
+    if (Wire.endTransmission(false) != 0) return false;
+    if (Wire.requestFrom(addr, (uint8_t)1) != 1 || !Wire.available()) return false;
+    value = Wire.read();
+    return true;
+}
+
+uint32_t I2CBus::negotiate(uint8_t addr, uint8_t reg) {
+    // Reference value at standard mode; every probe read must match it
+    setLevel(CLOCK_COUNT - 1);
+    uint8_t reference;
+    if (!readRegister(addr, reg, reference)) {
+        logPrintf("I2C: 0x%02X not responding, staying at %lukHz\n", addr, (unsigned long)(getClock() / 1000));
+        return getClock();
+    }
+
+    int chosen = CLOCK_COUNT - 1;
+    for (int level = 0; level < CLOCK_COUNT - 1; level++) {
+        Wire.setClock(clockHz(level));
+        int good = 0;
+        for (int i = 0; i < PROBE_READS; i++) {
+            uint8_t value;
+            if (!readRegister(addr, reg, value) || value != reference) break;
+            good++;
+        }
+        logPrintf("I2C: probe %lukHz %d/%d clean\n", (unsigned long)(clockHz(level) / 1000), good, PROBE_READS);
+        if (good == PROBE_READS) {
+            chosen = level;
+            break;
+        }
+        // A read that failed mid-byte can leave a slave holding SDA; clear the
+        // bus so the next (slower) level is not judged on a stuck line
+        recover();
+    }
+
+    _fastestLevel = chosen;
+    _stepUpDelayMs = STEP_UP_INITIAL_MS;
+    _lastStepUp = 0;
+    _errorsSeen = 0;
+    setLevel(chosen);
+    logPrintf("I2C: running at %lukHz\n", (unsigned long)(getClock() / 1000));
+    return getClock();
+}
+
+void I2CBus::setLevel(int level) {
+    unsigned long now = millis();
+    _stats[_level].activeMs += now - _levelSince;
+    _levelSince = now;
+    _level = level;
+    Wire.setClock(clockHz(level));
+}
+
+void I2CBus::recordSuccess() {
+    _stats[_level].transactions++;
+}
+
+void I2CBus::recordError() {
+    unsigned long now = millis();
+    _stats[_level].transactions++;
+    _stats[_level].errors++;
+
+    _errorTimes[_errorIndex] = now;
+    _errorIndex = (_errorIndex + 1) % BURST_ERRORS;
+    if (_errorsSeen < BURST_ERRORS) _errorsSeen++;
+
+    // Oldest of the last BURST_ERRORS errors is the next slot to be overwritten
+    bool burst = _errorsSeen >= BURST_ERRORS && now - _errorTimes[_errorIndex] <= BURST_WINDOW_MS;
+    if (!burst || _held || _level >= CLOCK_COUNT - 1) return;
+
+    // A step up that fails while on probation doubles the wait for the next one
+    if (_lastStepUp != 0 && now - _lastStepUp < STEP_UP_INITIAL_MS) {
+        _stepUpDelayMs *= 2;
+        if (_stepUpDelayMs > STEP_UP_MAX_MS) _stepUpDelayMs = STEP_UP_MAX_MS;
+    }
+    _lastStepUp = 0;
+    _errorsSeen = 0;
+    _lastStepDown = now;
+    setLevel(_level + 1);
+    logPrintf("I2C: error burst, stepping down to %lukHz\n", (unsigned long)(getClock() / 1000));
+}
+
+void I2CBus::holdStandardMode(bool hold) {
+    if (hold == _held) return;
+    if (hold) {
+        _levelBeforeHold = _level;
+        setLevel(CLOCK_COUNT - 1);
+    } else {
+        setLevel(_levelBeforeHold);
+    }
+    _held = hold;
+    _errorsSeen = 0;
+}
+
+void I2CBus::update() {
+    unsigned long now = millis();
+
+    // Clean since the last step down: retry the next faster clock
+    if (!_held && _level > _fastestLevel && now - _lastStepDown >= _stepUpDelayMs) {
+        setLevel(_level - 1);
+        _lastStepUp = now;
+        _lastStepDown = now;  // Also paces the following step up
+        _errorsSeen = 0;
+        logPrintf("I2C: clean for %lus, retrying %lukHz\n", _stepUpDelayMs / 1000,
+                  (unsigned long)(getClock() / 1000));
+    }
+
+    // Survived probation: the next failure starts the back-off over
+    if (_lastStepUp != 0 && now - _lastStepUp >= STEP_UP_INITIAL_MS) {
+        _lastStepUp = 0;
+        _stepUpDelayMs = STEP_UP_INITIAL_MS;
+    }
+
+    if (now - _lastStatsLog >= STATS_INTERVAL_MS) {
+        _lastStatsLog = now;
+        logStats();
+    }
+}
+
+I2CBus::ClockStats I2CBus::getStats(int level) const {
+    ClockStats stats = {};
+    if (level < 0 || level >= CLOCK_COUNT) return stats;
+    stats = _stats[level];
+    if (level == _level) stats.activeMs += millis() - _levelSince;
+    return stats;
+}
+
+void I2CBus::logStats() {
+    char line[200];
+    int len = snprintf(line, sizeof(line), "I2C: at %lukHz |", (unsigned long)(getClock() / 1000));
+    for (int level = 0; level < CLOCK_COUNT && len < (int)sizeof(line); level++) {
+        ClockStats stats = getStats(level);
+        if (stats.activeMs == 0) continue;
+        // Achieved throughput (transactions/s while at this clock) and error rate
+        float rate = stats.transactions * 1000.0f / stats.activeMs;
+        float errorPercent = stats.transactions ? stats.errors * 100.0f / stats.transactions : 0.0f;
+        len += snprintf(line + len, sizeof(line) - len, " %lukHz: %.1f tx/s, %.3f%% err (%lus)",
+                        (unsigned long)(clockHz(level) / 1000), rate, errorPercent, stats.activeMs / 1000);
+    }
+    logPrintf("%s\n", line);
+}
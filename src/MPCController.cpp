@@ -0,0 +1,261 @@
+#include "MPCController.h"
+#include <Arduino.h>
+
+extern void logPrintf(const char* format, ...);
+
+// Constraint row i of A (A * u <= gamma), in blocks of MOVES rows:
+// u <= max, -u <= -min, du <= slew, -du <= slew (du_0 = u_0 - u_prev)
+static void constraintRow(int i, float* row, int moves) {
+    for (int m = 0; m < moves; m++) row[m] = 0.0f;
+
+    int block = i / moves;
+    int m = i % moves;
+    float sign = (block % 2 == 0) ? 1.0f : -1.0f;
+    row[m] = sign;
+    if (block >= 2 && m > 0) row[m - 1] = -sign;
+}
+
+bool MPCController::configure(const FopdtModel& model) {
+    _configured = false;
+    if (!model.valid || model.gain == 0.0f || model.timeConstant < 1.0f) return false;
+
+    // Step so the horizon spans about one time constant after the dead time
+    float stepS = model.timeConstant / HORIZON;
+    if (stepS < 1.0f) stepS = 1.0f;
+    if (stepS > 30.0f) stepS = 30.0f;
+    _stepMs = static_cast<unsigned long>(stepS * 1000.0f);
+
+    _a = expf(-stepS / model.timeConstant);
+    _b = model.gain * (1.0f - _a);
+    _delay = static_cast<int>(model.deadTime / stepS + 0.5f);
+    if (_delay > MAX_DELAY) _delay = MAX_DELAY;
+
+    // Forced response: G[j][m] = effect of move m on T[k+d+j+1]
+    for (int j = 0; j < HORIZON; j++) {
+        int active = (j < MOVES) ? j : MOVES - 1;
+        for (int m = 0; m < MOVES; m++) {
+            float previous = (j > 0) ? _G[j - 1][m] : 0.0f;
+            _G[j][m] = _a * previous + ((m == active) ? _b : 0.0f);
+        }
+    }
+
+    // Hessian E = G'G + rho * D'D (D = first difference incl. the previous output)
+    _rho = MOVE_WEIGHT * model.gain * model.gain;
+    float E[MOVES][MOVES];
+    for (int i = 0; i < MOVES; i++) {
+        for (int m = 0; m < MOVES; m++) {
+            float sum = 0.0f;
+            for (int j = 0; j < HORIZON; j++) sum += _G[j][i] * _G[j][m];
+            if (i == m) sum += _rho * ((i < MOVES - 1) ? 2.0f : 1.0f);
+            else if (i - m == 1 || m - i == 1) sum -= _rho;
+            E[i][m] = sum;
+        }
+    }
+    if (!invert(E, _Einv)) return false;
+
+    // Dual Hessian A * Einv * A'
+    float A[CONSTRAINTS][MOVES];
+    for (int i = 0; i < CONSTRAINTS; i++) constraintRow(i, A[i], MOVES);
+    for (int i = 0; i < CONSTRAINTS; i++) {
+        float row[MOVES];
+        for (int m = 0; m < MOVES; m++) {
+            row[m] = 0.0f;
+            for (int n = 0; n < MOVES; n++) row[m] += A[i][n] * _Einv[n][m];
+        }
+        for (int j = 0; j < CONSTRAINTS; j++) {
+            float sum = 0.0f;
+            for (int m = 0; m < MOVES; m++) sum += row[m] * A[j][m];
+            _Hd[i][j] = sum;
+        }
+    }
+
+    _configured = true;
+    _primed = false;
+    logPrintf("MPC: step %.1fs, a=%.4f, b=%.5f, delay %d steps, horizon %.0fs\n",
+              stepS, _a, _b, _delay, stepS * (HORIZON + _delay));
+    return true;
+}
+
+bool MPCController::invert(float m[MOVES][MOVES], float inv[MOVES][MOVES]) {
+    // Gauss-Jordan with partial pivoting
+    float a[MOVES][2 * MOVES];
+    for (int i = 0; i < MOVES; i++) {
+        for (int j = 0; j < MOVES; j++) {
+            a[i][j] = m[i][j];
+            a[i][MOVES + j] = (i == j) ? 1.0f : 0.0f;
+        }
+    }
+
+    for (int col = 0; col < MOVES; col++) {
+        int pivot = col;
+        for (int r = col + 1; r < MOVES; r++) {
+            if (fabsf(a[r][col]) > fabsf(a[pivot][col])) pivot = r;
+        }
+        if (fabsf(a[pivot][col]) < 1e-12f) return false;
+        if (pivot != col) {
+            for (int j = 0; j < 2 * MOVES; j++) {
+                float t = a[col][j];
+                a[col][j] = a[pivot][j];
+                a[pivot][j] = t;
+            }
+        }
+
+        float scale = 1.0f / a[col][col];
+        for (int j = 0; j < 2 * MOVES; j++) a[col][j] *= scale;
+        for (int r = 0; r < MOVES; r++) {
+            if (r == col) continue;
+            float factor = a[r][col];
+            for (int j = 0; j < 2 * MOVES; j++) a[r][j] -= factor * a[col][j];
+        }
+    }
+
+    for (int i = 0; i < MOVES; i++) {
+        for (int j = 0; j < MOVES; j++) inv[i][j] = a[i][MOVES + j];
+    }
+    return true;
+}
+
+void MPCController::reset(float output) {
+    _u = output;
+    _applied = output;
+    for (int i = 0; i <= MAX_DELAY; i++) _uPast[i] = output;
+    _c = 0.0f;
+    _primed = false;
+    _lastApply = millis();
+}
+
+float MPCController::update(float temperature, float setpoint, float fanPercent,
+                            float minOutput, float maxOutput, float slewPerSecond) {
+    if (!_configured) return _applied;
+    unsigned long now = millis();
+
+    // Fan coupling: cap power while the heatsink fan is slow
+    float fanFraction = fanPercent / FAN_FULL_POWER_PCT;
+    if (fanFraction > 1.0f) fanFraction = 1.0f;
+    if (fanFraction < 0.0f) fanFraction = 0.0f;
+    float cap = maxOutput * (FAN_MIN_POWER + (1.0f - FAN_MIN_POWER) * fanFraction);
+    if (cap < minOutput) cap = minOutput;
+
+    if (!_primed || now - _lastStep >= _stepMs) {
+        // Shift the input history: [0] = output of the step just ended
+        for (int i = MAX_DELAY; i > 0; i--) _uPast[i] = _uPast[i - 1];
+        _uPast[0] = _u;
+
+        if (_primed) {
+            // Offset observer: correct c by the one-step prediction error
+            float predicted = _a * _lastT + _b * _uPast[_delay] + _c;
+            _c += DISTURBANCE_GAIN * (temperature - predicted);
+        } else {
+            // Start at equilibrium for the current output
+            _c = (1.0f - _a) * temperature - _b * _u;
+        }
+
+        solve(temperature, setpoint, minOutput, cap, slewPerSecond * _stepMs / 1000.0f);
+        _lastT = temperature;
+        _lastStep = now;
+        _primed = true;
+    }
+
+    // Slew toward the step's power in real time
+    float maxChange = slewPerSecond * (now - _lastApply) / 1000.0f;
+    _lastApply = now;
+    float target = _u;
+    if (target > cap) target = cap;
+    if (target > _applied + maxChange) target = _applied + maxChange;
+    if (target < _applied - maxChange) target = _applied - maxChange;
+    _applied = target;
+    return _applied;
+}
+
+void MPCController::solve(float temperature, float setpoint, float minOutput, float maxOutput, float slew) {
+    float uPrev = _uPast[0];
+
+    // Free response: run the dead time out on past inputs, then zero input
+    float y = temperature;
+    for (int j = 1; j <= _delay; j++) {
+        y = _a * y + _b * _uPast[_delay - j] + _c;
+    }
+    float free[HORIZON];
+    for (int j = 0; j < HORIZON; j++) {
+        y = _a * y + _c;
+        free[j] = y;
+    }
+
+    // Linear term f = G'(free - r) - rho * uPrev * e0
+    float f[MOVES];
+    for (int m = 0; m < MOVES; m++) {
+        float sum = 0.0f;
+        for (int j = 0; j < HORIZON; j++) sum += _G[j][m] * (free[j] - setpoint);
+        f[m] = sum;
+    }
+    f[0] -= _rho * uPrev;
+
+    float x[MOVES];
+    for (int i = 0; i < MOVES; i++) {
+        x[i] = 0.0f;
+        for (int m = 0; m < MOVES; m++) x[i] -= _Einv[i][m] * f[m];
+    }
+
+    // Constraint bounds gamma
+    float gamma[CONSTRAINTS];
+    for (int m = 0; m < MOVES; m++) {
+        gamma[m] = maxOutput;
+        gamma[MOVES + m] = -minOutput;
+        gamma[2 * MOVES + m] = slew + ((m == 0) ? uPrev : 0.0f);
+        gamma[3 * MOVES + m] = slew - ((m == 0) ? uPrev : 0.0f);
+    }
+
+    // Hildreth's method on the dual: K = gamma - A * x_unconstrained
+    float K[CONSTRAINTS];
+    bool active = false;
+    for (int i = 0; i < CONSTRAINTS; i++) {
+        float row[MOVES];
+        constraintRow(i, row, MOVES);
+        float ax = 0.0f;
+        for (int m = 0; m < MOVES; m++) ax += row[m] * x[m];
+        K[i] = gamma[i] - ax;
+        if (K[i] < 0.0f) active = true;
+    }
+
+    if (active) {
+        float lambda[CONSTRAINTS] = {0};
+        for (int iter = 0; iter < SOLVER_ITERATIONS; iter++) {
+            float change = 0.0f;
+            for (int i = 0; i < CONSTRAINTS; i++) {
+                float w = -K[i];
+                for (int j = 0; j < CONSTRAINTS; j++) {
+                    if (j != i) w -= _Hd[i][j] * lambda[j];
+                }
+                w = (_Hd[i][i] > 0.0f) ? w / _Hd[i][i] : 0.0f;
+                if (w < 0.0f) w = 0.0f;
+                change += fabsf(w - lambda[i]);
+                lambda[i] = w;
+            }
+            if (change < 1e-6f) break;
+        }
+
+        // x = x_unconstrained - Einv * A' * lambda
+        float atl[MOVES] = {0};
+        for (int i = 0; i < CONSTRAINTS; i++) {
+            if (lambda[i] == 0.0f) continue;
+            float row[MOVES];
+            constraintRow(i, row, MOVES);
+            for (int m = 0; m < MOVES; m++) atl[m] += row[m] * lambda[i];
+        }
+        for (int i = 0; i < MOVES; i++) {
+            for (int m = 0; m < MOVES; m++) x[i] -= _Einv[i][m] * atl[m];
+        }
+    }
+
+    // Infeasible corners (limits moved beyond one slew step) fall back to clamping
+    float u = x[0];
+    if (u > uPrev + slew) u = uPrev + slew;
+    if (u < uPrev - slew) u = uPrev - slew;
+    if (u > maxOutput) u = maxOutput;
+    if (u < minOutput) u = minOutput;
+    _u = u;
+
+    // Predicted temperature at the end of the horizon for the chosen plan
+    _prediction = free[HORIZON - 1];
+    for (int m = 0; m < MOVES; m++) _prediction += _G[HORIZON - 1][m] * x[m];
+}
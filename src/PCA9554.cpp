@@ -1,7 +1,19 @@
 #include "PCA9554.h"
+#include "I2CBus.h"
 #include <Arduino.h>
 #include <Wire.h>
 
+extern void logPrintf(const char* format, ...);
+
+// Custom modes (firmware v3+) - direct I2C since not in library yet
+static constexpr uint8_t PWM_IO_MODE = 5;
+static constexpr uint8_t FAN_RPM_MODE = 6;  // Custom firmware mode for fan tach
+static constexpr uint8_t REG_MODE_BASE = 0x00;
+static constexpr uint8_t REG_OUTPUT_BASE = 0x10;  // Digital output level, 1 byte per pin
+static constexpr uint8_t REG_PWM_DUTY_BASE = 0x90;
+static constexpr uint8_t REG_PWM_FREQ = 0xA0;
+static constexpr uint8_t REG_FAN_RPM_BASE = 0xB0;  // 2 bytes per channel, little-endian
+
 PCA9554& PCA9554::getInstance() {
     static PCA9554 instance;
     return instance;
@@ -11,28 +23,34 @@ void PCA9554::begin() {
     _online = true;
     _errorCount = 0;
     _outputState = 0xFF;
+    _reconnectState = RECONNECT_IDLE;
+    memset(_pinMode, DIGITAL_INPUT_MODE, sizeof(_pinMode));  // setAllPinMode below
 
     Serial.println("PCA9554::begin()");
 
-    // Initialize EXTIO2 with Wire (already initialized in main.cpp)
+    // Initialize EXTIO2 with Wire (already initialized by I2CBus in main.cpp)
     // SDA=13, SCL=15 for Port A on M5Dial
-    if (!_extio.begin(&Wire, 13, 15, I2C_ADDR)) {
+    auto& bus = I2CBus::getInstance();
+    if (!_extio.begin(&Wire, 13, 15, I2C_ADDR, bus.getClock())) {
         Serial.println("  EXTIO2 begin failed!");
-        recordError();
+        goOffline();  // Keep retrying in the background
         return;
     }
 
     // Read firmware version
     Wire.beginTransmission(I2C_ADDR);
-    Wire.write(0xFE);  // Version register
+    Wire.write(REG_VERSION);
     if (Wire.endTransmission(false) == 0) {
         Wire.requestFrom(I2C_ADDR, (uint8_t)1);
         if (Wire.available()) {
-            uint8_t version = Wire.read();
-            Serial.printf("  EXTIO2 firmware version: %d\n", version);
+            _firmwareVersion = Wire.read();
+            Serial.printf("  EXTIO2 firmware version: %d\n", _firmwareVersion);
         }
     }
 
+    // Move the link to the fastest clock the EXTIO2 reads back cleanly at
+    bus.negotiate(I2C_ADDR, REG_VERSION);
+
     // Set all pins to digital input mode by default (safe state)
     if (!_extio.setAllPinMode(DIGITAL_INPUT_MODE)) {
         Serial.println("  setAllPinMode failed!");
@@ -43,9 +61,12 @@ void PCA9554::begin() {
 }
 
 void PCA9554::setPinMode(uint8_t pin, bool isOutput) {
-    if (pin > 7 || !_online) return;
+    if (pin > 7) return;
 
     extio_io_mode_t mode = isOutput ? DIGITAL_OUTPUT_MODE : DIGITAL_INPUT_MODE;
+    _pinMode[pin] = mode;
+    if (deferWhileOffline()) return;
+
     if (!_extio.setPinMode(pin, mode)) {
         recordError();
     } else {
@@ -54,13 +75,14 @@ void PCA9554::setPinMode(uint8_t pin, bool isOutput) {
 }
 
 void PCA9554::digitalWrite(uint8_t pin, bool level) {
-    if (pin > 7 || !_online) return;
+    if (pin > 7) return;
 
     if (level) {
         _outputState |= (1 << pin);
     } else {
         _outputState &= ~(1 << pin);
     }
+    if (deferWhileOffline()) return;
 
     if (!_extio.setDigitalOutput(pin, level ? 1 : 0)) {
         recordError();
@@ -78,7 +100,10 @@ bool PCA9554::digitalRead(uint8_t pin) {
 }
 
 void PCA9554::setServoPinMode(uint8_t pin) {
-    if (pin > 7 || !_online) return;
+    if (pin > 7) return;
+
+    _pinMode[pin] = SERVO_CTL_MODE;
+    if (deferWhileOffline()) return;
 
     if (!_extio.setPinMode(pin, SERVO_CTL_MODE)) {
         recordError();
@@ -97,16 +122,11 @@ void PCA9554::setServoAngle(uint8_t pin, uint8_t angle) {
     }
 }
 
-// Custom modes (firmware v3+) - direct I2C since not in library yet
-static constexpr uint8_t PWM_IO_MODE = 5;
-static constexpr uint8_t FAN_RPM_MODE = 6;  // Custom firmware mode for fan tach
-static constexpr uint8_t REG_MODE_BASE = 0x00;
-static constexpr uint8_t REG_PWM_DUTY_BASE = 0x90;
-static constexpr uint8_t REG_PWM_FREQ = 0xA0;
-static constexpr uint8_t REG_FAN_RPM_BASE = 0xB0;  // 2 bytes per channel, little-endian
-
 void PCA9554::setPWMPinMode(uint8_t pin) {
-    if (pin > 7 || !_online) return;
+    if (pin > 7) return;
+
+    _pinMode[pin] = PWM_IO_MODE;
+    if (deferWhileOffline()) return;
 
     Wire.beginTransmission(I2C_ADDR);
     Wire.write(REG_MODE_BASE + pin);
@@ -119,8 +139,9 @@ void PCA9554::setPWMPinMode(uint8_t pin) {
 }
 
 void PCA9554::setPWMFrequency(uint8_t freqMode) {
-    if (!_online) return;
     if (freqMode > 5) freqMode = 5;  // 0-4 standard, 5=25kHz (custom firmware)
+    _pwmFreq = freqMode;
+    if (deferWhileOffline()) return;
 
     Wire.beginTransmission(I2C_ADDR);
     Wire.write(REG_PWM_FREQ);
@@ -132,9 +153,30 @@ void PCA9554::setPWMFrequency(uint8_t freqMode) {
     }
 }
 
+uint8_t PCA9554::readPWMFrequency() {
+    if (!_online) return 0xFF;
+
+    Wire.beginTransmission(I2C_ADDR);
+    Wire.write(REG_PWM_FREQ);
+    if (Wire.endTransmission(false) != 0) {
+        recordError();
+        return 0xFF;
+    }
+
+    Wire.requestFrom(I2C_ADDR, (uint8_t)1);
+    if (!Wire.available()) {
+        recordError();
+        return 0xFF;
+    }
+    recordSuccess();
+    return Wire.read();
+}
+
 void PCA9554::setPWMDutyCycle(uint8_t pin, uint8_t percent) {
-    if (pin > 7 || !_online) return;
+    if (pin > 7) return;
     if (percent > 100) percent = 100;
+    _pwmDuty[pin] = percent;
+    if (deferWhileOffline()) return;
 
     // Duty cycle: 1 byte per channel at base + pin
     Wire.beginTransmission(I2C_ADDR);
@@ -148,7 +190,10 @@ void PCA9554::setPWMDutyCycle(uint8_t pin, uint8_t percent) {
 }
 
 void PCA9554::setFanRPMPinMode(uint8_t pin) {
-    if (pin > 7 || !_online) return;
+    if (pin > 7) return;
+
+    _pinMode[pin] = FAN_RPM_MODE;
+    if (deferWhileOffline()) return;
 
     Wire.beginTransmission(I2C_ADDR);
     Wire.write(REG_MODE_BASE + pin);
@@ -161,52 +206,181 @@ void PCA9554::setFanRPMPinMode(uint8_t pin) {
 }
 
 uint16_t PCA9554::readFanRPM(uint8_t pin) {
-    if (pin > 7 || !_online) return 0;
+    uint16_t rpm = 0;
+    readFanRPMs(pin, 1, &rpm);
+    return rpm;
+}
+
+bool PCA9554::readFanRPMs(uint8_t firstPin, uint8_t count, uint16_t* rpm) {
+    if (count == 0 || firstPin + count > 8 || !_online) return false;
 
-    // Request 2 bytes from the RPM register (0xB0 + pin*2, little-endian)
+    // Register pointer write + repeated start; the firmware auto-increments
+    // through the RPM block (0xB0 + pin*2, little-endian)
     Wire.beginTransmission(I2C_ADDR);
-    Wire.write(REG_FAN_RPM_BASE + (pin * 2));
+    Wire.write(REG_FAN_RPM_BASE + (firstPin * 2));
     if (Wire.endTransmission(false) != 0) {
         recordError();
-        return 0;
+        return false;
+    }
+
+    uint8_t length = count * 2;
+    Wire.requestFrom(I2C_ADDR, length);
+    if (Wire.available() < length) {
+        while (Wire.available()) Wire.read();
+        recordError();
+        return false;
     }
 
-    Wire.requestFrom(I2C_ADDR, (uint8_t)2);
-    if (Wire.available() >= 2) {
+    for (uint8_t i = 0; i < count; i++) {
         uint8_t lowByte = Wire.read();   // Little-endian: low byte first
         uint8_t highByte = Wire.read();
-        recordSuccess();
-        return (highByte << 8) | lowByte;
+        rpm[i] = (highByte << 8) | lowByte;
     }
-
-    recordError();
-    return 0;
+    recordSuccess();
+    return true;
 }
 
-void PCA9554::tryReconnect() {
-    if (_online) return;
+void PCA9554::update() {
+    if (_reconnectState == RECONNECT_IDLE || _reconnectState == RECONNECT_SUSPENDED) return;
 
     unsigned long now = millis();
-    if (now - _lastRetryTime < RETRY_INTERVAL_MS) return;
-
-    _lastRetryTime = now;
+    if (_reconnectState == RECONNECT_WAIT) {
+        if ((long)(now - _nextAttempt) >= 0) {
+            attemptReconnect(now);
+        }
+        return;
+    }
 
-    // Try to reinitialize
-    if (_extio.begin(&Wire, 13, 15, I2C_ADDR)) {
+    // RECONNECT_RESTORE: one register per loop keeps each call short
+    if (!restoreNext()) {
+        _reconnectState = RECONNECT_WAIT;
+        _nextAttempt = now + _backoffMs;
+        return;
+    }
+    if (_reconnectState == RECONNECT_IDLE) {
         _online = true;
         _errorCount = 0;
-        // Reinitialize all pins to input mode
-        _extio.setAllPinMode(DIGITAL_INPUT_MODE);
+        _reconnects++;
+        logPrintf("EXTIO2: reconnected (firmware %d), pin state restored\n", _firmwareVersion);
+    }
+}
+
+bool PCA9554::deferWhileOffline() {
+    // Setters update the shadow first; while offline that is all they do, and
+    // a restore in progress starts over to pick the change up
+    if (_online) return false;
+    _shadowDirty = true;
+    return true;
+}
+
+void PCA9554::goOffline() {
+    _online = false;
+    _reconnectState = RECONNECT_WAIT;
+    _backoffMs = BACKOFF_MIN_MS;
+    _nextAttempt = millis() + _backoffMs;
+    logPrintf("EXTIO2: offline, reconnecting in the background\n");
+}
+
+void PCA9554::suspend() {
+    _online = false;
+    _reconnectState = RECONNECT_SUSPENDED;
+    logPrintf("EXTIO2: suspended\n");
+}
+
+void PCA9554::resume() {
+    if (_reconnectState != RECONNECT_SUSPENDED) return;
+    _reconnectState = RECONNECT_WAIT;
+    _backoffMs = BACKOFF_MIN_MS;
+    _nextAttempt = millis();
+}
+
+void PCA9554::attemptReconnect(unsigned long now) {
+    // Free SDA in case the expander was reset mid-byte, then probe the
+    // version register. Reconnect traffic is not reported to I2CBus: an
+    // unplugged cable must not look like a clock problem.
+    I2CBus::getInstance().recover();
+
+    uint8_t version = 0;
+    bool present = false;
+    Wire.beginTransmission(I2C_ADDR);
+    Wire.write(REG_VERSION);
+    if (Wire.endTransmission(false) == 0 && Wire.requestFrom(I2C_ADDR, (uint8_t)1) == 1 && Wire.available()) {
+        version = Wire.read();
+        present = true;
+    }
+
+    if (!present) {
+        _backoffMs *= 2;
+        if (_backoffMs > BACKOFF_MAX_MS) _backoffMs = BACKOFF_MAX_MS;
+        _nextAttempt = now + _backoffMs;
+        return;
     }
+
+    // The unit may have been reflashed or power-cycled: it is back at its
+    // defaults, so restore everything the application has configured
+    _firmwareVersion = version;
+    _restoreIndex = 0;
+    _shadowDirty = false;
+    _reconnectState = RECONNECT_RESTORE;
+}
+
+// Restore order: pin modes, output levels, PWM frequency, PWM duties
+static constexpr uint8_t RESTORE_OUTPUTS = 8;
+static constexpr uint8_t RESTORE_PWM_FREQ = 16;
+static constexpr uint8_t RESTORE_DUTIES = 17;
+static constexpr uint8_t RESTORE_END = 25;
+
+bool PCA9554::restoreNext() {
+    while (_restoreIndex < RESTORE_END) {
+        uint8_t step = _restoreIndex++;
+
+        if (step < RESTORE_OUTPUTS) {
+            uint8_t pin = step;
+            if (_pinMode[pin] != MODE_UNSET) return writeRegister(REG_MODE_BASE + pin, _pinMode[pin]);
+        } else if (step < RESTORE_PWM_FREQ) {
+            uint8_t pin = step - RESTORE_OUTPUTS;
+            if (_pinMode[pin] == DIGITAL_OUTPUT_MODE) {
+                return writeRegister(REG_OUTPUT_BASE + pin, (_outputState >> pin) & 0x01);
+            }
+        } else if (step == RESTORE_PWM_FREQ) {
+            // The EXTIO2 may have been reflashed while offline (stock
+            // firmware after "Restore original"): never hand 25 kHz to
+            // software PWM
+            if (_pwmFreq == PWM_FREQ_25KHZ && _firmwareVersion < HW_PWM_FIRMWARE_VERSION) {
+                _pwmFreq = PWM_FREQ_1KHZ;
+            }
+            if (_pwmFreq != MODE_UNSET) return writeRegister(REG_PWM_FREQ, _pwmFreq);
+        } else {
+            uint8_t pin = step - RESTORE_DUTIES;
+            if (_pinMode[pin] == PWM_IO_MODE) return writeRegister(REG_PWM_DUTY_BASE + pin, _pwmDuty[pin]);
+        }
+    }
+
+    if (_shadowDirty) {
+        _shadowDirty = false;
+        _restoreIndex = 0;
+        return true;
+    }
+    _reconnectState = RECONNECT_IDLE;
+    return true;
+}
+
+bool PCA9554::writeRegister(uint8_t reg, uint8_t value) {
+    Wire.beginTransmission(I2C_ADDR);
+    Wire.write(reg);
+    Wire.write(value);
+    return Wire.endTransmission() == 0;
 }
 
 void PCA9554::recordError() {
+    I2CBus::getInstance().recordError();  // Error bursts step the bus clock down
     _errorCount++;
-    if (_errorCount >= MAX_ERRORS) {
-        _online = false;
+    if (_errorCount >= MAX_ERRORS && _online) {
+        goOffline();
     }
 }
 
 void PCA9554::recordSuccess() {
+    I2CBus::getInstance().recordSuccess();
     _errorCount = 0;
 }
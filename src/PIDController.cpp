@@ -1,5 +1,6 @@
 #include "PIDController.h"
 #include "SettingsManager.h"
+#include "FanController.h"
 #include <Arduino.h>
 
 extern void logPrintf(const char* format, ...);
@@ -18,6 +19,9 @@ void PIDController::begin() {
     _minOutput = settings.getPIDMinOutput();
     _maxOutput = settings.getPIDMaxOutput();
     _mode = settings.getPIDMode();
+    _appliedKp = _kp;
+    _appliedKi = _ki;
+    _appliedKd = _kd;
 
     // Create PID controller
     _pid = new QuickPID(&_input, &_output, &_setpoint,
@@ -27,7 +31,10 @@ void PIDController::begin() {
                         QuickPID::iAwMode::iAwClamp,
                         QuickPID::Action::reverse);  // Reverse: higher output = more cooling = lower temp
 
-    _pid->SetOutputLimits(_minOutput, _maxOutput);
+    _ff.begin();
+    _estimator.begin(settings.getThermalModel());
+    _mpc.configure(settings.getThermalModel());
+    applyOutputLimits();
     _pid->SetSampleTimeUs(SAMPLE_TIME_MS * 1000);
 
     if (_mode == PID_ON) {
@@ -46,14 +53,178 @@ void PIDController::update(float currentTemp, float setpoint) {
     }
 
     if (_autoTuning) {
-        runAutoTune();
+        if (_identifying) {
+            runIdentification();
+        } else {
+            runAutoTune();
+        }
         return;
     }
 
     if (_mode == PID_ON && _pid) {
-        _pid->Compute();
+        auto& settings = SettingsManager::getInstance();
+        bool useMpc = settings.getMPCEnabled() && _mpc.isConfigured();
+        if (useMpc != _mpcActive) {
+            selectController(useMpc, currentTemp);
+        }
+
+        if (_mpcActive) {
+            _output = _mpc.update(currentTemp, _setpoint, FanController::getInstance().getSpeed(),
+                                  _minOutput, _maxOutput, settings.getMPCSlewRate());
+        } else {
+            applyGainSchedule(currentTemp, _setpoint);
+            updateFeedForward(currentTemp);
+            _pid->Compute();
+        }
+
+        // Total output actually applied, so feed-forward is part of the plant input
+        _estimator.update(currentTemp, getOutput() * 100.0f);
+        checkPlantDrift();
     } else if (_mode == PID_OFF) {
         _output = 0.0f;
+        _mpcActive = false;
+        _ffTracking = false;
+        if (_feedForward != 0.0f) {
+            _feedForward = 0.0f;
+            applyOutputLimits();
+        }
+        _ff.resetSteadyState();
+        _estimator.pause();
+    }
+}
+
+float PIDController::getOutput() const {
+    float total = _output + _feedForward;
+    if (total < _minOutput) total = _minOutput;
+    if (total > _maxOutput) total = _maxOutput;
+    return total / 100.0f;
+}
+
+void PIDController::selectController(bool mpc, float currentTemp) {
+    // Hand over at the currently applied output so neither side bumps
+    float output = getOutput() * 100.0f;
+    _mpcActive = mpc;
+
+    if (mpc) {
+        // The model already covers the steady-state power - no feed-forward
+        _feedForward = 0.0f;
+        _ffTracking = false;
+        applyOutputLimits();
+        _ff.resetSteadyState();
+        _output = output;
+        _mpc.reset(output);
+        logPrintf("Control: MPC (step %lums)\n", _mpc.getStepMs());
+    } else {
+        // Bring the feed-forward term back first, then seed the integral with
+        // the remainder via QuickPID's manual -> automatic re-initialisation
+        updateFeedForward(currentTemp);
+        _output = output - _feedForward;
+        _pid->SetMode(QuickPID::Control::manual);
+        _pid->SetMode(QuickPID::Control::automatic);
+        logPrintf("Control: PID\n");
+    }
+}
+
+void PIDController::updateFeedForward(float currentTemp) {
+    auto& settings = SettingsManager::getInstance();
+    float fan = FanController::getInstance().getSpeed();
+
+    // Learn from the previous cycle's total output, then recompute the term
+    _ff.observe(currentTemp, _setpoint, fan, getOutput() * 100.0f, _minOutput, _maxOutput);
+
+    // Also the term at the operating point the current one was computed
+    // for: the difference to it is a model change (newly learned point,
+    // feed-forward switched on or off), not a setpoint or fan move
+    float ff = 0.0f;
+    float ffHere = 0.0f;
+    if (settings.getFeedForwardEnabled()) {
+        ff = _ff.compute(_setpoint, fan);
+        ffHere = _ff.compute(_ffSetpoint, _ffFan);
+        if (ff < _minOutput) ff = _minOutput;
+        if (ff > _maxOutput) ff = _maxOutput;
+        if (ffHere < _minOutput) ffHere = _minOutput;
+        if (ffHere > _maxOutput) ffHere = _maxOutput;
+    }
+
+    // Only touch QuickPID limits on a meaningful change
+    if (fabsf(ff - _feedForward) > 0.05f || (ff == 0.0f && _feedForward != 0.0f)) {
+        // The integral already holds the steady-state power: move a model
+        // change out of it so the total output stays put. Only the part from
+        // the setpoint or fan moving (or PID taking over from off or MPC)
+        // comes through as a step.
+        float modelStep = _ffTracking ? ffHere - _feedForward : 0.0f;
+        if (_pid && modelStep != 0.0f) {
+            _pid->SetOutputSum(_pid->GetOutputSum() - modelStep);
+            _output -= modelStep;
+        }
+        _feedForward = ff;
+        _ffSetpoint = _setpoint;
+        _ffFan = fan;
+        applyOutputLimits();
+    }
+    _ffTracking = true;
+}
+
+void PIDController::checkPlantDrift() {
+    if (!_estimator.hasEstimate()) return;
+
+    auto& settings = SettingsManager::getInstance();
+
+    // Nothing identified yet: the first converged estimate becomes the
+    // reference the current tunings are judged against
+    if (!_estimator.getReference().valid) {
+        FopdtModel estimate = _estimator.getEstimate();
+        _estimator.setReference(estimate);
+        logPrintf("Plant estimate: reference K=%.4fC/%%, tau=%.1fs\n", estimate.gain, estimate.timeConstant);
+        return;
+    }
+
+    bool drifted = _estimator.getDrift() > settings.getPlantDriftThreshold();
+    if (drifted != _plantDrifted) {
+        FopdtModel estimate = _estimator.getEstimate();
+        const FopdtModel& reference = _estimator.getReference();
+        logPrintf("Plant %s: K=%.4fC/%% (ref %.4f), tau=%.1fs (ref %.1f), drift=%.0f%%\n",
+                  drifted ? "drift detected" : "back in range",
+                  estimate.gain, reference.gain, estimate.timeConstant, reference.timeConstant,
+                  _estimator.getDrift() * 100.0f);
+        _plantDrifted = drifted;
+    }
+
+    if (_plantDrifted && settings.getAdaptiveTuningEnabled() &&
+        (_lastAdapt == 0 || millis() - _lastAdapt >= ADAPT_MIN_INTERVAL_MS)) {
+        adaptToEstimate();
+    }
+}
+
+void PIDController::adaptToEstimate() {
+    // Re-derive the gains the same way step identification does, keeping the
+    // identified dead time (closed-loop data can't separate it from tau)
+    FopdtModel model = _estimator.getEstimate();
+    float kp, ki, kd;
+    imcPidTunings(model, MODEL_LAMBDA_FACTOR * model.timeConstant, kp, ki, kd);
+
+    if (isnan(kp) || isnan(ki) || isnan(kd) || kp <= 0.0f || kp > 50.0f || ki < 0.0f || ki > 10.0f ||
+        kd < 0.0f || kd > 50.0f) {
+        logPrintf("Plant adapt: tunings out of range (Kp=%.2f, Ki=%.3f, Kd=%.2f), keeping current\n", kp, ki, kd);
+        _lastAdapt = millis();
+        return;
+    }
+
+    logPrintf("Plant adapt: K=%.4fC/%%, tau=%.1fs -> Kp=%.2f, Ki=%.3f, Kd=%.2f\n",
+              model.gain, model.timeConstant, kp, ki, kd);
+
+    // setTunings() moves the proportional step out of the integral
+    setTunings(kp, ki, kd, true);
+    SettingsManager::getInstance().setThermalModel(model);
+    _estimator.setReference(model);
+    _mpc.configure(model);
+    _plantDrifted = false;
+    _lastAdapt = millis();
+}
+
+void PIDController::applyOutputLimits() {
+    if (_pid) {
+        _pid->SetOutputLimits(_minOutput - _feedForward, _maxOutput - _feedForward);
     }
 }
 
@@ -85,7 +256,11 @@ void PIDController::setTunings(float kp, float ki, float kd, bool saveToEeprom)
     _kd = kd;
 
     if (_pid) {
-        _pid->SetTunings(_kp, _ki, _kd);
+        loadTunings(_kp, _ki, _kd);
+    } else {
+        _appliedKp = _kp;
+        _appliedKi = _ki;
+        _appliedKd = _kd;
     }
 
     auto& settings = SettingsManager::getInstance();
@@ -96,45 +271,201 @@ void PIDController::setOutputLimits(float min, float max, bool saveToEeprom) {
     _minOutput = min;
     _maxOutput = max;
 
-    if (_pid) {
-        _pid->SetOutputLimits(_minOutput, _maxOutput);
-    }
+    applyOutputLimits();
 
     auto& settings = SettingsManager::getInstance();
     settings.setPIDOutputLimits(_minOutput, _maxOutput, saveToEeprom);
 }
 
+void PIDController::applySettings() {
+    auto& settings = SettingsManager::getInstance();
+    _kp = settings.getPIDKp();
+    _ki = settings.getPIDKi();
+    _kd = settings.getPIDKd();
+    _minOutput = settings.getPIDMinOutput();
+    _maxOutput = settings.getPIDMaxOutput();
+
+    if (!_pid) return;
+
+    _pid->SetTunings(_kp, _ki, _kd);
+    applyOutputLimits();
+    _appliedKp = _kp;
+    _appliedKi = _ki;
+    _appliedKd = _kd;
+
+    if (_mode == PID_ON && !_autoTuning) {
+        // Manual -> automatic makes QuickPID re-initialize the derivative from
+        // the current input. The integral is then seeded with the current
+        // output less the new proportional term, which the next Compute()
+        // adds back, so the new gains take over without a step.
+        _pid->SetMode(QuickPID::Control::manual);
+        _pid->SetMode(QuickPID::Control::automatic);
+        _pid->SetOutputSum(_output - _kp * proportionalError());
+    }
+
+    logPrintf("PID: applied Kp=%.2f, Ki=%.2f, Kd=%.2f, limits=%.0f-%.0f%%\n",
+              _kp, _ki, _kd, _minOutput, _maxOutput);
+}
+
+void PIDController::applyGainSchedule(float currentTemp, float setpoint) {
+    auto& settings = SettingsManager::getInstance();
+
+    float kp = _kp;
+    float ki = _ki;
+    float kd = _kd;
+    bool scheduled = false;
+
+    if (settings.getGainScheduleEnabled()) {
+        float x = (settings.getGainScheduleSource() == GS_SOURCE_MEASURED) ? currentTemp : setpoint;
+        scheduled = scheduledTunings(x, kp, ki, kd);
+    }
+    _scheduled = scheduled;
+
+    if (kp != _appliedKp || ki != _appliedKi || kd != _appliedKd) {
+        loadTunings(kp, ki, kd);
+    }
+}
+
+void PIDController::loadTunings(float kp, float ki, float kd) {
+    // The integral lives in QuickPID's output sum, but with proportional on
+    // error a new Kp steps the output by dKp * e at once: take that step out
+    // of the output sum so the total stays where it was
+    _pid->SetOutputSum(_pid->GetOutputSum() - (kp - _appliedKp) * proportionalError());
+    _pid->SetTunings(kp, ki, kd);
+    _appliedKp = kp;
+    _appliedKi = ki;
+    _appliedKd = kd;
+}
+
+bool PIDController::scheduledTunings(float x, float& kp, float& ki, float& kd) const {
+    auto& settings = SettingsManager::getInstance();
+
+    // Collect populated points sorted by temperature (insertion sort, at most 5)
+    GainSchedulePoint points[GAIN_SCHEDULE_POINTS];
+    int count = 0;
+    for (int i = 0; i < GAIN_SCHEDULE_POINTS; i++) {
+        GainSchedulePoint point;
+        if (!settings.getGainSchedulePoint(i, point)) continue;
+
+        int j = count++;
+        while (j > 0 && points[j - 1].temperature > point.temperature) {
+            points[j] = points[j - 1];
+            j--;
+        }
+        points[j] = point;
+    }
+
+    if (count == 0) return false;
+
+    // Hold the end points outside the table range
+    const GainSchedulePoint* lo = &points[0];
+    const GainSchedulePoint* hi = &points[0];
+    if (x >= points[count - 1].temperature) {
+        lo = hi = &points[count - 1];
+    } else if (x > points[0].temperature) {
+        for (int i = 1; i < count; i++) {
+            if (x <= points[i].temperature) {
+                lo = &points[i - 1];
+                hi = &points[i];
+                break;
+            }
+        }
+    }
+
+    // Linear interpolation between the neighbouring points
+    float span = hi->temperature - lo->temperature;
+    float t = (span > 0.01f) ? (x - lo->temperature) / span : 0.0f;
+    kp = lo->kp + t * (hi->kp - lo->kp);
+    ki = lo->ki + t * (hi->ki - lo->ki);
+    kd = lo->kd + t * (hi->kd - lo->kd);
+    return true;
+}
+
+void PIDController::storeScheduleEntry(float temperature, float kp, float ki, float kd) {
+    auto& settings = SettingsManager::getInstance();
+
+    // Replace a populated point near this temperature, else fill an empty
+    // slot, else overwrite the closest point
+    int index = -1;
+    int emptyIndex = -1;
+    int nearestIndex = 0;
+    float nearestDistance = 1000.0f;
+    for (int i = 0; i < GAIN_SCHEDULE_POINTS; i++) {
+        GainSchedulePoint point;
+        bool populated = settings.getGainSchedulePoint(i, point);
+        float distance = fabsf(point.temperature - temperature);
+
+        if (!populated) {
+            if (emptyIndex < 0) emptyIndex = i;
+            continue;
+        }
+        if (distance < nearestDistance) {
+            nearestDistance = distance;
+            nearestIndex = i;
+        }
+    }
+
+    if (nearestDistance <= SCHEDULE_MERGE_BAND_C) {
+        index = nearestIndex;
+    } else if (emptyIndex >= 0) {
+        index = emptyIndex;
+    } else {
+        index = nearestIndex;
+    }
+
+    GainSchedulePoint point = {temperature, kp, ki, kd};
+    settings.setGainSchedulePoint(index, point, false);  // Saved with the PID menu
+    logPrintf("Gain schedule: point %d set at %.1fC (Kp=%.2f, Ki=%.2f, Kd=%.2f)\n",
+              index, temperature, kp, ki, kd);
+}
+
 void PIDController::startAutoTune() {
     _autoTuning = true;
+    _mpcActive = false;
+    _identifying = false;
     _autoTuneComplete = false;
     _autoTuneStart = millis();
     _autoTuneCycles = 0;
-    _autoTunePeakHigh = -1000.0f;
-    _autoTunePeakLow = 1000.0f;
-    _autoTuneHigh = true;
-    _autoTuneOutput = _maxOutput;  // Start with cooling on
-    _autoTuneLastCross = millis();
-    _autoTunePeriodSum = 0.0f;
-    _autoTuneAmplitudeSum = 0.0f;
+    _autoTuneConfidence = 0.0f;
+    _autoTunePeakHigh = _input;
+    _autoTunePeakLow = _input;
+    _autoTuneHigh = true;  // Start with cooling on
+    _autoTuneCycleStart = 0;
+    _autoTuneLastSwitch = millis();
+    _autoTuneHighTime = 0;
+    _autoTuneNoiseBand = SettingsManager::getInstance().getAutoTuneNoiseBand();
+
+    // Symmetric relay around the middle of the output range to begin with;
+    // the bias is adapted each cycle until both half-periods match
+    _autoTuneBias = (_minOutput + _maxOutput) / 2.0f;
+    _autoTuneAmplitude = (_maxOutput - _minOutput) / 2.0f;
 
     // Save original setpoint and set temporary one 3°F (~1.7°C) below current temp
     _savedSetpoint = _setpoint;
     float offset = 3.0f / 1.8f;  // 3°F in Celsius
     _setpoint = _input - offset;
 
+    // The relay drives raw output - no feed-forward offset during the test
+    _feedForward = 0.0f;
+    _ff.resetSteadyState();
+    _estimator.pause();
+
     if (_pid) {
         _pid->SetMode(QuickPID::Control::manual);
+        applyOutputLimits();
     }
 
     float inputF = _input * 9.0f / 5.0f + 32.0f;
     float setpointF = _setpoint * 9.0f / 5.0f + 32.0f;
     float savedF = _savedSetpoint * 9.0f / 5.0f + 32.0f;
-    logPrintf("Auto-tune started: current=%.1fF, temp setpoint=%.1fF (original=%.1fF)\n",
-              inputF, setpointF, savedF);
+    logPrintf("Auto-tune started: current=%.1fF, temp setpoint=%.1fF (original=%.1fF), noise band=%.2fC\n",
+              inputF, setpointF, savedF, _autoTuneNoiseBand);
 }
 
 void PIDController::stopAutoTune() {
     _autoTuning = false;
+    _identifying = false;
+    _identifier.cancel();
     _output = 0.0f;
 
     // Restore original setpoint
@@ -156,6 +487,88 @@ bool PIDController::checkAndClearAutoTuneComplete() {
     return false;
 }
 
+void PIDController::startIdentification() {
+    if (_autoTuning) return;
+
+    // Start from the current operating point so the step is all that changes
+    float baseOutput = getOutput() * 100.0f;
+
+    _mode = PID_AUTOTUNE;
+    SettingsManager::getInstance().setPIDMode(PID_AUTOTUNE, false);
+    _autoTuning = true;
+    _mpcActive = false;
+    _identifying = true;
+    _autoTuneComplete = false;
+    _autoTuneStart = millis();
+    _savedSetpoint = _setpoint;
+
+    _feedForward = 0.0f;
+    _ff.resetSteadyState();
+    _estimator.pause();
+    if (_pid) {
+        _pid->SetMode(QuickPID::Control::manual);
+        applyOutputLimits();
+    }
+
+    _identifier.start(_input, baseOutput, _minOutput, _maxOutput);
+}
+
+void PIDController::runIdentification() {
+    _output = _identifier.update(_input);
+
+    if (_identifier.getState() == StepIdentifier::FAILED) {
+        logPrintf("Identification failed: %s\n", _identifier.getError());
+        stopAutoTune();
+        return;
+    }
+
+    if (_identifier.getState() != StepIdentifier::DONE) return;
+
+    // Keep the model for feed-forward/MPC and derive IMC tunings from it
+    const FopdtModel& model = _identifier.getModel();
+    SettingsManager::getInstance().setThermalModel(model);
+    _ff.seedFromModel(model);
+    _estimator.setReference(model);
+    _plantDrifted = false;
+    _mpc.configure(model);
+
+    float kp, ki, kd;
+    imcPidTunings(model, MODEL_LAMBDA_FACTOR * model.timeConstant, kp, ki, kd);
+    logPrintf("Identification complete after %lus: IMC Kp=%.2f, Ki=%.3f, Kd=%.2f\n",
+              (millis() - _autoTuneStart) / 1000, kp, ki, kd);
+
+    // Clamp to reasonable ranges to prevent NaN/Inf issues
+    if (kp < 0.0f || kp > 50.0f || isnan(kp) || isinf(kp)) kp = 2.0f;
+    if (ki < 0.0f || ki > 10.0f || isnan(ki) || isinf(ki)) ki = 0.1f;
+    if (kd < 0.0f || kd > 50.0f || isnan(kd) || isinf(kd)) kd = 1.0f;
+
+    _identifying = false;
+    finishAutoTune(kp, ki, kd);
+}
+
+void PIDController::finishAutoTune(float kp, float ki, float kd) {
+    // Apply new tunings (don't save yet - user will save from menu)
+    setTunings(kp, ki, kd, false);
+
+    // With gain scheduling on, the result also becomes the table entry for
+    // the temperature it was tuned at
+    if (SettingsManager::getInstance().getGainScheduleEnabled()) {
+        storeScheduleEntry(_setpoint, kp, ki, kd);
+    }
+
+    _autoTuning = false;
+    _autoTuneComplete = true;
+    _setpoint = _savedSetpoint;  // Restore original setpoint
+    _mode = PID_ON;
+    SettingsManager::getInstance().setPIDMode(PID_ON, false);
+
+    logPrintf("Restored setpoint=%.1fC\n", _setpoint);
+
+    if (_pid) {
+        _pid->SetMode(QuickPID::Control::automatic);
+    }
+}
+
 void PIDController::runAutoTune() {
     // Debug mode: fake auto-tune completes after 3 seconds with test values
     if (DEBUG_FAKE_AUTOTUNE) {
@@ -166,133 +579,135 @@ void PIDController::runAutoTune() {
 
         if (millis() - fakeStart > 3000) {
             // Simulate completion with reasonable PID values
-            float newKp = 5.0f;
-            float newKi = 0.5f;
-            float newKd = 2.0f;
-
-            logPrintf("Fake auto-tune complete: Kp=%.2f, Ki=%.2f, Kd=%.2f\n", newKp, newKi, newKd);
-
-            setTunings(newKp, newKi, newKd, false);
-            _autoTuning = false;
-            _autoTuneComplete = true;
-            _setpoint = _savedSetpoint;
-            _mode = PID_ON;
-            SettingsManager::getInstance().setPIDMode(PID_ON, false);
-
-            if (_pid) {
-                _pid->SetMode(QuickPID::Control::automatic);
-            }
+            logPrintf("Fake auto-tune complete: Kp=5.00, Ki=0.50, Kd=2.00\n");
+            finishAutoTune(5.0f, 0.5f, 2.0f);
             fakeStart = 0;  // Reset for next time
         }
         return;
     }
 
-    // Relay auto-tune (bang-bang oscillation method)
-    // Oscillate between min and max output, measure response
+    // Relay auto-tune with hysteresis: switch to cooling above setpoint + band,
+    // to heating below setpoint - band, so sensor noise can't chatter the relay
+    unsigned long now = millis();
 
     // Debug output every 5 seconds
     static unsigned long lastDebug = 0;
-    if (millis() - lastDebug > 5000) {
+    if (now - lastDebug > 5000) {
         float inputF = _input * 9.0f / 5.0f + 32.0f;
         float setpointF = _setpoint * 9.0f / 5.0f + 32.0f;
-        float peakHighF = _autoTunePeakHigh * 9.0f / 5.0f + 32.0f;
-        float peakLowF = _autoTunePeakLow * 9.0f / 5.0f + 32.0f;
-        logPrintf("AutoTune: temp=%.1fF, target=%.1fF, %s, power=%.0f%%, cycles=%d\n",
-                  inputF, setpointF, _autoTuneHigh ? "COOLING" : "HEATING", _output, _autoTuneCycles / 2);
-        logPrintf("  peaks: high=%.1fF, low=%.1fF, swing=%.1fF\n",
-                  peakHighF, peakLowF, peakHighF - peakLowF);
-        lastDebug = millis();
+        logPrintf("AutoTune: temp=%.1fF, target=%.1fF, %s, power=%.0f%%, cycles=%d, confidence=%.0f%%\n",
+                  inputF, setpointF, _autoTuneHigh ? "COOLING" : "HEATING", _output,
+                  _autoTuneCycles, _autoTuneConfidence * 100.0f);
+        lastDebug = now;
     }
 
-    // Track peaks
+    // Track peaks over the current cycle
     if (_input > _autoTunePeakHigh) _autoTunePeakHigh = _input;
     if (_input < _autoTunePeakLow) _autoTunePeakLow = _input;
 
-    // Check for zero crossing (temperature crosses setpoint)
-    bool shouldSwitch = false;
-    if (_autoTuneHigh && _input < _setpoint) {
-        // Was cooling, now below setpoint
-        float inputF = _input * 9.0f / 5.0f + 32.0f;
-        float setpointF = _setpoint * 9.0f / 5.0f + 32.0f;
-        logPrintf("AutoTune: CROSSING! %.1fF < %.1fF, switching to HEATING\n", inputF, setpointF);
-        shouldSwitch = true;
-    } else if (!_autoTuneHigh && _input > _setpoint) {
-        // Was off, now above setpoint
-        float inputF = _input * 9.0f / 5.0f + 32.0f;
-        float setpointF = _setpoint * 9.0f / 5.0f + 32.0f;
-        logPrintf("AutoTune: CROSSING! %.1fF > %.1fF, switching to COOLING\n", inputF, setpointF);
-        shouldSwitch = true;
-    }
-
-    if (shouldSwitch) {
-        unsigned long now = millis();
-        unsigned long period = now - _autoTuneLastCross;
-
-        _autoTuneCycles++;
-
-        if (_autoTuneCycles > 1 && period > 1000) {  // Ignore first crossing and short periods
-            _autoTunePeriodSum += period;
-            _autoTuneAmplitudeSum += (_autoTunePeakHigh - _autoTunePeakLow);
-
-            logPrintf("Auto-tune: cycle %d/5, period=%.1fs, swing=%.1fF\n",
-                      _autoTuneCycles / 2, period / 1000.0f,
-                      (_autoTunePeakHigh - _autoTunePeakLow) * 9.0f / 5.0f);
+    if (_autoTuneHigh && _input < _setpoint - _autoTuneNoiseBand) {
+        // End of the cooling half-cycle
+        _autoTuneHighTime = now - _autoTuneLastSwitch;
+        _autoTuneLastSwitch = now;
+        _autoTuneHigh = false;
+    } else if (!_autoTuneHigh && _input > _setpoint + _autoTuneNoiseBand) {
+        // End of the heating half-cycle = end of a full cycle. The first one
+        // started from an arbitrary state and is only used to sync up.
+        unsigned long lowTime = now - _autoTuneLastSwitch;
+        if (_autoTuneCycleStart != 0 && _autoTuneHighTime > 0) {
+            recordAutoTuneCycle(now - _autoTuneCycleStart, _autoTuneHighTime, lowTime);
+            if (!_autoTuning) return;  // Converged and finished
         }
-        _autoTuneLastCross = now;
+
+        _autoTuneCycleStart = now;
+        _autoTuneLastSwitch = now;
+        _autoTuneHigh = true;
         _autoTunePeakHigh = _input;
         _autoTunePeakLow = _input;
-        _autoTuneHigh = !_autoTuneHigh;
     }
 
-    // Set output based on current state
-    _output = _autoTuneHigh ? _maxOutput : _minOutput;
+    // Biased relay output
+    _output = _autoTuneHigh ? _autoTuneBias + _autoTuneAmplitude : _autoTuneBias - _autoTuneAmplitude;
 
-    // Check if we have enough cycles
-    if (_autoTuneCycles >= AUTOTUNE_CYCLES * 2) {  // *2 because we count half-cycles
-        // Calculate tuning parameters using Ziegler-Nichols
-        float avgPeriod = _autoTunePeriodSum / (AUTOTUNE_CYCLES - 1);  // ms
-        float avgAmplitude = _autoTuneAmplitudeSum / (AUTOTUNE_CYCLES - 1);  // degrees
+    // Timeout after 10 minutes
+    if (now - _autoTuneStart > AUTOTUNE_TIMEOUT_MS) {
+        logPrintf("Auto-tune timeout\n");
+        stopAutoTune();
+    }
+}
 
-        // Protect against divide by zero
-        if (avgAmplitude < 0.01f) avgAmplitude = 0.01f;
-        if (avgPeriod < 100.0f) avgPeriod = 100.0f;
+void PIDController::recordAutoTuneCycle(unsigned long periodMs, unsigned long highMs, unsigned long lowMs) {
+    // Describing-function estimate for a relay with hysteresis:
+    // Ku = 4d / (pi * sqrt(a^2 - eps^2)), a = half the peak-to-peak swing
+    float a = (_autoTunePeakHigh - _autoTunePeakLow) / 2.0f;
+    float a2 = a * a - _autoTuneNoiseBand * _autoTuneNoiseBand;
+    if (a2 < 0.01f * a * a) a2 = 0.01f * a * a;  // Swing barely exceeds the band
+    if (a2 < 1e-6f) a2 = 1e-6f;
+
+    float ku = 4.0f * _autoTuneAmplitude / (3.14159f * sqrtf(a2));
+    float tu = periodMs / 1000.0f;
+
+    _autoTuneKu[_autoTuneCycles % AUTOTUNE_WINDOW] = ku;
+    _autoTuneTu[_autoTuneCycles % AUTOTUNE_WINDOW] = tu;
+    _autoTuneCycles++;
+
+    // Relay asymmetry: a TEC cools and warms at different rates, so shift the
+    // relay centre until both half-periods match (longer cooling = more bias)
+    float asymmetry = (static_cast<float>(highMs) - lowMs) / (highMs + lowMs);
+    float range = _maxOutput - _minOutput;
+    _autoTuneBias += 0.5f * _autoTuneAmplitude * asymmetry;
+    if (_autoTuneBias < _minOutput + 0.1f * range) _autoTuneBias = _minOutput + 0.1f * range;
+    if (_autoTuneBias > _maxOutput - 0.1f * range) _autoTuneBias = _maxOutput - 0.1f * range;
+    _autoTuneAmplitude = fminf(_autoTuneBias - _minOutput, _maxOutput - _autoTuneBias);
+
+    logPrintf("Auto-tune: cycle %d, Tu=%.1fs, Ku=%.2f, swing=%.2fC, asym=%.2f -> bias=%.0f%%+/-%.0f%%\n",
+              _autoTuneCycles, tu, ku, 2.0f * a, asymmetry, _autoTuneBias, _autoTuneAmplitude);
+
+    // Confidence from the spread of the last AUTOTUNE_WINDOW estimates
+    int n = (_autoTuneCycles < AUTOTUNE_WINDOW) ? _autoTuneCycles : AUTOTUNE_WINDOW;
+    float kuMean = 0.0f, tuMean = 0.0f;
+    for (int i = 0; i < n; i++) {
+        kuMean += _autoTuneKu[i];
+        tuMean += _autoTuneTu[i];
+    }
+    kuMean /= n;
+    tuMean /= n;
 
-        float Tu = avgPeriod / 1000.0f;  // Ultimate period in seconds
-        float Ku = (4.0f * (_maxOutput - _minOutput)) / (3.14159f * avgAmplitude);  // Ultimate gain
+    float spread = 0.0f;
+    for (int i = 0; i < n; i++) {
+        spread = fmaxf(spread, fabsf(_autoTuneKu[i] - kuMean) / kuMean);
+        spread = fmaxf(spread, fabsf(_autoTuneTu[i] - tuMean) / tuMean);
+    }
 
-        // Conservative thermal system tuning
-        // Based on "No Overshoot" but with reduced D term for noisy temp sensors
-        float newKp = 0.2f * Ku;
-        float newKi = 0.4f * Ku / Tu;
-        float newKd = newKp * 0.25f;  // D = 25% of P (thermal-friendly ratio)
+    bool balanced = fabsf(asymmetry) <= AUTOTUNE_MAX_ASYMMETRY;
+    _autoTuneConfidence = (n < AUTOTUNE_WINDOW) ? 0.0f : fmaxf(0.0f, 1.0f - spread / (4.0f * AUTOTUNE_SPREAD));
+    if (!balanced) _autoTuneConfidence *= 0.5f;
 
-        logPrintf("Auto-tune complete: Tu=%.2fs, Ku=%.2f\n", Tu, Ku);
-        logPrintf("Calculated (No Overshoot): Kp=%.2f, Ki=%.2f, Kd=%.2f\n", newKp, newKi, newKd);
+    bool converged = n >= AUTOTUNE_WINDOW && balanced && spread <= AUTOTUNE_SPREAD;
+    if (!converged && _autoTuneCycles < AUTOTUNE_MAX_CYCLES) return;
 
-        // Clamp to reasonable ranges to prevent NaN/Inf issues
-        if (newKp < 0.0f || newKp > 50.0f || isnan(newKp) || isinf(newKp)) newKp = 2.0f;
-        if (newKi < 0.0f || newKi > 10.0f || isnan(newKi) || isinf(newKi)) newKi = 0.1f;
-        if (newKd < 0.0f || newKd > 50.0f || isnan(newKd) || isinf(newKd)) newKd = 1.0f;
+    if (!converged) {
+        logPrintf("Auto-tune: no convergence after %d cycles (spread=%.0f%%), using averages\n",
+                  _autoTuneCycles, spread * 100.0f);
+    }
 
-        // Apply new tunings (don't save yet - user will save from menu)
-        setTunings(newKp, newKi, newKd, false);
+    // Protect against divide by zero
+    if (tuMean < 0.1f) tuMean = 0.1f;
 
-        _autoTuning = false;
-        _autoTuneComplete = true;
-        _setpoint = _savedSetpoint;  // Restore original setpoint
-        _mode = PID_ON;
-        SettingsManager::getInstance().setPIDMode(PID_ON, false);
+    // Conservative thermal system tuning
+    // Based on "No Overshoot" but with reduced D term for noisy temp sensors
+    float newKp = 0.2f * kuMean;
+    float newKi = 0.4f * kuMean / tuMean;
+    float newKd = newKp * 0.25f;  // D = 25% of P (thermal-friendly ratio)
 
-        logPrintf("Restored setpoint=%.1fC\n", _setpoint);
+    logPrintf("Auto-tune complete after %d cycles (%lus): Tu=%.2fs, Ku=%.2f, confidence=%.0f%%\n",
+              _autoTuneCycles, (millis() - _autoTuneStart) / 1000, tuMean, kuMean, _autoTuneConfidence * 100.0f);
+    logPrintf("Calculated (No Overshoot): Kp=%.2f, Ki=%.2f, Kd=%.2f\n", newKp, newKi, newKd);
 
-        if (_pid) {
-            _pid->SetMode(QuickPID::Control::automatic);
-        }
-    }
+    // Clamp to reasonable ranges to prevent NaN/Inf issues
+    if (newKp < 0.0f || newKp > 50.0f || isnan(newKp) || isinf(newKp)) newKp = 2.0f;
+    if (newKi < 0.0f || newKi > 10.0f || isnan(newKi) || isinf(newKi)) newKi = 0.1f;
+    if (newKd < 0.0f || newKd > 50.0f || isnan(newKd) || isinf(newKd)) newKd = 1.0f;
 
-    // Timeout after 10 minutes
-    if (millis() - _autoTuneStart > 600000) {
-        logPrintf("Auto-tune timeout\n");
-        stopAutoTune();
-    }
+    finishAutoTune(newKp, newKi, newKd);
 }
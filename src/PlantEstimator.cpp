@@ -0,0 +1,132 @@
+#include "PlantEstimator.h"
+#include <Arduino.h>
+
+void PlantEstimator::begin(const FopdtModel& reference) {
+    setReference(reference);
+    resetCovariance();
+    _updates = 0;
+    _uHead = 0;
+    _uCount = 0;
+    _haveLast = false;
+    _drift = 0.0f;
+}
+
+void PlantEstimator::setReference(const FopdtModel& reference) {
+    _reference = reference;
+
+    // Drift divides by K and tau: a stored model with either at zero (or not
+    // finite) would turn it into inf/NaN and never flag drift, so treat it as
+    // no reference and let the next converged estimate take its place
+    if (_reference.valid &&
+        (!isfinite(_reference.gain) || fabsf(_reference.gain) < MIN_REFERENCE_GAIN ||
+         !isfinite(_reference.timeConstant) || _reference.timeConstant <= 0.0f)) {
+        _reference.valid = false;
+    }
+
+    int delay = DEFAULT_DELAY_S;
+    if (_reference.valid) {
+        delay = static_cast<int>(_reference.deadTime * 1000.0f / SAMPLE_MS + 0.5f);
+    }
+    if (delay >= MAX_DELAY) delay = MAX_DELAY - 1;
+    if (delay != _delay) {
+        // Different regressor alignment - the old estimate no longer applies
+        _delay = delay;
+        resetCovariance();
+        _updates = 0;
+    }
+    _drift = 0.0f;
+}
+
+void PlantEstimator::resetCovariance() {
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            _P[i][j] = (i == j) ? P_INITIAL : 0.0f;
+        }
+    }
+}
+
+bool PlantEstimator::hasEstimate() const {
+    if (_updates < MIN_UPDATES) return false;
+
+    // Must be a stable, cooling (negative gain) first-order response
+    float a = _theta[0];
+    float b = _theta[1];
+    return a > 0.0f && a < 0.9999f && b < 0.0f;
+}
+
+FopdtModel PlantEstimator::getEstimate() const {
+    FopdtModel model;
+    model.valid = hasEstimate();
+    if (!model.valid) {
+        model.gain = model.timeConstant = model.deadTime = 0.0f;
+        return model;
+    }
+
+    float ts = SAMPLE_MS / 1000.0f;
+    model.gain = _theta[1] / (1.0f - _theta[0]);
+    model.timeConstant = -ts / logf(_theta[0]);
+    model.deadTime = _delay * ts;
+    return model;
+}
+
+void PlantEstimator::update(float temperature, float output) {
+    unsigned long now = millis();
+    if (_haveLast && now - _lastSample < SAMPLE_MS) return;
+    _lastSample = now;
+
+    // Output history, newest at _uHead
+    _uHead = (_uHead + 1) % MAX_DELAY;
+    _uHistory[_uHead] = output;
+    if (_uCount < MAX_DELAY) _uCount++;
+
+    if (!_haveLast || _uCount <= _delay + 1) {
+        _lastT = temperature;
+        _haveLast = true;
+        return;
+    }
+
+    // Regressors for the transition _lastT -> temperature: u[k - d], where
+    // k is the previous sample (one slot back from the newest)
+    int index = (_uHead - 1 - _delay + 2 * MAX_DELAY) % MAX_DELAY;
+    float x[3] = {_lastT, _uHistory[index], 1.0f};
+
+    float Px[3];
+    for (int i = 0; i < 3; i++) {
+        Px[i] = _P[i][0] * x[0] + _P[i][1] * x[1] + _P[i][2] * x[2];
+    }
+    float denom = FORGETTING + x[0] * Px[0] + x[1] * Px[1] + x[2] * Px[2];
+    float error = temperature - (_theta[0] * x[0] + _theta[1] * x[1] + _theta[2] * x[2]);
+
+    float trace = 0.0f;
+    for (int i = 0; i < 3; i++) {
+        float k = Px[i] / denom;
+        _theta[i] += k * error;
+        for (int j = 0; j < 3; j++) {
+            _P[i][j] = (_P[i][j] - k * Px[j]) / FORGETTING;
+        }
+        trace += _P[i][i];
+    }
+
+    // Steady operation excites nothing, and forgetting then inflates P;
+    // cap it so the first disturbance after a quiet hour can't swing the fit
+    if (trace > P_MAX_TRACE) {
+        float scale = P_MAX_TRACE / trace;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                _P[i][j] *= scale;
+            }
+        }
+    }
+
+    _lastT = temperature;
+    _updates++;
+
+    // Relative deviation from the reference model, low-pass filtered
+    if (_reference.valid && hasEstimate()) {
+        FopdtModel estimate = getEstimate();
+        float gainDev = fabsf(estimate.gain / _reference.gain - 1.0f);
+        float tauDev = fabsf(estimate.timeConstant / _reference.timeConstant - 1.0f);
+        float deviation = (gainDev > tauDev) ? gainDev : tauDev;
+        _drift += DRIFT_FILTER * (deviation - _drift);
+    }
+}
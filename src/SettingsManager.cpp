@@ -1,161 +1,723 @@
 #include "SettingsManager.h"
+#include "Crc32.h"
+#include <Arduino.h>
 #include <EEPROM.h>
 
+extern void logPrintf(const char* format, ...);
+
+// NVS keys for the two record slots
+static const char* const SLOT_KEYS[2] = {"slot0", "slot1"};
+
 SettingsManager& SettingsManager::getInstance() {
     static SettingsManager instance;
     return instance;
 }
 
 void SettingsManager::begin() {
-    EEPROM.begin(EEPROM_SIZE);
+    _prefs.begin(NVS_NAMESPACE, false);
     load();
 }
 
+void SettingsManager::update() {
+    if (!_savePending) return;
+
+    // Write-behind: commit once the user stops turning the encoder, but never
+    // hold a requested save back longer than SAVE_MAX_DELAY_MS
+    unsigned long now = millis();
+    if (now - _lastSaveRequest >= SAVE_QUIET_MS || now - _firstSaveRequest >= SAVE_MAX_DELAY_MS) {
+        commit();
+    }
+}
+
 void SettingsManager::save() {
-    EEPROM.write(EEPROM_ADDR_TEMP_UNIT, static_cast<uint8_t>(_tempUnit));
-    EEPROM.put(EEPROM_ADDR_SETPOINT, _setpoint);
-    EEPROM.write(EEPROM_ADDR_PID_MODE, static_cast<uint8_t>(_pidMode));
-    EEPROM.put(EEPROM_ADDR_PID_KP, _pidKp);
-    EEPROM.put(EEPROM_ADDR_PID_KI, _pidKi);
-    EEPROM.put(EEPROM_ADDR_PID_KD, _pidKd);
-    EEPROM.put(EEPROM_ADDR_PID_MIN, _pidMinOutput);
-    EEPROM.put(EEPROM_ADDR_PID_MAX, _pidMaxOutput);
-    EEPROM.put(EEPROM_ADDR_FAN_SPEED, _fanSpeed);
-    EEPROM.write(EEPROM_ADDR_SMART_ENABLED, _smartControlEnabled ? 1 : 0);
-    EEPROM.put(EEPROM_ADDR_SMART_SETPOINT, _smartSetpoint);
-    EEPROM.commit();
+    unsigned long now = millis();
+    _saveRequests++;
+    if (!_savePending) {
+        _savePending = true;
+        _firstSaveRequest = now;
+    }
+    _lastSaveRequest = now;
+}
+
+void SettingsManager::flush() {
+    // Also fields set with saveNow=false that no save() has picked up yet
+    if (_savePending || isDirty()) {
+        commit();
+    }
+}
+
+void SettingsManager::commit() {
+    _savePending = false;
+
+    // Nothing changed since the last commit - skip the flash write entirely
+    if (_dirtyFields == 0 && !_profilesDirty) return;
+
+    storeActiveProfile();
+
+    static constexpr uint16_t PROFILES_OFFSET = SETTINGS_HEADER_SIZE + SETTINGS_PAYLOAD_SIZE;
+    static constexpr uint16_t RECORD_SIZE = PROFILES_OFFSET + SETTINGS_PROFILE_BLOCK_SIZE + SETTINGS_CRC_SIZE;
+    uint8_t record[RECORD_SIZE];
+    uint32_t magic = RECORD_MAGIC;
+    uint16_t version = RECORD_VERSION;
+    uint16_t payloadSize = SETTINGS_PAYLOAD_SIZE;
+    uint32_t generation = _generation + 1;
+    memcpy(record, &magic, 4);
+    memcpy(record + 4, &version, 2);
+    memcpy(record + 6, &payloadSize, 2);
+    memcpy(record + 8, &generation, 4);
+    encodePayload(_values, record + SETTINGS_HEADER_SIZE);
+    encodeProfiles(_profiles, record + PROFILES_OFFSET);
+    uint32_t crc = crc32(record, RECORD_SIZE - SETTINGS_CRC_SIZE);
+    memcpy(record + RECORD_SIZE - SETTINGS_CRC_SIZE, &crc, 4);
+
+    // Write to the slot NOT holding the newest record, so a power cut
+    // mid-write always leaves the previous generation intact
+    uint8_t slot = _activeSlot ^ 1;
+    unsigned long start = micros();
+    if (_prefs.putBytes(SLOT_KEYS[slot], record, RECORD_SIZE) != RECORD_SIZE) {
+        logPrintf("Settings: write to %s failed\n", SLOT_KEYS[slot]);
+        return;  // Stay dirty so the next save() retries
+    }
+
+    _activeSlot = slot;
+    _generation = generation;
+    _dirtyFields = 0;
+    _profilesDirty = false;
+    _commitCount++;
+
+    logPrintf("Settings: committed gen %lu in %luus (%lu saves, %lu commits avoided)\n",
+              static_cast<unsigned long>(_generation), micros() - start,
+              static_cast<unsigned long>(_saveRequests),
+              static_cast<unsigned long>(getCommitsAvoided()));
 }
 
 void SettingsManager::load() {
-    uint8_t storedUnit = EEPROM.read(EEPROM_ADDR_TEMP_UNIT);
-    if (storedUnit == CELSIUS || storedUnit == FAHRENHEIT) {
-        _tempUnit = static_cast<TempUnit>(storedUnit);
-    } else {
-        _tempUnit = CELSIUS;
+    float values[2][SETTING_COUNT];
+    Profile profiles[2][SETTINGS_PROFILE_COUNT];
+    uint32_t generations[2] = {0, 0};
+    bool valid[2] = {readSlot(0, values[0], profiles[0], generations[0]),
+                     readSlot(1, values[1], profiles[1], generations[1])};
+
+    if (valid[0] || valid[1]) {
+        // Pick the newest valid generation (wrap-safe comparison)
+        uint8_t slot;
+        if (valid[0] && valid[1]) {
+            slot = (static_cast<int32_t>(generations[1] - generations[0]) > 0) ? 1 : 0;
+        } else {
+            slot = valid[0] ? 0 : 1;
+        }
+
+        sanitize(values[slot]);
+        sanitizeProfiles(profiles[slot]);
+        memcpy(_values, values[slot], sizeof(_values));
+        memcpy(_profiles, profiles[slot], sizeof(_profiles));
+
+        // The active profile is authoritative for the per-profile fields
+        const Profile& active = _profiles[getActiveProfile()];
+        for (int i = 0; i < PROFILE_FIELD_COUNT; i++) {
+            _values[PROFILE_FIELDS[i]] = active.values[i];
+        }
+
+        _activeSlot = slot;
+        _generation = generations[slot];
+        _dirtyFields = 0;
+        _profilesDirty = false;
+        return;
+    }
+
+    // No valid record yet - migrate from the legacy EEPROM layout once
+    loadDefaults();
+    if (loadLegacyEeprom(_values)) {
+        logPrintf("Settings: migrated legacy EEPROM settings\n");
+    }
+    sanitize(_values);
+    initProfiles(_values, _profiles);
+    _dirtyFields = ~0ull >> (64 - SETTING_COUNT);  // All fields (no UB at 64)
+    _profilesDirty = true;
+    commit();
+}
+
+void SettingsManager::loadDefaults() {
+    for (int id = 0; id < SETTING_COUNT; id++) {
+        _values[id] = SETTINGS_FIELDS[id].defaultValue;
+    }
+}
+
+bool SettingsManager::setValue(SettingsFieldId id, float value) {
+    const SettingsFieldDef& field = SETTINGS_FIELDS[id];
+    if (isnan(value)) return false;
+    if (value < field.minValue) value = field.minValue;
+    if (value > field.maxValue) value = field.maxValue;
+
+    if (_values[id] == value) return false;
+    _values[id] = value;
+    _dirtyFields |= (1ull << id);
+    return true;
+}
+
+bool SettingsManager::readSlot(uint8_t slot, float* values, Profile* profiles, uint32_t& generation) {
+    uint8_t record[SETTINGS_MAX_RECORD_SIZE];
+    size_t len = _prefs.getBytesLength(SLOT_KEYS[slot]);
+    if (len < SETTINGS_HEADER_SIZE + SETTINGS_CRC_SIZE || len > sizeof(record)) return false;
+    if (_prefs.getBytes(SLOT_KEYS[slot], record, len) != len) return false;
+
+    uint32_t magic, crc;
+    uint16_t version, size;
+    memcpy(&magic, record, 4);
+    memcpy(&version, record + 4, 2);
+    memcpy(&size, record + 6, 2);
+    memcpy(&generation, record + 8, 4);
+    memcpy(&crc, record + len - SETTINGS_CRC_SIZE, 4);
+
+    if (magic != RECORD_MAGIC) return false;
+    if (crc != crc32(record, len - SETTINGS_CRC_SIZE)) return false;
+
+    // Start from defaults so fields missing from older records stay valid
+    for (int id = 0; id < SETTING_COUNT; id++) {
+        values[id] = SETTINGS_FIELDS[id].defaultValue;
+    }
+
+    switch (version) {
+        case RECORD_VERSION: {
+            // 'size' is the global payload size; the profile block fills the rest
+            size_t profilesOffset = SETTINGS_HEADER_SIZE + size;
+            if (profilesOffset + 2 + SETTINGS_CRC_SIZE > len) return false;
+            decodePayload(record + SETTINGS_HEADER_SIZE, size, values);
+            initProfiles(values, profiles);
+            return decodeProfiles(record + profilesOffset, len - profilesOffset - SETTINGS_CRC_SIZE, profiles);
+        }
+
+        case 2:
+            // v2: no profiles yet - every profile starts as a copy of the settings
+            if (static_cast<size_t>(SETTINGS_HEADER_SIZE + size + SETTINGS_CRC_SIZE) != len) return false;
+            decodePayload(record + SETTINGS_HEADER_SIZE, size, values);
+            initProfiles(values, profiles);
+            return true;
+
+        case 1:
+            // v1 fixed struct: 'size' is the total record size
+            if (size != len || len != LEGACY_V1_RECORD_SIZE) return false;
+            decodeLegacy(record, LEGACY_V1_LAYOUT, LEGACY_V1_FIELD_COUNT, values);
+            initProfiles(values, profiles);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool SettingsManager::loadLegacyEeprom(float* values) {
+    if (!EEPROM.begin(LEGACY_EEPROM_SIZE)) return false;
+
+    uint8_t image[LEGACY_EEPROM_SIZE];
+    for (int i = 0; i < LEGACY_EEPROM_SIZE; i++) {
+        image[i] = EEPROM.read(i);
+    }
+    EEPROM.end();
+
+    decodeLegacy(image, LEGACY_EEPROM_LAYOUT, LEGACY_EEPROM_FIELD_COUNT, values);
+    return true;
+}
+
+void SettingsManager::decodePayload(const uint8_t* payload, uint16_t size, float* values) {
+    for (int id = 0; id < SETTING_COUNT; id++) {
+        uint16_t offset = settingsFieldOffset(id);
+        if (offset + settingsFieldSize(SETTINGS_FIELDS[id].type) > size) break;
+
+        if (SETTINGS_FIELDS[id].type == FIELD_FLOAT) {
+            memcpy(&values[id], payload + offset, 4);
+        } else {
+            values[id] = payload[offset];
+        }
+    }
+}
+
+void SettingsManager::encodePayload(const float* values, uint8_t* payload) {
+    for (int id = 0; id < SETTING_COUNT; id++) {
+        uint16_t offset = settingsFieldOffset(id);
+        if (SETTINGS_FIELDS[id].type == FIELD_FLOAT) {
+            memcpy(payload + offset, &values[id], 4);
+        } else {
+            payload[offset] = static_cast<uint8_t>(values[id]);
+        }
+    }
+}
+
+void SettingsManager::decodeLegacy(const uint8_t* image, const LegacyFieldDef* layout, int count, float* values) {
+    for (int i = 0; i < count; i++) {
+        if (layout[i].type == FIELD_FLOAT) {
+            memcpy(&values[layout[i].id], image + layout[i].offset, 4);
+        } else {
+            values[layout[i].id] = image[layout[i].offset];
+        }
+    }
+}
+
+bool SettingsManager::decodeProfiles(const uint8_t* block, uint16_t size, Profile* profiles) {
+    uint8_t count = block[0];
+    uint8_t stride = block[1];
+    if (2 + count * stride != size || stride < SETTINGS_PROFILE_NAME_LEN) return false;
+
+    // Extra profiles from a larger table are dropped; newer fields than the
+    // writer knew keep the values from initProfiles()
+    for (int p = 0; p < count && p < SETTINGS_PROFILE_COUNT; p++) {
+        const uint8_t* entry = block + 2 + p * stride;
+        memcpy(profiles[p].name, entry, SETTINGS_PROFILE_NAME_LEN);
+        profiles[p].name[SETTINGS_PROFILE_NAME_LEN - 1] = '\0';
+
+        for (int i = 0; i < PROFILE_FIELD_COUNT; i++) {
+            uint16_t offset = profileFieldOffset(i);
+            SettingsFieldType type = SETTINGS_FIELDS[PROFILE_FIELDS[i]].type;
+            if (offset + settingsFieldSize(type) > stride) break;
+
+            if (type == FIELD_FLOAT) {
+                memcpy(&profiles[p].values[i], entry + offset, 4);
+            } else {
+                profiles[p].values[i] = entry[offset];
+            }
+        }
     }
+    return true;
+}
 
-    EEPROM.get(EEPROM_ADDR_SETPOINT, _setpoint);
-    // Validate setpoint (check for NaN or unreasonable values)
-    if (isnan(_setpoint) || _setpoint < -50.0f || _setpoint > 50.0f) {
-        _setpoint = DEFAULT_SETPOINT;
+void SettingsManager::encodeProfiles(const Profile* profiles, uint8_t* block) {
+    block[0] = SETTINGS_PROFILE_COUNT;
+    block[1] = SETTINGS_PROFILE_SIZE;
+
+    for (int p = 0; p < SETTINGS_PROFILE_COUNT; p++) {
+        uint8_t* entry = block + 2 + p * SETTINGS_PROFILE_SIZE;
+        memcpy(entry, profiles[p].name, SETTINGS_PROFILE_NAME_LEN);
+
+        for (int i = 0; i < PROFILE_FIELD_COUNT; i++) {
+            uint16_t offset = profileFieldOffset(i);
+            if (SETTINGS_FIELDS[PROFILE_FIELDS[i]].type == FIELD_FLOAT) {
+                memcpy(entry + offset, &profiles[p].values[i], 4);
+            } else {
+                entry[offset] = static_cast<uint8_t>(profiles[p].values[i]);
+            }
+        }
     }
+}
 
-    // Load PID settings
-    uint8_t storedPidMode = EEPROM.read(EEPROM_ADDR_PID_MODE);
-    if (storedPidMode <= PID_AUTOTUNE) {
-        _pidMode = static_cast<PIDMode>(storedPidMode);
-    } else {
-        _pidMode = PID_OFF;
+void SettingsManager::initProfiles(const float* values, Profile* profiles) {
+    for (int p = 0; p < SETTINGS_PROFILE_COUNT; p++) {
+        memset(profiles[p].name, 0, SETTINGS_PROFILE_NAME_LEN);
+        snprintf(profiles[p].name, SETTINGS_PROFILE_NAME_LEN, "Profile %d", p + 1);
+        for (int i = 0; i < PROFILE_FIELD_COUNT; i++) {
+            profiles[p].values[i] = values[PROFILE_FIELDS[i]];
+        }
     }
+}
+
+void SettingsManager::sanitize(float* values) {
+    // Replace NaN or out-of-range values (e.g. erased flash) with defaults
+    for (int id = 0; id < SETTING_COUNT; id++) {
+        const SettingsFieldDef& field = SETTINGS_FIELDS[id];
+        if (isnan(values[id]) || values[id] < field.minValue || values[id] > field.maxValue) {
+            values[id] = field.defaultValue;
+        }
+    }
+
     // Don't start in auto-tune mode after reboot
-    if (_pidMode == PID_AUTOTUNE) {
-        _pidMode = PID_OFF;
+    if (values[SETTING_PID_MODE] == PID_AUTOTUNE) {
+        values[SETTING_PID_MODE] = PID_OFF;
+    }
+}
+
+void SettingsManager::sanitizeProfiles(Profile* profiles) {
+    for (int p = 0; p < SETTINGS_PROFILE_COUNT; p++) {
+        for (int i = 0; i < PROFILE_FIELD_COUNT; i++) {
+            const SettingsFieldDef& field = SETTINGS_FIELDS[PROFILE_FIELDS[i]];
+            float& value = profiles[p].values[i];
+            if (isnan(value) || value < field.minValue || value > field.maxValue) {
+                value = field.defaultValue;
+            }
+        }
+        if (profiles[p].name[0] == '\0') {
+            snprintf(profiles[p].name, SETTINGS_PROFILE_NAME_LEN, "Profile %d", p + 1);
+        }
+    }
+}
+
+void SettingsManager::storeActiveProfile() {
+    Profile& active = _profiles[getActiveProfile()];
+    for (int i = 0; i < PROFILE_FIELD_COUNT; i++) {
+        if (active.values[i] != _values[PROFILE_FIELDS[i]]) {
+            active.values[i] = _values[PROFILE_FIELDS[i]];
+            _profilesDirty = true;
+        }
     }
+}
+
+float SettingsManager::getAutoTuneNoiseBand() const {
+    return getValue(SETTING_AT_NOISE_BAND);
+}
+
+void SettingsManager::setAutoTuneNoiseBand(float celsius) {
+    setValue(SETTING_AT_NOISE_BAND, celsius);
+    save();
+}
+
+FopdtModel SettingsManager::getThermalModel() const {
+    FopdtModel model;
+    model.valid = getValue(SETTING_MODEL_VALID) != 0.0f;
+    model.gain = getValue(SETTING_MODEL_GAIN);
+    model.timeConstant = getValue(SETTING_MODEL_TAU);
+    model.deadTime = getValue(SETTING_MODEL_DEAD_TIME);
+    return model;
+}
 
-    EEPROM.get(EEPROM_ADDR_PID_KP, _pidKp);
-    EEPROM.get(EEPROM_ADDR_PID_KI, _pidKi);
-    EEPROM.get(EEPROM_ADDR_PID_KD, _pidKd);
-    EEPROM.get(EEPROM_ADDR_PID_MIN, _pidMinOutput);
-    EEPROM.get(EEPROM_ADDR_PID_MAX, _pidMaxOutput);
+void SettingsManager::setThermalModel(const FopdtModel& model, bool saveNow) {
+    setValue(SETTING_MODEL_VALID, model.valid ? 1.0f : 0.0f);
+    setValue(SETTING_MODEL_GAIN, model.gain);
+    setValue(SETTING_MODEL_TAU, model.timeConstant);
+    setValue(SETTING_MODEL_DEAD_TIME, model.deadTime);
+    if (saveNow) save();
+}
+
+bool SettingsManager::getAdaptiveTuningEnabled() const {
+    return getValue(SETTING_ADAPT_AUTO) != 0.0f;
+}
 
-    // Validate PID values
-    if (isnan(_pidKp) || _pidKp < 0.0f || _pidKp > 100.0f) _pidKp = 2.0f;
-    if (isnan(_pidKi) || _pidKi < 0.0f || _pidKi > 100.0f) _pidKi = 0.1f;
-    if (isnan(_pidKd) || _pidKd < 0.0f || _pidKd > 100.0f) _pidKd = 1.0f;
-    if (isnan(_pidMinOutput) || _pidMinOutput < 0.0f || _pidMinOutput > 100.0f) _pidMinOutput = 0.0f;
-    if (isnan(_pidMaxOutput) || _pidMaxOutput < 0.0f || _pidMaxOutput > 100.0f) _pidMaxOutput = 100.0f;
+void SettingsManager::setAdaptiveTuningEnabled(bool enabled) {
+    setValue(SETTING_ADAPT_AUTO, enabled ? 1.0f : 0.0f);
+    save();
+}
 
-    // Load fan speed
-    EEPROM.get(EEPROM_ADDR_FAN_SPEED, _fanSpeed);
-    if (isnan(_fanSpeed) || _fanSpeed < 0.0f || _fanSpeed > 100.0f) _fanSpeed = DEFAULT_FAN_SPEED;
+float SettingsManager::getPlantDriftThreshold() const {
+    return getValue(SETTING_ADAPT_DRIFT);
+}
+
+void SettingsManager::setPlantDriftThreshold(float fraction) {
+    setValue(SETTING_ADAPT_DRIFT, fraction);
+    save();
+}
+
+bool SettingsManager::getMPCEnabled() const {
+    return getValue(SETTING_MPC_ENABLED) != 0.0f;
+}
+
+void SettingsManager::setMPCEnabled(bool enabled) {
+    setValue(SETTING_MPC_ENABLED, enabled ? 1.0f : 0.0f);
+    save();
+}
+
+float SettingsManager::getMPCSlewRate() const {
+    return getValue(SETTING_MPC_SLEW);
+}
+
+void SettingsManager::setMPCSlewRate(float percentPerSecond) {
+    setValue(SETTING_MPC_SLEW, percentPerSecond);
+    save();
+}
+
+float SettingsManager::getTECRampRate() const {
+    return getValue(SETTING_TEC_RAMP_RATE);
+}
+
+void SettingsManager::setTECRampRate(float percentPerSecond) {
+    setValue(SETTING_TEC_RAMP_RATE, percentPerSecond);
+    save();
+}
+
+TECRampProfile SettingsManager::getTECRampProfile() const {
+    return static_cast<TECRampProfile>(static_cast<int>(getValue(SETTING_TEC_RAMP_PROFILE)));
+}
+
+void SettingsManager::setTECRampProfile(TECRampProfile profile) {
+    setValue(SETTING_TEC_RAMP_PROFILE, profile);
+    save();
+}
+
+bool SettingsManager::getTECHardwareFade() const {
+    return getValue(SETTING_TEC_HW_FADE) != 0.0f;
+}
+
+void SettingsManager::setTECHardwareFade(bool enabled) {
+    setValue(SETTING_TEC_HW_FADE, enabled ? 1.0f : 0.0f);
+    save();
+}
+
+float SettingsManager::getSupplyVoltage() const {
+    return getValue(SETTING_SUPPLY_VOLTS);
+}
+
+void SettingsManager::setSupplyVoltage(float volts) {
+    setValue(SETTING_SUPPLY_VOLTS, volts);
+    save();
+}
+
+float SettingsManager::getFanRatedPower() const {
+    return getValue(SETTING_FAN_RATED_W);
+}
+
+void SettingsManager::setFanRatedPower(float watts) {
+    setValue(SETTING_FAN_RATED_W, watts);
+    save();
+}
+
+float SettingsManager::getAmbientTemperature() const {
+    return getValue(SETTING_AMBIENT);
+}
+
+void SettingsManager::setAmbientTemperature(float celsius) {
+    setValue(SETTING_AMBIENT, celsius);
+    save();
+}
+
+void SettingsManager::getEnergyCounters(float& lifetimeWh, float& sessionWh, float& previousSessionWh) const {
+    lifetimeWh = getValue(SETTING_ENERGY_LIFETIME);
+    sessionWh = getValue(SETTING_ENERGY_SESSION);
+    previousSessionWh = getValue(SETTING_ENERGY_PREVIOUS);
+}
+
+void SettingsManager::setEnergyCounters(float lifetimeWh, float sessionWh, float previousSessionWh) {
+    setValue(SETTING_ENERGY_LIFETIME, lifetimeWh);
+    setValue(SETTING_ENERGY_SESSION, sessionWh);
+    setValue(SETTING_ENERGY_PREVIOUS, previousSessionWh);
+    save();
+}
+
+bool SettingsManager::getFanRPMMode() const {
+    return getValue(SETTING_FAN_RPM_MODE) != 0.0f;
+}
+
+void SettingsManager::setFanRPMMode(bool enabled) {
+    setValue(SETTING_FAN_RPM_MODE, enabled ? 1.0f : 0.0f);
+    save();
+}
+
+float SettingsManager::getFanMaxRPM() const {
+    return getValue(SETTING_FAN_MAX_RPM);
+}
+
+void SettingsManager::setFanMaxRPM(float rpm) {
+    setValue(SETTING_FAN_MAX_RPM, rpm);
+    save();
+}
+
+bool SettingsManager::getFanOptimizeEnabled() const {
+    return getValue(SETTING_FAN_OPTIMIZE) != 0.0f;
+}
+
+void SettingsManager::setFanOptimizeEnabled(bool enabled) {
+    setValue(SETTING_FAN_OPTIMIZE, enabled ? 1.0f : 0.0f);
+    save();
+}
+
+FanPolicyType SettingsManager::getFanPolicy() const {
+    return static_cast<FanPolicyType>(static_cast<int>(getValue(SETTING_FAN_POLICY)));
+}
+
+void SettingsManager::setFanPolicy(FanPolicyType policy) {
+    setValue(SETTING_FAN_POLICY, static_cast<float>(policy));
+    save();
+}
+
+bool SettingsManager::getGainScheduleEnabled() const {
+    return getValue(SETTING_GS_ENABLED) != 0.0f;
+}
+
+void SettingsManager::setGainScheduleEnabled(bool enabled) {
+    setValue(SETTING_GS_ENABLED, enabled ? 1.0f : 0.0f);
+    save();
+}
+
+GainScheduleSource SettingsManager::getGainScheduleSource() const {
+    return static_cast<GainScheduleSource>(static_cast<int>(getValue(SETTING_GS_SOURCE)));
+}
+
+void SettingsManager::setGainScheduleSource(GainScheduleSource source) {
+    setValue(SETTING_GS_SOURCE, source);
+    save();
+}
+
+bool SettingsManager::getGainSchedulePoint(uint8_t index, GainSchedulePoint& point) const {
+    if (index >= GAIN_SCHEDULE_POINTS) return false;
+
+    int base = SETTING_GS_POINTS + index * GAIN_SCHEDULE_PARAMS;
+    point.temperature = _values[base];
+    point.kp = _values[base + 1];
+    point.ki = _values[base + 2];
+    point.kd = _values[base + 3];
+
+    uint8_t mask = static_cast<uint8_t>(getValue(SETTING_GS_VALID_MASK));
+    return (mask & (1 << index)) != 0;
+}
+
+void SettingsManager::setGainSchedulePoint(uint8_t index, const GainSchedulePoint& point, bool saveNow) {
+    if (index >= GAIN_SCHEDULE_POINTS) return;
+
+    int base = SETTING_GS_POINTS + index * GAIN_SCHEDULE_PARAMS;
+    setValue(static_cast<SettingsFieldId>(base), point.temperature);
+    setValue(static_cast<SettingsFieldId>(base + 1), point.kp);
+    setValue(static_cast<SettingsFieldId>(base + 2), point.ki);
+    setValue(static_cast<SettingsFieldId>(base + 3), point.kd);
+
+    uint8_t mask = static_cast<uint8_t>(getValue(SETTING_GS_VALID_MASK));
+    setValue(SETTING_GS_VALID_MASK, mask | (1 << index));
+    if (saveNow) save();
+}
+
+void SettingsManager::clearGainSchedulePoint(uint8_t index) {
+    if (index >= GAIN_SCHEDULE_POINTS) return;
+
+    uint8_t mask = static_cast<uint8_t>(getValue(SETTING_GS_VALID_MASK));
+    setValue(SETTING_GS_VALID_MASK, mask & ~(1 << index));
+    save();
+}
+
+uint8_t SettingsManager::getGainSchedulePointCount() const {
+    uint8_t mask = static_cast<uint8_t>(getValue(SETTING_GS_VALID_MASK));
+    uint8_t count = 0;
+    for (int i = 0; i < GAIN_SCHEDULE_POINTS; i++) {
+        if (mask & (1 << i)) count++;
+    }
+    return count;
+}
+
+bool SettingsManager::getFeedForwardEnabled() const {
+    return getValue(SETTING_FF_ENABLED) != 0.0f;
+}
+
+void SettingsManager::setFeedForwardEnabled(bool enabled) {
+    setValue(SETTING_FF_ENABLED, enabled ? 1.0f : 0.0f);
+    save();
+}
+
+void SettingsManager::getFeedForwardModel(float& bias, float& setpointGain, float& fanGain, uint32_t& samples,
+                                          uint8_t& varied) const {
+    bias = getValue(SETTING_FF_BIAS);
+    setpointGain = getValue(SETTING_FF_SETPOINT_GAIN);
+    fanGain = getValue(SETTING_FF_FAN_GAIN);
+    samples = static_cast<uint32_t>(getValue(SETTING_FF_SAMPLES));
+    varied = static_cast<uint8_t>(getValue(SETTING_FF_VARIED));
+}
+
+void SettingsManager::setFeedForwardModel(float bias, float setpointGain, float fanGain, uint32_t samples,
+                                          uint8_t varied, bool saveNow) {
+    setValue(SETTING_FF_BIAS, bias);
+    setValue(SETTING_FF_SETPOINT_GAIN, setpointGain);
+    setValue(SETTING_FF_FAN_GAIN, fanGain);
+    setValue(SETTING_FF_SAMPLES, static_cast<float>(samples));
+    setValue(SETTING_FF_VARIED, varied);
+    if (saveNow) save();
+}
+
+uint8_t SettingsManager::getActiveProfile() const {
+    return static_cast<uint8_t>(getValue(SETTING_ACTIVE_PROFILE));
+}
+
+const char* SettingsManager::getProfileName(uint8_t index) const {
+    if (index >= SETTINGS_PROFILE_COUNT) return "";
+    return _profiles[index].name;
+}
+
+void SettingsManager::setProfileName(uint8_t index, const char* name) {
+    if (index >= SETTINGS_PROFILE_COUNT || name == nullptr || name[0] == '\0') return;
+    if (strncmp(_profiles[index].name, name, SETTINGS_PROFILE_NAME_LEN - 1) == 0) return;
+
+    memset(_profiles[index].name, 0, SETTINGS_PROFILE_NAME_LEN);
+    strncpy(_profiles[index].name, name, SETTINGS_PROFILE_NAME_LEN - 1);
+    _profilesDirty = true;
+    save();
+}
+
+bool SettingsManager::selectProfile(uint8_t index) {
+    if (index >= SETTINGS_PROFILE_COUNT || index == getActiveProfile()) return false;
+
+    // Keep edits made to the outgoing profile, then swap in the new one
+    storeActiveProfile();
+    for (int i = 0; i < PROFILE_FIELD_COUNT; i++) {
+        setValue(PROFILE_FIELDS[i], _profiles[index].values[i]);
+    }
+    setValue(SETTING_ACTIVE_PROFILE, index);
+    save();
 
-    // Load smart control settings
-    uint8_t smartEnabled = EEPROM.read(EEPROM_ADDR_SMART_ENABLED);
-    _smartControlEnabled = (smartEnabled == 1);
-    EEPROM.get(EEPROM_ADDR_SMART_SETPOINT, _smartSetpoint);
-    if (isnan(_smartSetpoint) || _smartSetpoint < 0.0f || _smartSetpoint > 100.0f) _smartSetpoint = DEFAULT_SMART_SETPOINT;
+    logPrintf("Settings: switched to profile %u (%s)\n", index + 1, _profiles[index].name);
+    return true;
 }
 
 TempUnit SettingsManager::getTempUnit() const {
-    return _tempUnit;
+    return static_cast<TempUnit>(static_cast<int>(getValue(SETTING_TEMP_UNIT)));
 }
 
 void SettingsManager::setTempUnit(TempUnit unit) {
-    _tempUnit = unit;
+    setValue(SETTING_TEMP_UNIT, unit);
 }
 
 void SettingsManager::toggleTempUnit() {
-    _tempUnit = (_tempUnit == CELSIUS) ? FAHRENHEIT : CELSIUS;
+    setValue(SETTING_TEMP_UNIT, (getTempUnit() == CELSIUS) ? FAHRENHEIT : CELSIUS);
     save();
 }
 
 float SettingsManager::getSetpoint() const {
-    return _setpoint;
+    return getValue(SETTING_SETPOINT);
 }
 
 void SettingsManager::setSetpoint(float celsius) {
-    _setpoint = celsius;
+    setValue(SETTING_SETPOINT, celsius);
     save();
 }
 
 float SettingsManager::getFanSpeed() const {
-    return _fanSpeed;
+    return getValue(SETTING_FAN_SPEED);
 }
 
 void SettingsManager::setFanSpeed(float percent) {
-    _fanSpeed = percent;
+    setValue(SETTING_FAN_SPEED, percent);
     save();
 }
 
 bool SettingsManager::getSmartControlEnabled() const {
-    return _smartControlEnabled;
+    return getValue(SETTING_SMART_ENABLED) != 0.0f;
 }
 
 void SettingsManager::setSmartControlEnabled(bool enabled) {
-    _smartControlEnabled = enabled;
+    setValue(SETTING_SMART_ENABLED, enabled ? 1.0f : 0.0f);
     save();
 }
 
 float SettingsManager::getSmartSetpoint() const {
-    return _smartSetpoint;
+    return getValue(SETTING_SMART_SETPOINT);
 }
 
 void SettingsManager::setSmartSetpoint(float percent) {
-    _smartSetpoint = percent;
+    setValue(SETTING_SMART_SETPOINT, percent);
     save();
 }
 
 PIDMode SettingsManager::getPIDMode() const {
-    return _pidMode;
+    return static_cast<PIDMode>(static_cast<int>(getValue(SETTING_PID_MODE)));
 }
 
 void SettingsManager::setPIDMode(PIDMode mode, bool saveNow) {
-    _pidMode = mode;
+    setValue(SETTING_PID_MODE, mode);
     if (saveNow) save();
 }
 
-float SettingsManager::getPIDKp() const { return _pidKp; }
-float SettingsManager::getPIDKi() const { return _pidKi; }
-float SettingsManager::getPIDKd() const { return _pidKd; }
+float SettingsManager::getPIDKp() const { return getValue(SETTING_PID_KP); }
+float SettingsManager::getPIDKi() const { return getValue(SETTING_PID_KI); }
+float SettingsManager::getPIDKd() const { return getValue(SETTING_PID_KD); }
 
 void SettingsManager::setPIDTunings(float kp, float ki, float kd, bool saveNow) {
-    _pidKp = kp;
-    _pidKi = ki;
-    _pidKd = kd;
+    setValue(SETTING_PID_KP, kp);
+    setValue(SETTING_PID_KI, ki);
+    setValue(SETTING_PID_KD, kd);
     if (saveNow) save();
 }
 
-float SettingsManager::getPIDMinOutput() const { return _pidMinOutput; }
-float SettingsManager::getPIDMaxOutput() const { return _pidMaxOutput; }
+float SettingsManager::getPIDMinOutput() const { return getValue(SETTING_PID_MIN); }
+float SettingsManager::getPIDMaxOutput() const { return getValue(SETTING_PID_MAX); }
 
 void SettingsManager::setPIDOutputLimits(float min, float max, bool saveNow) {
-    _pidMinOutput = min;
-    _pidMaxOutput = max;
+    setValue(SETTING_PID_MIN, min);
+    setValue(SETTING_PID_MAX, max);
     if (saveNow) save();
 }
 
 float SettingsManager::toDisplayUnit(float celsius) const {
-    return (_tempUnit == CELSIUS) ? celsius : celsiusToFahrenheit(celsius);
+    return (getTempUnit() == CELSIUS) ? celsius : celsiusToFahrenheit(celsius);
 }
 
 float SettingsManager::celsiusToFahrenheit(float celsius) const {
@@ -167,9 +729,9 @@ float SettingsManager::fahrenheitToCelsius(float fahrenheit) const {
 }
 
 const char* SettingsManager::getUnitString() const {
-    return (_tempUnit == CELSIUS) ? "C" : "F";
+    return (getTempUnit() == CELSIUS) ? "C" : "F";
 }
 
 const char* SettingsManager::getUnitSymbol() const {
-    return (_tempUnit == CELSIUS) ? "C" : "F";
+    return (getTempUnit() == CELSIUS) ? "C" : "F";
 }
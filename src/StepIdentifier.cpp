@@ -0,0 +1,173 @@
+#include "StepIdentifier.h"
+#include <Arduino.h>
+
+extern void logPrintf(const char* format, ...);
+
+void StepIdentifier::start(float input, float baseOutput, float minOutput, float maxOutput) {
+    _state = BASELINE;
+    _error = "";
+    _model.valid = false;
+    _baseOutput = baseOutput;
+
+    // Step toward more cooling when there is headroom, otherwise back off
+    _stepOutput = (baseOutput + STEP_PCT <= maxOutput) ? baseOutput + STEP_PCT : baseOutput - STEP_PCT;
+    if (_stepOutput < minOutput) _stepOutput = minOutput;
+
+    _phaseStart = millis();
+    _lastSample = 0;
+    _baseSumT = _baseSumY = _baseSumTY = _baseSumTT = 0.0f;
+    _baseCount = 0;
+    _count = 0;
+
+    logPrintf("Identify: baseline at %.0f%%, step to %.0f%% (T=%.2fC)\n", _baseOutput, _stepOutput, input);
+}
+
+int StepIdentifier::getProgress() const {
+    switch (_state) {
+        case BASELINE:
+            return static_cast<int>((millis() - _phaseStart) * 10 / BASELINE_MS);
+        case STEP:
+            return 10 + _count * 90 / MAX_SAMPLES;
+        case DONE:
+            return 100;
+        default:
+            return 0;
+    }
+}
+
+float StepIdentifier::update(float input) {
+    unsigned long now = millis();
+
+    if (_state == BASELINE) {
+        if (now - _lastSample >= SAMPLE_MS) {
+            float t = (now - _phaseStart) / 1000.0f;
+            _baseSumT += t;
+            _baseSumY += input;
+            _baseSumTY += t * input;
+            _baseSumTT += t * t;
+            _baseCount++;
+            _lastSample = now;
+        }
+
+        if (now - _phaseStart >= BASELINE_MS && _baseCount > 2) {
+            // Line fit over the baseline: extrapolate the drift through the step
+            float n = _baseCount;
+            float den = n * _baseSumTT - _baseSumT * _baseSumT;
+            _drift = (den > 0.0f) ? (n * _baseSumTY - _baseSumT * _baseSumY) / den : 0.0f;
+            float t = (now - _phaseStart) / 1000.0f;
+            _baseline = (_baseSumY - _drift * _baseSumT) / n + _drift * t;
+
+            _state = STEP;
+            _phaseStart = now;
+            _lastSample = now;
+            _count = 0;
+            logPrintf("Identify: baseline %.2fC, drift %.4fC/s, stepping\n", _baseline, _drift);
+        }
+        return _baseOutput;
+    }
+
+    if (_state != STEP) {
+        return _baseOutput;
+    }
+
+    if (now - _lastSample >= SAMPLE_MS) {
+        _lastSample = now;
+        float t = (now - _phaseStart) / 1000.0f;
+        _samples[_count++] = input - (_baseline + _drift * t);
+
+        // Settled: enough samples and the last window moved < 5% of the total change
+        bool settled = false;
+        if (_count >= MIN_STEP_SAMPLES && _count > SETTLE_WINDOW) {
+            float total = fabsf(_samples[_count - 1]);
+            float recent = fabsf(_samples[_count - 1] - _samples[_count - 1 - SETTLE_WINDOW]);
+            settled = total > MIN_RESPONSE_C && recent < SETTLE_FRACTION * total;
+        }
+
+        if (settled || _count >= MAX_SAMPLES) {
+            _state = fit() ? DONE : FAILED;
+            return _baseOutput;
+        }
+    }
+
+    return _stepOutput;
+}
+
+bool StepIdentifier::fit() {
+    float du = _stepOutput - _baseOutput;
+    if (fabsf(_samples[_count - 1]) < MIN_RESPONSE_C || du == 0.0f) {
+        _error = "No response";
+        logPrintf("Identify: response %.2fC too small\n", _samples[_count - 1]);
+        return false;
+    }
+
+    int maxDelay = _count / 3;
+    if (maxDelay > MAX_DEAD_TIME_S) maxDelay = MAX_DEAD_TIME_S;
+
+    float bestResidual = -1.0f;
+    float bestA = 0.0f;
+    float bestB = 0.0f;
+    int bestDelay = 0;
+
+    for (int d = 0; d <= maxDelay; d++) {
+        // Normal equations for y[k+1] = a*y[k] + b*u[k], u[k] = (k >= d)
+        float syy = 0.0f, syu = 0.0f, suu = 0.0f, sny = 0.0f, snu = 0.0f;
+        for (int k = 0; k < _count - 1; k++) {
+            float y = _samples[k];
+            float u = (k >= d) ? 1.0f : 0.0f;
+            float yn = _samples[k + 1];
+            syy += y * y;
+            syu += y * u;
+            suu += u * u;
+            sny += yn * y;
+            snu += yn * u;
+        }
+
+        float det = syy * suu - syu * syu;
+        if (fabsf(det) < 1e-9f) continue;
+        float a = (sny * suu - snu * syu) / det;
+        float b = (syy * snu - syu * sny) / det;
+        if (a <= 0.0f || a >= 1.0f) continue;  // Not a stable first-order response
+
+        float residual = 0.0f;
+        for (int k = 0; k < _count - 1; k++) {
+            float u = (k >= d) ? 1.0f : 0.0f;
+            float e = _samples[k + 1] - a * _samples[k] - b * u;
+            residual += e * e;
+        }
+
+        if (bestResidual < 0.0f || residual < bestResidual) {
+            bestResidual = residual;
+            bestA = a;
+            bestB = b;
+            bestDelay = d;
+        }
+    }
+
+    if (bestResidual < 0.0f) {
+        _error = "Fit failed";
+        logPrintf("Identify: no stable FOPDT fit\n");
+        return false;
+    }
+
+    // a -> 1 sends tau to infinity; keep only models the stored settings
+    // (modelGain/modelTau bounds) can hold unchanged, so every consumer of the
+    // fit sees the same numbers
+    float ts = SAMPLE_MS / 1000.0f;
+    float tau = -ts / logf(bestA);
+    float gain = bestB / ((1.0f - bestA) * du);
+    if (!isfinite(tau) || !isfinite(gain) || tau > MAX_TIME_CONSTANT_S ||
+        fabsf(gain) > MAX_GAIN || fabsf(gain) < MIN_GAIN) {
+        _error = "Fit failed";
+        logPrintf("Identify: fit out of range (K=%.4fC/%%, tau=%.1fs)\n", gain, tau);
+        return false;
+    }
+    _model.timeConstant = tau;
+    _model.gain = gain;
+    _model.deadTime = bestDelay * ts;
+    _model.valid = true;
+
+    logPrintf("Identify: K=%.4fC/%%, tau=%.1fs, theta=%.1fs (rms %.3fC over %d s)\n",
+              _model.gain, _model.timeConstant, _model.deadTime,
+              sqrtf(bestResidual / (_count - 1)), _count);
+    return true;
+}
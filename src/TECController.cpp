@@ -1,6 +1,15 @@
 #include "TECController.h"
 #include "PCA9554.h"
+#include "SettingsManager.h"
+#include "AnalogAcquisition.h"
 #include <Arduino.h>
+#include <driver/ledc.h>
+
+// Arduino maps LEDC channels 0-7 to speed mode 0 (high speed on the ESP32,
+// the only (low speed) group on the S3)
+static ledc_mode_t ledcModeFor(uint8_t channel) {
+    return static_cast<ledc_mode_t>(channel / 8);
+}
 
 TECController& TECController::getInstance() {
     static TECController instance;
@@ -23,8 +32,10 @@ void TECController::begin() {
     _power = 0.0f;
     _targetPower = 0.0f;
 
-    // Configure current sense pin
-    pinMode(PIN_RIS, INPUT);
+    // Current windows must span whole PWM periods
+    static_assert(AnalogAcquisition::SAMPLE_HZ_PER_CHANNEL * CURRENT_WINDOW_PERIODS ==
+                  PWM_FREQ * ANALOG_INPUTS[ANALOG_TEC_CURRENT].windowSamples,
+                  "TEC current window is not coherent with the PWM frequency");
 }
 
 void TECController::setEnabled(bool enabled) {
@@ -35,16 +46,16 @@ void TECController::setEnabled(bool enabled) {
     auto& io = PCA9554::getInstance();
     io.digitalWrite(PIN_REN, enabled);
 
+    // Disable immediately; enable soft-starts from zero toward the target
+    _power = 0.0f;
+    _ramping = false;
+    _rampTo = 0.0f;
+    _rampVelocity = 0.0f;
+    _lastRampUpdate = millis();
     if (!enabled) {
-        // Disable immediately
-        _power = 0.0f;
         _targetPower = 0.0f;
-        ledcWrite(PWM_CHANNEL, 0);
-    } else {
-        // Soft-start: begin ramping from current power to target
-        _power = 0.0f;  // Start from zero on enable
-        updatePWM();
     }
+    updatePWM();
 }
 
 void TECController::setPower(float power, bool instant) {
@@ -57,23 +68,161 @@ void TECController::setPower(float power, bool instant) {
     // Instant mode bypasses ramp (for auto-tune accuracy)
     if (instant) {
         _power = power;
+        _rampTo = power;
+        _ramping = false;
+        _rampVelocity = 0.0f;
         updatePWM();
     }
 }
 
 void TECController::update() {
+    updateCurrentSense();
     if (!_enabled) return;
 
-    // Soft-start/soft-stop ramping
-    if (_power < _targetPower) {
-        _power += RAMP_RATE;
-        if (_power > _targetPower) _power = _targetPower;
-        updatePWM();
-    } else if (_power > _targetPower) {
-        _power -= RAMP_RATE;
-        if (_power < _targetPower) _power = _targetPower;
+    unsigned long now = millis();
+
+#if SOC_LEDC_SUPPORT_FADE_STOP
+    // A running fade is followed to its end even if the option was turned off.
+    // Without ledc_fade_stop() a fade could not be overridden, so the
+    // software ramp is used instead.
+    if (SettingsManager::getInstance().getTECHardwareFade() || _fadeRunning) {
+        if (!_fadeInstalled) {
+            _fadeInstalled = ledc_fade_func_install(0) == ESP_OK;
+        }
+        if (_fadeInstalled) {
+            updateFade(now);
+            return;
+        }
+    }
+#endif
+    updateRamp(now);
+}
+
+void TECController::updateRamp(unsigned long now) {
+    auto& settings = SettingsManager::getInstance();
+    float dt = (now - _lastRampUpdate) / 1000.0f;
+    _lastRampUpdate = now;
+
+    if (settings.getTECRampProfile() == RAMP_S_CURVE) {
+        updateSCurve(dt, settings.getTECRampRate() / 100.0f);
+        return;
+    }
+
+    // New target: restart the segment from where we are. This keeps the
+    // rate constant through retargets.
+    if (_targetPower != _rampTo) {
+        _rampFrom = _power;
+        _rampTo = _targetPower;
+        _rampStart = now;
+        float seconds = fabsf(_rampTo - _rampFrom) * 100.0f / settings.getTECRampRate();
+        _rampDuration = static_cast<unsigned long>(seconds * 1000.0f);
+        _rampVelocity = 0.0f;
+        _ramping = true;
+    }
+    if (!_ramping) return;
+
+    // Position along the segment from elapsed time, not update count
+    float s = 1.0f;
+    if (_rampDuration > 0 && now - _rampStart < _rampDuration) {
+        s = static_cast<float>(now - _rampStart) / _rampDuration;
+    } else {
+        _ramping = false;
+    }
+
+    _power = _rampFrom + (_rampTo - _rampFrom) * s;
+    updatePWM();
+}
+
+void TECController::updateSCurve(float dt, float rate) {
+    // Accelerate toward the target at up to the ramp rate, and brake in time
+    // to stop on it. The slope carries over when the target moves (the PID
+    // retargets every compute), so a large step still reaches the full rate
+    // instead of restarting from zero slope each time.
+    float distance = _targetPower - _power;
+    if (distance == 0.0f && _rampVelocity == 0.0f) return;
+
+    float accel = rate / S_CURVE_ACCEL_S;
+    float wanted = sqrtf(2.0f * accel * fabsf(distance));  // Fastest that can still stop
+    if (wanted > rate) wanted = rate;
+    if (distance < 0.0f) wanted = -wanted;
+
+    float dv = accel * dt;
+    if (_rampVelocity < wanted) {
+        _rampVelocity += dv;
+        if (_rampVelocity > wanted) _rampVelocity = wanted;
+    } else {
+        _rampVelocity -= dv;
+        if (_rampVelocity < wanted) _rampVelocity = wanted;
+    }
+
+    float step = _rampVelocity * dt;
+    if ((distance > 0.0f && step >= distance) || (distance < 0.0f && step <= distance) ||
+        fabsf(distance) < S_CURVE_SNAP) {
+        _power = _targetPower;
+        _rampVelocity = 0.0f;
+    } else {
+        _power += step;
+    }
+    _rampTo = _power;  // No linear segment: switching profile starts one from here
+    _ramping = false;
+    updatePWM();
+}
+
+void TECController::updateFade(unsigned long now) {
+    _lastRampUpdate = now;
+    _rampVelocity = 0.0f;  // Hardware fades are linear
+
+    if (_fadeRunning) {
+        // Track the (linear) hardware fade for getPower()
+        if (static_cast<long>(now - _fadeEnd) < 0) {
+            float s = static_cast<float>(now - _rampStart) / _rampDuration;
+            _power = _rampFrom + (_rampTo - _rampFrom) * s;
+        } else {
+            _power = _rampTo;
+        }
+
+        if (_targetPower != _rampTo) {
+            // New target (a lower one or the shutdown included): take the
+            // engine back now and continue from where the fade got to
+            stopFade();
+        } else if (static_cast<long>(now - _fadeEnd - FADE_MARGIN_MS) < 0) {
+            return;  // Let the fade-end interrupt release the engine
+        } else {
+            _fadeRunning = false;
+        }
+    }
+
+    if (_targetPower == _power) return;
+
+    _ramping = false;
+    _rampFrom = _power;
+    _rampTo = _targetPower;
+    _rampStart = now;
+    float seconds = fabsf(_rampTo - _rampFrom) * 100.0f / SettingsManager::getInstance().getTECRampRate();
+    _rampDuration = static_cast<unsigned long>(seconds * 1000.0f);
+
+    if (_rampDuration < FADE_MIN_MS) {
+        _power = _rampTo;
         updatePWM();
+        return;
     }
+
+    // The fade engine steps the duty in hardware - no CPU until it finishes
+    ledc_mode_t mode = ledcModeFor(PWM_CHANNEL);
+    ledc_channel_t channel = static_cast<ledc_channel_t>(PWM_CHANNEL % 8);
+    ledc_set_fade_with_time(mode, channel, dutyFor(_rampTo), static_cast<int>(_rampDuration));
+    ledc_fade_start(mode, channel, LEDC_FADE_NO_WAIT);
+    _fadeRunning = true;
+    _fadeEnd = now + _rampDuration;
+}
+
+void TECController::stopFade() {
+#if SOC_LEDC_SUPPORT_FADE_STOP
+    // Holds the duty where the fade got to (within one PWM period) and frees
+    // the channel for the next duty write or fade
+    ledc_fade_stop(ledcModeFor(PWM_CHANNEL), static_cast<ledc_channel_t>(PWM_CHANNEL % 8));
+#endif
+    _fadeRunning = false;
 }
 
 void TECController::stop() {
@@ -82,21 +231,31 @@ void TECController::stop() {
     setEnabled(false);
 }
 
-void TECController::updatePWM() {
+uint32_t TECController::dutyFor(float power) const {
     uint32_t maxDuty = (1 << PWM_RESOLUTION) - 1;  // 1023 for 10-bit
-    uint32_t duty = static_cast<uint32_t>(_power * maxDuty);
-    ledcWrite(PWM_CHANNEL, duty);
+    return static_cast<uint32_t>(power * maxDuty);
 }
 
-float TECController::readCurrent() {
-    int raw = analogRead(PIN_RIS);
-    float voltage = raw * 3.3f / 4095.0f;
-
-    // Debug: output raw ADC value
-    Serial.printf("  [ADC raw=%d, voltage=%.3fV]\n", raw, voltage);
+void TECController::updatePWM() {
+    // The driver must not take a duty write while a fade owns the channel
+    if (_fadeRunning) stopFade();
+    ledcWrite(PWM_CHANNEL, dutyFor(_power));
+}
 
-    // Calibrated: ~38mV per amp (0.33V at 8.7A)
-    float current = voltage / 0.038f;
+void TECController::updateCurrentSense() {
+    // One window = whole PWM periods: its mean is the average current. Every
+    // window completed since the last loop goes through the filter, so its
+    // time constant is in windows, not loop iterations.
+    AnalogWindow windows[AnalogAcquisition::WINDOW_HISTORY];
+    size_t count = AnalogAcquisition::getInstance().readWindows(ANALOG_TEC_CURRENT, _currentSequence,
+                                                                windows, AnalogAcquisition::WINDOW_HISTORY);
+    for (size_t i = 0; i < count; i++) {
+        _current += CURRENT_FILTER * (windows[i].mean / VOLTS_PER_AMP - _current);
+        _currentSequence = windows[i].sequence;
+    }
+}
 
-    return current;
+float TECController::getOnPhaseCurrent() const {
+    // The average is the on-phase current scaled by the duty cycle
+    return (_power > 0.01f) ? _current / _power : 0.0f;
 }
@@ -11,13 +11,8 @@ TemperatureSensor& TemperatureSensor::getInstance() {
 void TemperatureSensor::begin() {
     auto& io = PCA9554::getInstance();
 
-    // Check if I2C expander is online
-    if (!io.isOnline()) {
-        _hasError = true;
-        return;
-    }
-
-    // Configure SPI pins on PCA9554
+    // Configure SPI pins on PCA9554. While it is offline this only records
+    // the pin state, which PCA9554 applies when the EXTIO2 comes back.
     // Add delays between I2C operations for EXTIO2 settling
     io.setPinMode(PIN_CLK, true);   // Output
     delay(5);
@@ -35,19 +30,29 @@ void TemperatureSensor::begin() {
     delay(10);
 
     // Initialize MAX31865
-    max31865_init();
+    if (io.isOnline()) {
+        max31865_init();
+        delay(10);
+    }
 
+    _reconnectCount = io.getReconnectCount();
     _hasError = !io.isOnline();
 }
 
 void TemperatureSensor::tryReconnect() {
+    // PCA9554 reconnects in the background and restores the SPI pin modes
+    // and idle levels itself; all that is left is the MAX31865 fault clear.
+    // Never blocks: one short SPI write, at most every REINIT_INTERVAL_MS.
     auto& io = PCA9554::getInstance();
-    io.tryReconnect();
+    if (!io.isOnline()) return;
 
-    if (io.isOnline() && _hasError) {
-        // Try to reinitialize
-        begin();
-    }
+    unsigned long now = millis();
+    bool reconnected = io.getReconnectCount() != _reconnectCount;
+    if (!reconnected && now - _lastReinit < REINIT_INTERVAL_MS) return;
+
+    _reconnectCount = io.getReconnectCount();
+    _lastReinit = now;
+    max31865_init();
 }
 
 float TemperatureSensor::readTemperature() {
@@ -103,7 +108,6 @@ uint8_t TemperatureSensor::softSPI_transfer(uint8_t data) {
 void TemperatureSensor::max31865_init() {
     // Clear any faults
     max31865_write(MAX31865_CONFIG_REG, MAX31865_CONFIG_FAULT_CLEAR);
-    delay(10);
 }
 
 void TemperatureSensor::max31865_write(uint8_t reg, uint8_t value) {
@@ -5,8 +5,8 @@
 #include "InputController.h"
 #include "PIDController.h"
 #include "EXTIO2Flasher.h"
-#include "firmware_custom.h"
-#include "firmware_original.h"
+#include "EXTIO2FlashJob.h"
+#include "FirmwareStore.h"
 #include <Arduino.h>
 
 UIStateMachine& UIStateMachine::getInstance() {
@@ -17,7 +17,7 @@ UIStateMachine& UIStateMachine::getInstance() {
 void UIStateMachine::begin() {
     _mode = MODE_NAVIGATE;
     _mainSelection = MAIN_SELECT_SETPOINT;
-    _settingsSelection = SETTINGS_TEMP_UNIT;
+    _settingsSelection = SETTINGS_PROFILE;
     _lastInteractionTime = millis();
     _lastTempUpdate = 0;
 
@@ -37,6 +37,11 @@ void UIStateMachine::update() {
         handleAutoTuneMode();
     }
 
+    // Drain flash progress from the background job
+    if (_mode == MODE_FIRMWARE_FLASHING) {
+        handleFirmwareFlashing();
+    }
+
     // Check for button press first
     if (input.wasButtonPressed()) {
         resetInactivityTimer();
@@ -45,7 +50,7 @@ void UIStateMachine::update() {
             case MODE_NAVIGATE:
                 if (_mainSelection == MAIN_SELECT_SETTINGS) {
                     _mode = MODE_SETTINGS;
-                    _settingsSelection = SETTINGS_TEMP_UNIT;
+                    _settingsSelection = SETTINGS_PROFILE;
                     DisplayManager::getInstance().showSettingsScreen();
                     input.playEnterBeep();
                 } else {
@@ -106,6 +111,15 @@ void UIStateMachine::update() {
                 input.playExitBeep();
                 break;
 
+            case MODE_ENERGY:
+                // Back button pressed - return to settings
+                _mode = MODE_SETTINGS;
+                _settingsSelection = SETTINGS_ENERGY;
+                DisplayManager::getInstance().closeEnergyScreen();
+                DisplayManager::getInstance().updateSettingsScreen(_settingsSelection);
+                input.playExitBeep();
+                break;
+
             case MODE_FAN:
                 handleFanButtonPress();
                 break;
@@ -143,7 +157,13 @@ void UIStateMachine::update() {
                 break;
 
             case MODE_FIRMWARE_FLASHING:
-                // Ignore button during flashing
+                // Cancel before the next page; the result screen follows
+                if (EXTIO2FlashJob::getInstance().isRunning() && !_flashCancelling) {
+                    _flashCancelling = true;
+                    EXTIO2FlashJob::getInstance().cancel();
+                    DisplayManager::getInstance().showFlashingProgress(_flashPage, _flashTotal, "Cancelling...");
+                    input.playExitBeep();
+                }
                 break;
         }
 
@@ -183,6 +203,9 @@ void UIStateMachine::update() {
             case MODE_POWER:
                 // No encoder input on power screen
                 break;
+            case MODE_ENERGY:
+                // No encoder input on energy screen
+                break;
             case MODE_FAN:
                 handleFanMode(delta);
                 break;
@@ -271,6 +294,12 @@ void UIStateMachine::handleSettingsButtonPress() {
     auto& display = DisplayManager::getInstance();
 
     switch (_settingsSelection) {
+        case SETTINGS_PROFILE:
+            selectNextProfile();
+            input.playToggleBeep();
+            display.updateSettingsScreen(_settingsSelection);
+            break;
+
         case SETTINGS_TEMP_UNIT:
             settings.toggleTempUnit();
             input.playToggleBeep();
@@ -297,6 +326,12 @@ void UIStateMachine::handleSettingsButtonPress() {
             input.playEnterBeep();
             break;
 
+        case SETTINGS_ENERGY:
+            _mode = MODE_ENERGY;
+            display.showEnergyScreen();
+            input.playEnterBeep();
+            break;
+
         case SETTINGS_FANS:
             _mode = MODE_FAN;
             _fanSelection = FAN_SELECT_SPEED;
@@ -325,14 +360,25 @@ void UIStateMachine::handleSettingsButtonPress() {
     }
 }
 
+void UIStateMachine::selectNextProfile() {
+    auto& settings = SettingsManager::getInstance();
+
+    uint8_t next = (settings.getActiveProfile() + 1) % settings.getProfileCount();
+    if (!settings.selectProfile(next)) return;
+
+    // Apply the new profile immediately - no re-tune needed
+    PIDController::getInstance().applySettings();
+    _setpoint = settings.getSetpoint();
+    _fanSpeed = settings.getFanSpeed();
+}
+
 void UIStateMachine::handlePIDMenuMode(int delta) {
     auto& input = InputController::getInstance();
 
     int newSelection = static_cast<int>(_pidSelection) + delta;
 
-    // Wrap around, skip AUTOTUNE always, skip SAVE if no changes
+    // Wrap around, skip SAVE if no changes
     auto shouldSkip = [this](int sel) {
-        if (sel == PID_MENU_AUTOTUNE) return true;  // Auto-tune disabled
         if (sel == PID_MENU_SAVE && !_pidSettingsChanged) return true;
         return false;
     };
@@ -374,6 +420,40 @@ void UIStateMachine::handlePIDMenuButtonPress() {
             break;
         }
 
+        case PID_MENU_CONTROL:
+            // MPC takes over from the PID once a model has been identified
+            settings.setMPCEnabled(!settings.getMPCEnabled());
+            input.playToggleBeep();
+            display.updatePIDScreen(_pidSelection, false, _pidSettingsChanged);
+            break;
+
+        case PID_MENU_SCHEDULE:
+            // Cycle Off -> by setpoint -> by measured temperature -> Off
+            if (!settings.getGainScheduleEnabled()) {
+                settings.setGainScheduleSource(GS_SOURCE_SETPOINT);
+                settings.setGainScheduleEnabled(true);
+            } else if (settings.getGainScheduleSource() == GS_SOURCE_SETPOINT) {
+                settings.setGainScheduleSource(GS_SOURCE_MEASURED);
+            } else {
+                settings.setGainScheduleEnabled(false);
+            }
+            input.playToggleBeep();
+            display.updatePIDScreen(_pidSelection, false, _pidSettingsChanged);
+            break;
+
+        case PID_MENU_FEEDFORWARD:
+            settings.setFeedForwardEnabled(!settings.getFeedForwardEnabled());
+            input.playToggleBeep();
+            display.updatePIDScreen(_pidSelection, false, _pidSettingsChanged);
+            break;
+
+        case PID_MENU_ADAPT:
+            // Monitor only <-> re-derive gains automatically on drift
+            settings.setAdaptiveTuningEnabled(!settings.getAdaptiveTuningEnabled());
+            input.playToggleBeep();
+            display.updatePIDScreen(_pidSelection, false, _pidSettingsChanged);
+            break;
+
         case PID_MENU_AUTOTUNE:
             // Start auto-tune and show auto-tune screen
             _mode = MODE_AUTOTUNE;
@@ -382,6 +462,14 @@ void UIStateMachine::handlePIDMenuButtonPress() {
             input.playEnterBeep();
             break;
 
+        case PID_MENU_IDENTIFY:
+            // Step-response identification reuses the auto-tune screen
+            _mode = MODE_AUTOTUNE;
+            pid.startIdentification();
+            display.showAutoTuneScreen();
+            input.playEnterBeep();
+            break;
+
         case PID_MENU_KP:
         case PID_MENU_KI:
         case PID_MENU_KD:
@@ -479,10 +567,19 @@ void UIStateMachine::handleAutoTuneMode() {
     auto& display = DisplayManager::getInstance();
 
     // Update auto-tune screen with current progress
-    if (pid.isAutoTuning()) {
+    if (pid.isIdentifying()) {
+        const StepIdentifier& identifier = pid.getIdentifier();
+        char progress[16];
+        snprintf(progress, sizeof(progress), "%d%%", identifier.getProgress());
+        const char* status = (identifier.getState() == StepIdentifier::BASELINE) ? "Baseline..." : "Step response...";
+        display.updateAutoTuneScreen(progress, status);
+    } else if (pid.isAutoTuning()) {
         int cycle = pid.getAutoTuneCycle();
-        const char* status = pid.isAutoTuneCooling() ? "Cooling..." : "Heating...";
-        display.updateAutoTuneScreen(cycle, 5, status);
+        char status[32];
+        snprintf(status, sizeof(status), "%s %.0f%%",
+                 pid.isAutoTuneCooling() ? "Cooling..." : "Heating...",
+                 pid.getAutoTuneConfidence() * 100.0f);
+        display.updateAutoTuneScreen(cycle, pid.getAutoTuneMaxCycles(), status);
     }
 
     // Check if auto-tune completed
@@ -584,19 +681,18 @@ void UIStateMachine::handleSmartControlMode(int delta) {
     auto& settings = SettingsManager::getInstance();
 
     int newSelection = static_cast<int>(_smartSelection) + delta;
+    int step = (delta < 0) ? -1 : 1;
+    bool smartEnabled = settings.getSmartControlEnabled();
 
-    // Wrap around, but skip setpoint if smart control is off
-    do {
+    // Wrap around, skipping policy and setpoint while smart control is off
+    while (true) {
         if (newSelection < 0) newSelection = SMART_CONTROL_ITEM_COUNT - 1;
         else if (newSelection >= SMART_CONTROL_ITEM_COUNT) newSelection = 0;
 
-        // Skip setpoint if smart control is disabled
-        if (newSelection == SMART_CONTROL_SETPOINT && !settings.getSmartControlEnabled()) {
-            newSelection += delta;
-            if (newSelection < 0) newSelection = SMART_CONTROL_ITEM_COUNT - 1;
-            else if (newSelection >= SMART_CONTROL_ITEM_COUNT) newSelection = 0;
-        }
-    } while (newSelection == SMART_CONTROL_SETPOINT && !settings.getSmartControlEnabled());
+        bool needsSmart = newSelection == SMART_CONTROL_POLICY || newSelection == SMART_CONTROL_SETPOINT;
+        if (smartEnabled || !needsSmart) break;
+        newSelection += step;
+    }
 
     _smartSelection = static_cast<SmartControlMenuItem>(newSelection);
     input.playNavigationBeep();
@@ -610,12 +706,29 @@ void UIStateMachine::handleSmartControlButtonPress() {
 
     switch (_smartSelection) {
         case SMART_CONTROL_TOGGLE:
-            // Toggle smart control on/off
-            settings.setSmartControlEnabled(!settings.getSmartControlEnabled());
+            // Cycle smart control Off -> On -> Opt (energy-optimal speed) -> Off
+            if (!settings.getSmartControlEnabled()) {
+                settings.setSmartControlEnabled(true);
+                settings.setFanOptimizeEnabled(false);
+            } else if (!settings.getFanOptimizeEnabled()) {
+                settings.setFanOptimizeEnabled(true);
+            } else {
+                settings.setSmartControlEnabled(false);
+                settings.setFanOptimizeEnabled(false);
+            }
             input.playToggleBeep();
             display.updateSmartControlScreen(_smartSelection, false, settings.getSmartControlEnabled());
             break;
 
+        case SMART_CONTROL_POLICY:
+            // Cycle through the fan policies
+            if (settings.getSmartControlEnabled()) {
+                settings.setFanPolicy(static_cast<FanPolicyType>((settings.getFanPolicy() + 1) % FAN_POLICY_COUNT));
+                input.playToggleBeep();
+                display.updateSmartControlScreen(_smartSelection, false, settings.getSmartControlEnabled());
+            }
+            break;
+
         case SMART_CONTROL_SETPOINT:
             // Only allow editing if smart control is enabled
             if (settings.getSmartControlEnabled()) {
@@ -632,6 +745,13 @@ void UIStateMachine::handleSmartControlButtonPress() {
             display.updateSmartControlScreen(_smartSelection, true, settings.getSmartControlEnabled());
             break;
 
+        case SMART_CONTROL_LOOP:
+            // Toggle open-loop duty / closed-loop RPM
+            settings.setFanRPMMode(!settings.getFanRPMMode());
+            input.playToggleBeep();
+            display.updateSmartControlScreen(_smartSelection, false, settings.getSmartControlEnabled());
+            break;
+
         case SMART_CONTROL_BACK:
             // Return to fan screen
             _mode = MODE_FAN;
@@ -673,8 +793,7 @@ void UIStateMachine::handleMaxFanEditMode(int delta) {
     settings.setFanSpeed(fanSpeed);
     _fanSpeed = fanSpeed;
 
-    // Apply to fan controller immediately
-    FanController::getInstance().setSpeed(static_cast<uint8_t>(fanSpeed));
+    // The main loop applies it (as duty or RPM target) on its next pass
 
     DisplayManager::getInstance().updateSmartControlScreen(_smartSelection, true, settings.getSmartControlEnabled());
 }
@@ -697,7 +816,6 @@ void UIStateMachine::handleFirmwareMode(int delta) {
 void UIStateMachine::handleFirmwareButtonPress() {
     auto& display = DisplayManager::getInstance();
     auto& input = InputController::getInstance();
-    auto& flasher = EXTIO2Flasher::getInstance();
 
     switch (_firmwareSelection) {
         case FIRMWARE_VERSION:
@@ -705,57 +823,11 @@ void UIStateMachine::handleFirmwareButtonPress() {
             break;
 
         case FIRMWARE_UPDATE:
-            // Flash custom firmware
-            _mode = MODE_FIRMWARE_FLASHING;
-            display.showFlashingProgress(0, 11, "Flashing custom...");
-            input.playEnterBeep();
-
-            if (flasher.flashFirmware(extio2_custom_firmware, sizeof(extio2_custom_firmware),
-                [&display](int current, int total) {
-                    display.showFlashingProgress(current, total, "Flashing custom...");
-                    display.update();
-                })) {
-                // Success
-                display.showFlashingProgress(11, 11, "Success!");
-                display.update();
-                delay(1000);
-            } else {
-                // Failed
-                display.showFlashingProgress(0, 11, flasher.getLastError());
-                display.update();
-                delay(2000);
-            }
-
-            // Return to firmware menu
-            _mode = MODE_FIRMWARE;
-            display.updateFirmwareScreen(_firmwareSelection, flasher.readVersion());
+            startFirmwareFlash("custom", "Flashing custom...", "Success!");
             break;
 
         case FIRMWARE_RESTORE:
-            // Flash original firmware
-            _mode = MODE_FIRMWARE_FLASHING;
-            display.showFlashingProgress(0, 11, "Restoring...");
-            input.playEnterBeep();
-
-            if (flasher.flashFirmware(extio2_original_firmware, sizeof(extio2_original_firmware),
-                [&display](int current, int total) {
-                    display.showFlashingProgress(current, total, "Restoring...");
-                    display.update();
-                })) {
-                // Success
-                display.showFlashingProgress(11, 11, "Restored!");
-                display.update();
-                delay(1000);
-            } else {
-                // Failed
-                display.showFlashingProgress(0, 11, flasher.getLastError());
-                display.update();
-                delay(2000);
-            }
-
-            // Return to firmware menu
-            _mode = MODE_FIRMWARE;
-            display.updateFirmwareScreen(_firmwareSelection, flasher.readVersion());
+            startFirmwareFlash("original", "Restoring...", "Restored!");
             break;
 
         case FIRMWARE_BACK:
@@ -772,6 +844,65 @@ void UIStateMachine::handleFirmwareButtonPress() {
     }
 }
 
+void UIStateMachine::startFirmwareFlash(const char* imageName, const char* status, const char* doneText) {
+    auto& display = DisplayManager::getInstance();
+    auto& input = InputController::getInstance();
+
+    const FirmwareStore::Image* image = FirmwareStore::getInstance().find(imageName);
+    _mode = MODE_FIRMWARE_FLASHING;
+    _flashStatus = status;
+    _flashDoneText = doneText;
+    _flashPage = 0;
+    _flashTotal = image ? (image->size + 1023) / 1024 : 11;
+    _flashCancelling = false;
+    _flashFinished = false;
+    input.playEnterBeep();
+
+    // Persist pending settings before the long flash operation
+    SettingsManager::getInstance().flush();
+
+    if (!image || !EXTIO2FlashJob::getInstance().start(*image)) {
+        display.showFlashingProgress(0, _flashTotal, image ? "Flash task failed" : "No firmware image");
+        _flashFinished = true;
+        _flashSucceeded = false;
+        _flashFinishedAt = millis();
+        return;
+    }
+    display.showFlashingProgress(0, _flashTotal, status);
+}
+
+void UIStateMachine::handleFirmwareFlashing() {
+    auto& display = DisplayManager::getInstance();
+    auto& flasher = EXTIO2Flasher::getInstance();
+
+    EXTIO2FlashJob::Progress progress;
+    while (EXTIO2FlashJob::getInstance().poll(progress)) {
+        if (!progress.finished) {
+            _flashPage = progress.page;
+            _flashTotal = progress.totalPages;
+            display.showFlashingProgress(_flashPage, _flashTotal, _flashCancelling ? "Cancelling..." : _flashStatus);
+            continue;
+        }
+
+        _flashFinished = true;
+        _flashSucceeded = progress.success;
+        _flashFinishedAt = millis();
+        if (progress.success) {
+            display.showFlashingProgress(_flashTotal, _flashTotal, _flashDoneText);
+        } else {
+            display.showFlashingProgress(_flashPage, _flashTotal, flasher.getLastError());
+        }
+    }
+
+    // Hold the result on screen, then return to the firmware menu
+    unsigned long hold = _flashSucceeded ? FLASH_SUCCESS_HOLD_MS : FLASH_FAILURE_HOLD_MS;
+    if (_flashFinished && millis() - _flashFinishedAt >= hold) {
+        _flashFinished = false;
+        _mode = MODE_FIRMWARE;
+        display.updateFirmwareScreen(_firmwareSelection, flasher.readVersion());
+    }
+}
+
 void UIStateMachine::updateTemperature() {
     unsigned long now = millis();
 
@@ -825,6 +956,10 @@ void UIStateMachine::refreshDisplay() {
             // Power screen updates from main loop
             break;
 
+        case MODE_ENERGY:
+            // Energy screen updates from main loop
+            break;
+
         case MODE_FAN:
             display.updateFanScreen(FanController::getInstance().getAverageRPM(), _fanSpeed, _fanSelection);
             break;
@@ -853,7 +988,7 @@ void UIStateMachine::refreshDisplay() {
             break;
 
         case MODE_FIRMWARE_FLASHING:
-            // Progress screen updates during flash operation
+            // Progress screen is updated by handleFirmwareFlashing()
             break;
 
         case MODE_NAVIGATE:
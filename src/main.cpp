@@ -19,6 +19,9 @@ WiFiClient telnetClient;
 #endif
 
 #include "PCA9554.h"
+#include "I2CBus.h"
+#include "FirmwareStore.h"
+#include "EXTIO2FlashJob.h"
 
 // Printf to both Serial and Telnet
 void logPrintf(const char* format, ...) {
@@ -44,6 +47,10 @@ void logPrintf(const char* format, ...) {
 #include "DisplayManager.h"
 #include "UIStateMachine.h"
 #include "PIDController.h"
+#include "AnalogAcquisition.h"
+#include "EnergyMeter.h"
+#include "FanOptimizer.h"
+#include "FanPolicy.h"
 
 extern "C" {
     #include "snow_effect.h"
@@ -52,29 +59,15 @@ extern "C" {
 // Snow effect state
 static bool snowInitialized = false;
 
-// Current averaging - filter out bad ADC readings (PWM off-phase samples)
-static constexpr int CURRENT_AVG_SIZE = 10;
-static constexpr float CURRENT_MIN_THRESHOLD = 1.0f;  // Readings below this are considered bad
-static float currentBuffer[CURRENT_AVG_SIZE] = {0};
-static int currentBufferIdx = 0;
-static int currentBufferCount = 0;
-
-static void addCurrentReading(float current) {
-    currentBuffer[currentBufferIdx] = current;
-    currentBufferIdx = (currentBufferIdx + 1) % CURRENT_AVG_SIZE;
-    if (currentBufferCount < CURRENT_AVG_SIZE) currentBufferCount++;
-}
-
-static float getFilteredAverageCurrent() {
-    float sum = 0;
-    int validCount = 0;
-    for (int i = 0; i < currentBufferCount; i++) {
-        if (currentBuffer[i] >= CURRENT_MIN_THRESHOLD) {
-            sum += currentBuffer[i];
-            validCount++;
-        }
+// Fan percentages are duty in open loop, or a fraction of fanMaxRpm in RPM mode
+static void applyFanSpeed(float percent) {
+    auto& fans = FanController::getInstance();
+    auto& settings = SettingsManager::getInstance();
+    if (settings.getFanRPMMode()) {
+        fans.setTargetRPM(static_cast<uint16_t>(percent * settings.getFanMaxRPM() / 100.0f + 0.5f));
+    } else {
+        fans.setSpeed(static_cast<uint8_t>(percent));
     }
-    return (validCount > 0) ? (sum / validCount) : 0.0f;
 }
 
 void setup() {
@@ -86,7 +79,7 @@ void setup() {
 
     // Release M5Dial's external I2C and reinitialize Wire for Port A
     M5.Ex_I2C.release();
-    Wire.begin(13, 15);  // Port A: SDA=GPIO13, SCL=GPIO15
+    I2CBus::getInstance().begin(13, 15);  // Port A: SDA=GPIO13, SCL=GPIO15 (100 kHz until negotiated)
 
     // I2C scan for debugging
     Serial.println("I2C Scan:");
@@ -103,9 +96,11 @@ void setup() {
 
     // Initialize all subsystems
     SettingsManager::getInstance().begin();
+    FirmwareStore::getInstance().begin();     // EXTIO2 images in the extfw partition
     PCA9554::getInstance().begin();           // Must be before TemperatureSensor and TECController
     delay(100);  // Let EXTIO2 fully initialize before configuring pins
     TemperatureSensor::getInstance().begin();
+    AnalogAcquisition::getInstance().begin();
     TECController::getInstance().begin();
     FanController::getInstance().begin();
     InputController::getInstance().begin();
@@ -119,6 +114,9 @@ void setup() {
     // Initialize PID controller
     PIDController::getInstance().begin();
 
+    // Restore energy counters (rolls the last boot's session into "previous")
+    EnergyMeter::getInstance().begin();
+
     // Enable TEC (power will be controlled by PID)
     TECController::getInstance().setEnabled(true);
 
@@ -141,6 +139,11 @@ void setup() {
         Serial.printf("\nWiFi connected! IP: %s\n", WiFi.localIP().toString().c_str());
 
         ArduinoOTA.setHostname("stonecold");
+        ArduinoOTA.onStart([]() {
+            // Persist energy counters and any deferred settings before the OTA reboot
+            EnergyMeter::getInstance().save();
+            SettingsManager::getInstance().flush();
+        });
         ArduinoOTA.begin();
         Serial.println("ArduinoOTA ready");
 
@@ -182,10 +185,20 @@ void loop() {
         input.requeueButtonPress();
     }
 
+    // Un-park the EXTIO2 users once a background flash has finished
+    auto& flashJob = EXTIO2FlashJob::getInstance();
+    flashJob.update();
+
     // Update input and UI state
     input.update();
     ui.update();
 
+    // Commit deferred settings writes once input has gone quiet
+    SettingsManager::getInstance().update();
+
+    // Drain the ADC DMA buffer before consumers look at the windows
+    AnalogAcquisition::getInstance().update();
+
     // Update TEC soft-start ramping
     auto& tec = TECController::getInstance();
     tec.update();
@@ -193,7 +206,15 @@ void loop() {
     // Update fan RPM readings
     FanController::getInstance().update();
 
-    // Check for sensor errors and try to reconnect periodically
+    // I2C clock step-up retries and per-clock stats (the flash task owns the
+    // bus while it runs; everything else is parked behind PCA9554::suspend())
+    if (!flashJob.isRunning()) {
+        I2CBus::getInstance().update();
+    }
+
+    // EXTIO2 reconnection (bus clear, backoff, pin restore) runs in the
+    // background one step per loop; the sensor then re-inits without blocking
+    PCA9554::getInstance().update();
     auto& tempSensor = TemperatureSensor::getInstance();
     if (tempSensor.hasError()) {
         tempSensor.tryReconnect();
@@ -206,54 +227,58 @@ void loop() {
 
     if (!sensorError) {
         pid.update(currentTemp, ui.getSetpoint());
-        // Use instant power changes during auto-tune for accurate measurements
-        tec.setPower(pid.getOutput(), pid.isAutoTuning());
+        // Use instant power changes during auto-tune for accurate measurements;
+        // the MPC enforces its own slew limit, so the TEC ramp must not add lag
+        tec.setPower(pid.getOutput(), pid.isAutoTuning() || pid.isModelPredictive());
     } else {
-        // Sensor error - disable TEC for safety
-        tec.setPower(0.0f, false);
+        // Sensor error - cut the TEC at once for safety, no ramp down
+        tec.setPower(0.0f, true);
     }
 
     // Smart fan control
     auto& fans = FanController::getInstance();
     auto& settings = SettingsManager::getInstance();
 
-    // Track setpoint changes to ramp fans when user adjusts setpoint
-    static float lastSetpoint = NAN;
-    static bool waitingForSetpoint = false;
+    // Smart fan policy (see FanPolicy.h); the optimizer refines the
+    // hysteresis policy's at-setpoint speed
+    static FanPolicyType activePolicy = FAN_POLICY_COUNT;
+    auto& optimizer = FanOptimizer::getInstance();
+    bool holdingSetpoint = false;
 
     if (settings.getSmartControlEnabled() && !sensorError) {
-        float setpointC = ui.getSetpoint();
-        static constexpr float HYSTERESIS_C = 2.78f;  // ~5°F
-
-        // Detect setpoint change - ramp fans to max until new setpoint reached
-        if (!isnan(lastSetpoint) && setpointC != lastSetpoint) {
-            waitingForSetpoint = true;
-            fans.setSpeed(static_cast<uint8_t>(settings.getFanSpeed()));
+        FanPolicy& policy = FanPolicy::forType(settings.getFanPolicy());
+        if (settings.getFanPolicy() != activePolicy) {
+            policy.reset();
+            activePolicy = settings.getFanPolicy();
         }
-        lastSetpoint = setpointC;
-
-        if (waitingForSetpoint) {
-            // Waiting for new setpoint to be reached - keep fans at max
-            if (currentTemp <= setpointC) {
-                // Reached new setpoint - switch to smart mode
-                waitingForSetpoint = false;
-                fans.setSpeed(static_cast<uint8_t>(settings.getSmartSetpoint()));
-            }
-            // else keep fans at max (already set above or from previous iteration)
-        } else if (currentTemp > setpointC + HYSTERESIS_C) {
-            // Too warm - run at max fan speed
-            fans.setSpeed(static_cast<uint8_t>(settings.getFanSpeed()));
-        } else if (currentTemp <= setpointC) {
-            // At or below setpoint - use smart setpoint (lower speed)
-            fans.setSpeed(static_cast<uint8_t>(settings.getSmartSetpoint()));
+
+        FanPolicyInput in;
+        in.nowMs = millis();
+        in.temperature = currentTemp;
+        in.setpoint = ui.getSetpoint();
+        in.tecPower = tec.getPower();
+        in.smartPercent = settings.getSmartSetpoint();
+        in.maxPercent = settings.getFanSpeed();
+        FanPolicyOutput out = policy.update(in);
+
+        float speed = out.percent;
+        holdingSetpoint = out.holding;
+        if (holdingSetpoint && settings.getFanOptimizeEnabled()) {
+            speed = optimizer.update(currentTemp, in.setpoint, speed, in.maxPercent);
         }
-        // Between setpoint and setpoint+hysteresis: maintain current speed (no change)
+        applyFanSpeed(speed);
     } else {
         // Smart mode off or sensor error - use max fan speed
-        fans.setSpeed(static_cast<uint8_t>(settings.getFanSpeed()));
-        lastSetpoint = ui.getSetpoint();  // Keep tracking even when disabled
-        waitingForSetpoint = false;
+        applyFanSpeed(settings.getFanSpeed());
+        activePolicy = FAN_POLICY_COUNT;  // Start the policy fresh when re-enabled
     }
+    if (!holdingSetpoint || !settings.getFanOptimizeEnabled()) {
+        optimizer.reset();
+    }
+
+    // Integrate TEC and fan energy for this loop
+    auto& energy = EnergyMeter::getInstance();
+    energy.update(sensorError ? NAN : currentTemp);
 
     // Log temperature and TEC current every second
     static unsigned long lastLog = 0;
@@ -264,19 +289,25 @@ void loop() {
             float tempF = currentTemp * 9.0f / 5.0f + 32.0f;
             float setpointC = ui.getSetpoint();
             float setpointF = setpointC * 9.0f / 5.0f + 32.0f;
-            float current = tec.readCurrent();
-            addCurrentReading(current);
-            float avgCurrent = getFilteredAverageCurrent();
-            logPrintf("Temp: %.1fF (SP: %.1fF) | TEC: %.2fA (avg: %.2fA) | power: %.0f%% | LFan: %drpm RFan: %drpm\n",
-                      tempF, setpointF, current, avgCurrent, tec.getPower() * 100.0f,
-                      fans.getFan1RPM(), fans.getFan2RPM());
+            char optText[64] = "";
+            if (optimizer.isActive()) {
+                snprintf(optText, sizeof(optText), " | opt: fan %.0f%%%s saving %.1fW (%.2fWh)",
+                         optimizer.getFanPercent(), optimizer.isConverged() ? "" : "?",
+                         optimizer.getSavingsWatts(), optimizer.getSavedWh());
+            }
+            logPrintf("Temp: %.1fF (SP: %.1fF) | TEC: %.2fA (on: %.2fA) | power: %.0f%% | LFan: %drpm (%s) RFan: %drpm (%s)"
+                      " | %.1fW (%.2fWh) COP: %.2f lift: %.1fC%s\n",
+                      tempF, setpointF, tec.readCurrent(), tec.getOnPhaseCurrent(), tec.getPower() * 100.0f,
+                      fans.getFan1RPM(), FanController::healthName(fans.getFan1Health()),
+                      fans.getFan2RPM(), FanController::healthName(fans.getFan2Health()),
+                      energy.getTotalPower(), energy.getSessionWh(), energy.getCOP(), energy.getLift(), optText);
         }
         lastLog = millis();
     }
 
-    // Update current screen if visible (use filtered average)
+    // Update current screen if visible (average over whole PWM periods)
     if (display.isCurrentScreenVisible()) {
-        display.updateCurrentScreen(getFilteredAverageCurrent());
+        display.updateCurrentScreen(tec.readCurrent());
     }
 
     // Update power screen if visible
@@ -284,6 +315,12 @@ void loop() {
         display.updatePowerScreen(tec.getPower() * 100.0f);
     }
 
+    // Update energy screen if visible
+    if (display.isEnergyScreenVisible()) {
+        display.updateEnergyScreen(energy.getTotalPower(), energy.getSessionWh(), energy.getLifetimeWh(),
+                                   energy.getCOP(), energy.getLift());
+    }
+
     // Fan screen is updated by UIStateMachine (RPM will be added when fan hardware is connected)
 
     // Snow effect conditions with hysteresis
@@ -296,6 +333,7 @@ void loop() {
                         !display.isCurrentScreenVisible() &&
                         !display.isSetpointScreenVisible() &&
                         !display.isPowerScreenVisible() &&
+                        !display.isEnergyScreenVisible() &&
                         !display.isFanScreenVisible() &&
                         !display.isFanSpeedScreenVisible() &&
                         !display.isSmartControlScreenVisible();